@@ -0,0 +1,64 @@
+/**
+ * @file BenchBatchEnv.cpp
+ * @brief Benchmark do BatchEnv: passos de ambiente por segundo com 1 até N threads.
+ *
+ * O agente lê só as observações (como um agente treinado faria) e decide os pulos
+ * com a mesma regra do piloto automático, então parte das partidas termina e é
+ * reiniciada durante a medição.
+ *
+ * Uso: bin/bench/BenchBatchEnv [segundos] [partidas]
+ */
+#include "env/BatchEnv.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+    double run(size_t envs, unsigned threads, double duration, size_t& episodes)
+    {
+        BatchEnv env(envs, threads);
+        std::vector<float> obs(envs * BatchEnv::OBS_SIZE), rewards(envs);
+        std::vector<uint8_t> actions(envs), dones(envs);
+        env.reset(1, obs.data());
+
+        size_t steps = 0;
+        episodes = 0;
+        BenchTimer timer;
+        do {
+            for (int k = 0; k < 16; ++k) {
+                for (size_t i = 0; i < envs; ++i) {
+                    const float* o = &obs[i * BatchEnv::OBS_SIZE];
+                    const float target = (o[OBS_PIPE_GAP_TOP] + o[OBS_PIPE_GAP_BOTTOM]) / 2.0f + (i % 5) * 0.03f;
+                    actions[i] = o[OBS_BIRD_Y] > target && o[OBS_BIRD_VEL_Y] > 0.0f;
+                }
+                env.step(actions.data(), obs.data(), rewards.data(), dones.data());
+                for (uint8_t d : dones) episodes += d;
+                steps += envs;
+            }
+        } while (timer.seconds() < duration);
+        return steps / timer.seconds();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double duration = argc > 1 ? std::atof(argv[1]) : 1.0;
+    size_t envs = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 4096;
+    unsigned cores = std::thread::hardware_concurrency();
+    if (cores == 0) cores = 1;
+
+    std::printf("BatchEnv (%zu partidas, %.1f s por medida, %u núcleos)\n", envs, duration, cores);
+    // 1, 2, 4, ... threads e, por último, todos os núcleos.
+    std::vector<unsigned> counts;
+    for (unsigned threads = 1; threads < cores; threads *= 2) counts.push_back(threads);
+    counts.push_back(cores);
+    for (unsigned threads : counts) {
+        size_t episodes;
+        double rate = run(envs, threads, duration, episodes);
+        std::printf("  %2u threads: %8.3e passos/s  (%zu episódios terminados)\n", threads, rate, episodes);
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file BenchBirdPopulation.cpp
+ * @brief Benchmark da BirdPopulation: mede quantos passos de pássaro por segundo um núcleo executa.
+ *
+ * Uso: bin/bench/BenchBirdPopulation [segundos_por_tamanho]
+ */
+#include "sim/BirdPopulation.hpp"
+#include "sim/PipeCourse.hpp"
+#include "sim/SimRandom.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Controlador simples: pula quando o pássaro cai abaixo do centro do próximo vão.
+     * @details Cada pássaro tem um desvio próprio do alvo, então a população se espalha
+     * e parte dela colide. O custo do controlador entra na medição.
+     */
+    void decideJumps(const BirdPopulation& population, const PipeCourse& course,
+                     const std::vector<float>& offsets, std::vector<uint8_t>& jumps)
+    {
+        float target = BUFFER_H / 2.0f;
+        for (int p = 0; p < course.getCount(); ++p) {
+            if (course.getX(p) + PIPE_WIDTH >= BIRD_START_X) {
+                target = (course.getGapTop(p) + course.getGapBottom(p)) / 2.0f;
+                break;
+            }
+        }
+        const float* y = population.getY();
+        const float* velY = population.getVelY();
+        for (size_t i = 0; i < population.size(); ++i) {
+            jumps[i] = (y[i] > target + offsets[i]) & (velY[i] > 0.0f);
+        }
+    }
+
+    double runSize(size_t birds, double seconds)
+    {
+        BirdPopulation population(birds);
+        PipeCourse course;
+        course.reset(42);
+
+        std::vector<float> offsets(birds);
+        std::vector<uint8_t> jumps(birds);
+        SimRandom rng;
+        rng.seed(7);
+        for (auto& o : offsets) o = (rng.nextFloat() - 0.5f) * 120.0f;
+
+        const float deltaTime = 1.0f / FPS;
+        size_t ticks = 0;
+        size_t runs = 1;
+        long long pipesPassed = 0;
+        BenchTimer timer;
+        double elapsed = 0.0;
+        do {
+            for (int k = 0; k < 64; ++k, ++ticks) {
+                decideJumps(population, course, offsets, jumps);
+                if (population.step(jumps.data(), course, deltaTime) == 0) {
+                    for (size_t i = 0; i < birds; ++i) pipesPassed += population.getScore()[i];
+                    population.reset();
+                    course.reset(42 + runs++);
+                }
+            }
+            elapsed = timer.seconds();
+        } while (elapsed < seconds);
+
+        double birdTicks = static_cast<double>(ticks) * birds;
+        std::printf("%7zu birds | %8zu ticks | %5zu runs | %11.1f ns/tick | %9.3e bird-ticks/s | %lld pipes passed\n",
+                    birds, ticks, runs, elapsed * 1e9 / ticks, birdTicks / elapsed, pipesPassed);
+        return birdTicks / elapsed;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+    std::printf("BirdPopulation (1 núcleo, %.1f s por tamanho)\n", seconds);
+    for (size_t birds : {1000, 10000, 100000}) {
+        runSize(birds, seconds);
+    }
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file BenchBroadPhase.cpp
+ * @brief Benchmark da broad-phase: custo de um passo de 10⁴ pássaros contra percursos cada vez mais longos.
+ *
+ * Compara a busca binária da janela de canos (findPipeWindow) com a varredura
+ * linear de todos os canos. Com a broad-phase o custo por passo deve ficar
+ * estável, enquanto a varredura cresce com o número de canos.
+ *
+ * Uso: bin/bench/BenchBroadPhase [segundos_por_tamanho]
+ */
+#include "sim/BirdPopulation.hpp"
+#include "sim/BroadPhase.hpp"
+#include "sim/PipePhysics.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    const size_t BIRDS = 10000;
+
+    /// Número de canos que cruzam a coluna dos pássaros, pela varredura linear.
+    int linearWindowSize(const PipeSpan& pipes)
+    {
+        const float birdLeft = BIRD_START_X;
+        const float birdRight = BIRD_START_X + BIRD_WIDTH;
+        int hits = 0;
+        for (int i = 0; i < pipes.count; ++i) {
+            hits += pipeOverlapsColumn(pipes.x[i], pipes.x[i] + PIPE_WIDTH, birdLeft, birdRight);
+        }
+        return hits;
+    }
+
+    /**
+     * @brief Mede o tempo médio de um passo com n canos.
+     * @param linear Se true, varre todos os canos antes de cada passo (o custo antigo).
+     */
+    double timeStep(int pipeCount, bool linear, double seconds)
+    {
+        // Um percurso longo com o primeiro cano cruzando a coluna dos pássaros.
+        std::vector<float> x(pipeCount), gapTop(pipeCount), gapBottom(pipeCount);
+        for (int i = 0; i < pipeCount; ++i) {
+            x[i] = BIRD_START_X - PIPE_WIDTH / 2 + i * PIPE_WIDTH * 3;
+            gapTop[i] = 0.0f;
+            gapBottom[i] = PLAYABLE_AREA_HEIGHT;
+        }
+        PipeSpan span{x.data(), gapTop.data(), gapBottom.data(), pipeCount};
+
+        BirdPopulation population(BIRDS);
+        std::vector<uint8_t> jumps(BIRDS, 0);
+        const float deltaTime = 1.0f / FPS;
+        size_t ticks = 0;
+        long long sink = 0;
+        BenchTimer timer;
+        double elapsed = 0.0;
+        do {
+            for (int k = 0; k < 64; ++k, ++ticks) {
+                // Pula a cada 20 passos para manter os pássaros no ar.
+                jumps.assign(BIRDS, ticks % 20 == 0);
+                if (linear) sink += linearWindowSize(span);
+                else sink += findPipeWindow(span, float(BIRD_START_X), float(BIRD_START_X + BIRD_WIDTH)).size();
+                population.stepBirds(jumps.data(), span, 0, deltaTime);
+            }
+            elapsed = timer.seconds();
+        } while (elapsed < seconds);
+
+        if (sink != static_cast<long long>(ticks)) std::printf("  (janela inesperada: %lld)\n", sink);
+        return elapsed * 1e9 / ticks;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = argc > 1 ? std::atof(argv[1]) : 0.5;
+    std::printf("BroadPhase (%zu pássaros, %.1f s por medida)\n", BIRDS, seconds);
+    std::printf("%9s | %18s | %18s\n", "canos", "broad-phase ns/tick", "linear ns/tick");
+    for (int pipes : {4, 64, 1024, 16384, 262144, 1048576}) {
+        double broad = timeStep(pipes, false, seconds);
+        double linear = timeStep(pipes, true, seconds);
+        std::printf("%9d | %18.1f | %18.1f\n", pipes, broad, linear);
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file BenchBroadcast.cpp
+ * @brief Benchmark da transmissão para espectadores: banda por espectador e CPU do servidor.
+ *
+ * Conecta N espectadores por socket Unix no mesmo processo e publica uma
+ * partida do autopiloto. Só o tempo gasto em publish() e poll() (o custo do
+ * jogo) é medido; os espectadores leem entre os quadros.
+ *
+ * Uso: bin/bench/BenchBroadcast [segundos de jogo]
+ */
+#include "net/SpectatorBroadcast.hpp"
+#include "net/StreamSocket.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    const double gameSeconds = argc > 1 ? std::atof(argv[1]) : 30.0;
+    const int frames = static_cast<int>(gameSeconds * FPS);
+    const std::string address = "unix:/tmp/flappy_bench_" + std::to_string(getpid()) + ".sock";
+    SpectatorBroadcast& broadcast = SpectatorBroadcast::getInstance();
+    uint8_t buffer[1 << 16];
+
+    std::printf("Transmissão (%.0f s de jogo, envio a cada %d quadros)\n", gameSeconds, SpectatorBroadcast::FLUSH_FRAMES);
+    const int counts[] = {1, 16, 64, 256};
+    for (int spectators : counts) {
+        broadcast.start(address);
+        std::vector<std::unique_ptr<StreamClient>> clients;
+        for (int c = 0; c < spectators; ++c) {
+            clients.push_back(std::make_unique<StreamClient>(address));
+            // Aceita em grupos, para não encher a fila de conexões pendentes.
+            if (c % 32 == 31) {
+                for (int f = 0; f < SpectatorBroadcast::FLUSH_FRAMES; ++f) broadcast.poll();
+            }
+        }
+
+        FixedGameSimulation sim;
+        sim.reset(1);
+        double serverSeconds = 0.0;
+        uint64_t received = 0;
+        for (int f = 0; f < frames; ++f) {
+            if (sim.getPhase() == SimPhase::DEAD) sim.reset(f);
+            sim.step(autopilot(sim.getState()));
+
+            BenchTimer timer;
+            broadcast.publish(sim.getState());
+            broadcast.poll();
+            serverSeconds += timer.seconds();
+
+            for (auto& client : clients) {
+                while (size_t n = client->receive(buffer, sizeof(buffer))) received += n;
+            }
+        }
+
+        const double perFrameUs = serverSeconds * 1e6 / frames;
+        std::printf("  %3d espectadores: %7.1f bytes/s por espectador, servidor %7.2f us por quadro (%.3f us por espectador)\n",
+                    spectators, static_cast<double>(received) / spectators / gameSeconds, perFrameUs,
+                    perFrameUs / spectators);
+        broadcast.stop();
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file BenchFixedPoint.cpp
+ * @brief Benchmark da física em ponto fixo (Q16.16) contra a física em float.
+ *
+ * Roda a mesma população, com o mesmo controlador, em FixedBirdPopulation e
+ * BirdPopulation e mostra o custo relativo do modo determinístico.
+ *
+ * Uso: bin/bench/BenchFixedPoint [segundos_por_medida]
+ */
+#include "sim/BirdPopulation.hpp"
+#include "sim/PipeCourse.hpp"
+#include "sim/Fixed.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    /**
+     * @brief Mede bird-ticks/s de uma população no tipo escalar dado.
+     * @details O controlador pula quando o pássaro cai abaixo do centro do próximo vão,
+     * com um desvio fixo por pássaro, e é calculado no mesmo tipo escalar.
+     */
+    template <typename Scalar>
+    double run(size_t birds, double seconds)
+    {
+        BasicBirdPopulation<Scalar> population(birds);
+        BasicPipeCourse<Scalar> course;
+        course.reset(42);
+        std::vector<Scalar> offsets(birds);
+        std::vector<uint8_t> jumps(birds);
+        for (size_t i = 0; i < birds; ++i) offsets[i] = Scalar(static_cast<int>(i % 121) - 60);
+
+        const Scalar deltaTime = Scalar(1.0f / FPS);
+        size_t ticks = 0;
+        size_t runs = 1;
+        BenchTimer timer;
+        double elapsed = 0.0;
+        do {
+            for (int k = 0; k < 64; ++k, ++ticks) {
+                Scalar target = Scalar(BUFFER_H / 2);
+                for (int p = 0; p < course.getCount(); ++p) {
+                    if (course.getX(p) + Scalar(PIPE_WIDTH) >= Scalar(BIRD_START_X)) {
+                        target = course.getGapTop(p) + Scalar(PIPE_GAP / 2);
+                        break;
+                    }
+                }
+                const Scalar* y = population.getY();
+                const Scalar* velY = population.getVelY();
+                for (size_t i = 0; i < birds; ++i) {
+                    jumps[i] = (y[i] > target + offsets[i]) & (velY[i] > Scalar(0));
+                }
+                if (population.step(jumps.data(), course, deltaTime) == 0) {
+                    population.reset();
+                    course.reset(42 + runs++);
+                }
+            }
+            elapsed = timer.seconds();
+        } while (elapsed < seconds);
+        return static_cast<double>(ticks) * birds / elapsed;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+    std::printf("Física float vs ponto fixo Q16.16 (1 núcleo, %.1f s por medida)\n", seconds);
+    std::printf("%7s | %17s | %17s | %6s\n", "birds", "float bird-ticks/s", "fixed bird-ticks/s", "razão");
+    for (size_t birds : {1000, 10000, 100000}) {
+        double floatRate = run<float>(birds, seconds);
+        double fixedRate = run<Fixed>(birds, seconds);
+        std::printf("%7zu | %17.3e | %17.3e | %5.2fx\n", birds, floatRate, fixedRate, floatRate / fixedRate);
+    }
+    return 0;
+}
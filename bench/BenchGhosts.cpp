@@ -0,0 +1,102 @@
+/**
+ * @file BenchGhosts.cpp
+ * @brief Benchmark dos fantasmas: decodificar trajetórias contra re-simular cada replay.
+ *
+ * Grava GHOSTS partidas do autopiloto com variações no mesmo percurso e mede,
+ * por passo da partida ao vivo, o custo de posicionar todos os fantasmas a
+ * partir das trajetórias compactas e o de rodar uma FixedGameSimulation por
+ * fantasma. Também mede o salto para um passo qualquer (rewind) e o tamanho
+ * das trajetórias.
+ *
+ * Uso: bin/bench/BenchGhosts [segundos]
+ */
+#include "sim/GhostTrack.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "sim/Replay.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    double duration = argc > 1 ? std::atof(argv[1]) : 1.0;
+    const int GHOSTS = 500;
+    const int MAX_TICKS = 1800; // 1 minuto de jogo.
+    const uint64_t SEED = 1;
+
+    std::vector<Replay> replays(GHOSTS);
+    size_t totalTicks = 0;
+    uint32_t longest = 0;
+    for (int g = 0; g < GHOSTS; ++g) {
+        FixedGameSimulation sim;
+        sim.reset(SEED);
+        replays[g].clear(SEED);
+        const float offset = 5.0f + 0.06f * g;
+        for (int t = 0; t < MAX_TICKS && sim.getPhase() != SimPhase::DEAD; ++t) {
+            bool jump = autopilot(sim.getState(), offset);
+            sim.step(jump);
+            replays[g].record(jump, sim.hash());
+        }
+        totalTicks += replays[g].getTickCount();
+        if (replays[g].getTickCount() > longest) longest = static_cast<uint32_t>(replays[g].getTickCount());
+    }
+
+    // Construção (uma vez, ao carregar o placar).
+    GhostTrackSet ghosts;
+    BenchTimer timer;
+    for (const Replay& replay : replays) ghosts.add(replay);
+    double buildMs = timer.seconds() * 1e3;
+
+    // Lock-step: um passo por vez, do início ao fim, repetido.
+    size_t ticks = 0;
+    float sink = 0.0f;
+    timer.restart();
+    do {
+        for (uint32_t t = 0; t <= longest; ++t, ++ticks) {
+            ghosts.setTick(t);
+            sink += ghosts.getY(t % GHOSTS);
+        }
+    } while (timer.seconds() < duration);
+    double decodeUs = timer.seconds() * 1e6 / ticks;
+
+    // Saltos para passos aleatórios (rewind e save states).
+    size_t seeks = 0;
+    uint32_t target = 1;
+    timer.restart();
+    do {
+        for (int k = 0; k < 64; ++k, ++seeks) {
+            target = (target * 1103515245u + 12345u) % longest;
+            ghosts.setTick(target);
+            sink += ghosts.getY(0);
+        }
+    } while (timer.seconds() < duration);
+    double seekUs = timer.seconds() * 1e6 / seeks;
+
+    // Alternativa: uma FixedGameSimulation por fantasma, re-simulada a cada passo.
+    std::vector<FixedGameSimulation> sims(GHOSTS);
+    ticks = 0;
+    timer.restart();
+    do {
+        for (int g = 0; g < GHOSTS; ++g) sims[g].reset(SEED);
+        for (uint32_t t = 0; t < longest; ++t, ++ticks) {
+            for (int g = 0; g < GHOSTS; ++g) {
+                if (t < replays[g].getTickCount()) sims[g].step(replays[g].getJump(t));
+            }
+        }
+        sink += toFloat(sims[0].getState().birdY);
+    } while (timer.seconds() < duration);
+    double simulateUs = timer.seconds() * 1e6 / ticks;
+
+    std::printf("Fantasmas (%d replays, %zu passos gravados, %.1f s por medida)\n", GHOSTS, totalTicks, duration);
+    std::printf("  trajetórias:                  %8zu bytes (%.2f bytes por passo)\n",
+                ghosts.getEncodedBytes(), static_cast<double>(ghosts.getEncodedBytes()) / totalTicks);
+    std::printf("  construção (uma vez):         %8.1f ms\n", buildMs);
+    std::printf("  passo com trajetórias:        %8.2f us\n", decodeUs);
+    std::printf("  passo re-simulando replays:   %8.2f us\n", simulateUs);
+    std::printf("  salto para um passo qualquer: %8.2f us\n", seekUs);
+    std::printf("  (checksum %.1f)\n", sink);
+    return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file BenchPixels.cpp
+ * @brief Benchmark do PixelRenderer: quadros por segundo em RGB cheio e 84x84 cinza.
+ *
+ * Mede um núcleo desenhando estados variados de uma partida e depois um lote de
+ * partidas desenhado por todas as threads do BatchEnv. Precisa ser rodado da
+ * raiz do projeto (lê assets/sprites).
+ *
+ * Uso: bin/bench/BenchPixels [segundos] [partidas]
+ */
+#include "env/BatchEnv.hpp"
+#include "env/PixelRenderer.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+    const char* name(PixelFormat format) { return format == PixelFormat::RGB ? "RGB 288x512" : "cinza 84x84"; }
+}
+
+int main(int argc, char** argv)
+{
+    double duration = argc > 1 ? std::atof(argv[1]) : 1.0;
+    size_t envs = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 256;
+
+    BenchTimer timer;
+    SpriteAtlas atlas;
+    PixelRenderer renderer(atlas);
+    std::printf("PixelRenderer (%.1f s por medida; atlas e sprites pré-girados em %.0f ms)\n",
+                duration, timer.seconds() * 1e3);
+
+    // Estados de uma partida real, para variar canos, rolagem e ângulo do pássaro.
+    std::vector<SimState> states;
+    GameSimulation sim;
+    sim.reset(1);
+    while (states.size() < 600 && sim.getPhase() != SimPhase::DEAD) {
+        sim.step(autopilot(sim.getState()));
+        states.push_back(sim.getState());
+    }
+
+    for (PixelFormat format : {PixelFormat::RGB, PixelFormat::GRAY_84}) {
+        std::vector<uint8_t> frame(PixelRenderer::frameBytes(format));
+        size_t frames = 0;
+        timer.restart();
+        do {
+            for (const SimState& state : states) renderer.render(state, format, frame.data());
+            frames += states.size();
+        } while (timer.seconds() < duration);
+        std::printf("  1 núcleo, %-12s %9.0f quadros/s\n", name(format), frames / timer.seconds());
+    }
+
+    BatchEnv env(envs);
+    env.reset(1, nullptr);
+    std::vector<uint8_t> actions(envs);
+    for (PixelFormat format : {PixelFormat::RGB, PixelFormat::GRAY_84}) {
+        std::vector<uint8_t> frames(envs * PixelRenderer::frameBytes(format));
+        size_t rendered = 0;
+        timer.restart();
+        do {
+            for (size_t i = 0; i < envs; ++i) actions[i] = autopilot(env.getState(i));
+            env.step(actions.data(), nullptr, nullptr, nullptr);
+            env.render(renderer, format, frames.data());
+            rendered += envs;
+        } while (timer.seconds() < duration);
+        std::printf("  lote de %zu, %u threads, %-12s %9.0f passos+quadros/s\n",
+                    envs, env.getThreadCount(), name(format), rendered / timer.seconds());
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+/**
+ * @file BenchPlanner.cpp
+ * @brief Benchmark do BeamPlanner: tempo por decisão, planos por segundo e sobrevivência por percurso.
+ *
+ * Joga uma partida por semente com o piloto automático, replanejando a cada
+ * passo, até morrer ou até o limite de passos. Percursos em que nem a busca
+ * sobrevive indicam trechos impossíveis ou muito difíceis.
+ *
+ * Uso: bin/bench/BenchPlanner [sementes] [passos_por_partida] [largura] [horizonte]
+ */
+#include "sim/BeamPlanner.hpp"
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+    const int seeds = argc > 1 ? std::atoi(argv[1]) : 20;
+    const uint32_t maxTicks = argc > 2 ? static_cast<uint32_t>(std::atoi(argv[2])) : 1800;
+    const int width = argc > 3 ? std::atoi(argv[3]) : BeamPlanner::DEFAULT_WIDTH;
+    const int horizon = argc > 4 ? std::atoi(argv[4]) : BeamPlanner::DEFAULT_HORIZON;
+
+    BeamPlanner planner(width, horizon);
+    int survived = 0;
+    long long totalScore = 0;
+    uint64_t decisions = 0;
+    double worstDecision = 0.0;
+    BenchTimer timer;
+
+    for (int s = 1; s <= seeds; ++s) {
+        FixedGameSimulation sim;
+        sim.reset(s);
+        while (sim.getPhase() != SimPhase::DEAD && sim.getTick() < maxTicks) {
+            BenchTimer decisionTimer;
+            bool jump = planner.plan(sim.getState());
+            worstDecision = std::max(worstDecision, decisionTimer.seconds());
+            ++decisions;
+            sim.step(jump);
+        }
+        totalScore += sim.getScore();
+        if (sim.getPhase() != SimPhase::DEAD) {
+            ++survived;
+        } else {
+            std::printf("  semente %d: morreu no passo %u com %d pontos\n", s, sim.getTick(), sim.getScore());
+        }
+    }
+    const double elapsed = timer.seconds();
+
+    std::printf("BeamPlanner (largura %d, horizonte %d passos, %d sementes de até %u passos)\n",
+                width, horizon, seeds, maxTicks);
+    std::printf("  sobreviveram:            %d de %d (pontuação média %.1f)\n",
+                survived, seeds, static_cast<double>(totalScore) / seeds);
+    std::printf("  tempo médio por decisão: %8.1f µs (pior %.1f µs; orçamento do quadro %.0f µs)\n",
+                elapsed * 1e6 / decisions, worstDecision * 1e6, 1e6 / FPS);
+    std::printf("  planos avaliados/s:      %8.3e\n", planner.getPlansEvaluated() / elapsed);
+    std::printf("  passos simulados/s:      %8.3e\n", planner.getStepsSimulated() / elapsed);
+    return 0;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file BenchReplayVerify.cpp
+ * @brief Benchmark do ReplayVerifier: replays conferidos por segundo, de 1 thread até todos os núcleos.
+ *
+ * Grava partidas com um piloto simples (de alguns segundos a alguns minutos de
+ * jogo) e confere o lote inteiro, como faria um servidor de placar.
+ *
+ * Uso: bin/bench/BenchReplayVerify [replays]
+ */
+#include "sim/ReplayVerifier.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "sim/Replay.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+    Replay playAndRecord(uint64_t seed, uint32_t maxTicks)
+    {
+        FixedGameSimulation sim;
+        sim.reset(seed);
+        Replay replay;
+        replay.clear(seed);
+        while (sim.getPhase() != SimPhase::DEAD && sim.getTick() < maxTicks) {
+            bool jump = autopilot(sim.getState());
+            sim.step(jump);
+            replay.record(jump, sim.hash());
+        }
+        replay.setFinalScore(sim.getScore());
+        return replay;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t count = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 4000;
+
+    std::vector<Replay> replays;
+    replays.reserve(count);
+    size_t totalTicks = 0;
+    for (size_t i = 0; i < count; ++i) {
+        replays.push_back(playAndRecord(i + 1, 5 * 60 * static_cast<uint32_t>(FPS)));
+        totalTicks += replays.back().getTickCount();
+    }
+
+    std::printf("ReplayVerifier (%zu replays, média de %.1f s de jogo)\n", count, totalTicks / FPS / count);
+    const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; ; threads *= 2) {
+        if (threads > cores) threads = cores;
+        ReplayVerifier verifier(threads);
+        BenchTimer timer;
+        std::vector<ReplayCheck> checks = verifier.verify(replays);
+        double elapsed = timer.seconds();
+
+        size_t valid = 0;
+        for (const ReplayCheck& check : checks) valid += check.valid();
+        std::printf("  %2u threads: %9.0f replays/s  %8.3e passos/s  (%zu válidos)\n",
+                    threads, count / elapsed, totalTicks / elapsed, valid);
+        if (threads == cores) break;
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file BenchRollback.cpp
+ * @brief Benchmark do rollback do modo versus: custo de voltar e re-simular N passos em um quadro.
+ *
+ * As entradas do jogador remoto chegam sempre N passos atrasadas; cada pulo
+ * remoto foi previsto como "sem pulo", então cada um deles força um rollback de
+ * N passos dentro de advance(). O tempo desses quadros é comparado com o
+ * orçamento de um quadro a FPS.
+ *
+ * Uso: bin/bench/BenchRollback [segundos]
+ */
+#include "sim/RollbackSession.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace {
+    /// Pulos de um jogador sozinho com o autopiloto.
+    std::vector<bool> script(uint64_t seed, float offset, int ticks)
+    {
+        FixedGameSimulation sim;
+        sim.reset(seed);
+        std::vector<bool> jumps;
+        for (int t = 0; t < ticks; ++t) {
+            jumps.push_back(autopilot(sim.getState(), offset));
+            sim.step(t == 0 || jumps.back());
+        }
+        return jumps;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    double duration = argc > 1 ? std::atof(argv[1]) : 1.0;
+    const int TICKS = 1000;
+    const uint64_t SEED = 1;
+    const std::vector<bool> local = script(SEED, 20.0f, TICKS);
+    const std::vector<bool> remote = script(SEED, 30.0f, TICKS);
+    auto session = std::make_unique<RollbackSession>();
+
+    std::printf("Rollback (%zu bytes por snapshot, %.1f s por medida, quadro de %.1f ms)\n",
+                sizeof(VersusSimulation), duration, 1000.0 / FPS);
+    const uint32_t delays[] = {1, 4, 8, RollbackSession::MAX_PREDICTION};
+    for (uint32_t delay : delays) {
+        size_t rollbackFrames = 0, otherFrames = 0;
+        double rollbackTime = 0.0, otherTime = 0.0;
+        uint64_t resimulated = 0;
+        BenchTimer timer;
+        do {
+            session->start(SEED, 0);
+            for (int t = 0; t < TICKS; ++t) {
+                if (t >= static_cast<int>(delay)) session->addRemoteInput(t - delay, remote[t - delay]);
+                const uint32_t before = session->getRollbackCount();
+                BenchTimer frameTimer;
+                session->advance(local[t]);
+                const double frame = frameTimer.seconds();
+                if (session->getRollbackCount() != before) {
+                    ++rollbackFrames;
+                    rollbackTime += frame;
+                    resimulated += session->getLastRollback();
+                } else {
+                    ++otherFrames;
+                    otherTime += frame;
+                }
+            }
+        } while (timer.seconds() < duration);
+
+        const double rollbackUs = rollbackTime * 1e6 / (rollbackFrames ? rollbackFrames : 1);
+        std::printf("  atraso de %2u passos: quadro com rollback %7.2f us (%.1f passos re-simulados), "
+                    "sem rollback %6.2f us, %.4f%% do quadro\n",
+                    delay, rollbackUs, static_cast<double>(resimulated) / (rollbackFrames ? rollbackFrames : 1),
+                    otherTime * 1e6 / (otherFrames ? otherFrames : 1), rollbackUs * 1e-6 * FPS * 100.0);
+    }
+    return 0;
+}
@@ -0,0 +1,205 @@
+/**
+ * @file BenchSceneDraw.cpp
+ * @brief Benchmark do custo de CPU dos draw() das cenas, com o NullRenderer.
+ *
+ * Os draw() rodam contra o NullRenderer, que só conta as chamadas: o tempo
+ * medido é só o da lógica de desenho (layout, formatação de texto, buscas de
+ * recursos), sem GPU nem display. Os sprites do atlas são carregados como
+ * bitmaps de memória, então o benchmark roda em máquinas de CI sem display,
+ * a partir da raiz do projeto (lê assets/sprites).
+ *
+ * Na segunda parte, as mesmas cenas desenham de verdade, com o AllegroRenderer
+ * num bitmap de memória (o rasterizador em software do Allegro), com os
+ * caches de camadas ligados e desligados: a diferença é o que se economiza
+ * em preenchimento de pixels. Por fim, o cenário da GameScene com um fade por
+ * cima é desenhado com o AllegroRenderer e com o SoftwareRenderer, que é o
+ * backend do jogo quando não há GPU.
+ *
+ * Uso: bin/bench/BenchSceneDraw [quadros] [quadros em software]
+ */
+#include "actors/Bird.hpp"
+#include "actors/Floor.hpp"
+#include "actors/ParallaxBackground.hpp"
+#include "actors/PipePool.hpp"
+#include "actors/effects/TransitionEffect.hpp"
+#include "actors/ui/GameOverScreen.hpp"
+#include "managers/ResourceManager.hpp"
+#include "managers/SceneManager.hpp"
+#include "managers/ScoreManager.hpp"
+#include "render/LayerCache.hpp"
+#include "render/NullRenderer.hpp"
+#include "render/RenderQueue.hpp"
+#include "render/SoftwareRenderer.hpp"
+#include "scenes/CharacterSelectionScene.hpp"
+#include "scenes/RankingScene.hpp"
+#include "scenes/StartMenu.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "util/Theme.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+#include <allegro5/allegro_image.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+    /// Roda draw() frames vezes e mostra o tempo e as chamadas por quadro.
+    template <typename Draw>
+    void measure(const char* name, NullRenderer& renderer, size_t frames, Draw draw)
+    {
+        renderer.reset();
+        BenchTimer timer;
+        for (size_t i = 0; i < frames; ++i) draw();
+        double elapsed = timer.seconds();
+        std::printf("  %-36s %9.1f ns/quadro  %5.1f chamadas/quadro  (checksum %.0f)\n", name,
+                    elapsed * 1e9 / frames, static_cast<double>(renderer.getDrawCalls()) / frames,
+                    renderer.getChecksum());
+    }
+
+    /// Tempo médio por quadro de draw(), em microssegundos, desenhando de verdade no alvo atual.
+    template <typename Draw>
+    double timeFrames(size_t frames, Draw draw)
+    {
+        draw(); // Compõe os caches fora da medida.
+        BenchTimer timer;
+        for (size_t i = 0; i < frames; ++i) draw();
+        return timer.seconds() * 1e6 / frames;
+    }
+
+    /// Mede draw() sem e com os caches de camadas e mostra a economia.
+    template <typename Draw>
+    void compareCaches(const char* name, size_t frames, Draw draw)
+    {
+        LayerCache::setEnabled(false);
+        const double direct = timeFrames(frames, draw);
+        LayerCache::setEnabled(true);
+        const double cached = timeFrames(frames, draw);
+        std::printf("  %-36s %8.1f us/quadro direto  %8.1f us/quadro com cache  (%+.0f%%)\n", name, direct, cached,
+                    (cached - direct) * 100.0 / direct);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t frames = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    size_t softwareFrames = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+
+    // Sem display: os sprites viram bitmaps de memória e o desenho vai para o NullRenderer.
+    if (!al_init() || !al_init_image_addon() || !al_init_font_addon()) {
+        std::fprintf(stderr, "Falha ao inicializar o Allegro.\n");
+        return 1;
+    }
+    al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+    ResourceManager& rm = ResourceManager::getInstance();
+    rm.loadAtlasJson("assets/sprites/sprite_sheet.json", "atlas", "assets/sprites/sprite_sheet.png");
+    rm.loadAtlasJson("assets/sprites/sprite_sheet_ui.json", "atlasUI", "assets/sprites/sprite_sheet_ui.png");
+
+    NullRenderer renderer;
+    Renderer::setCurrent(&renderer);
+    std::printf("draw() das cenas com o NullRenderer (%zu quadros por medida)\n", frames);
+
+    ScoreManager scoreManager;
+    scoreManager.setScore(1234);
+    measure("ScoreManager::draw (1234)", renderer, frames, [&] { scoreManager.draw(); });
+
+    GameOverScreen gameOver(scoreManager);
+    gameOver.startSequence(42, 17);
+    gameOver.update(1.0f); // Fim da entrada do "Game Over"...
+    gameOver.update(1.0f); // ...e do placar: estado final, com medalha e selo "NEW".
+    measure("GameOverScreen::draw (final)", renderer, frames, [&] { gameOver.draw(); });
+
+    SceneManager sceneManager;
+    ALLEGRO_EVENT_QUEUE* queue = al_create_event_queue();
+    sceneManager.setEventQueue(queue);
+    // As cenas registram a fila no WidgetZ, então são destruídas antes dela.
+    {
+        RankingScene ranking(&sceneManager);
+        std::vector<std::pair<std::string, int>> scores;
+        for (int i = 0; i < 20; ++i) scores.emplace_back("JOGADOR" + std::to_string(i), 500 - 17 * i);
+        ranking.setScores(scores);
+        measure("RankingScene::draw (5 linhas)", renderer, frames, [&] { ranking.draw(); });
+
+        StartMenu menu(&sceneManager);
+        measure("StartMenu::draw", renderer, frames, [&] { menu.draw(); });
+
+        CharacterSelectionScene selection(&sceneManager);
+        measure("CharacterSelectionScene::draw", renderer, frames, [&] { selection.draw(); });
+
+        // O cenário da GameScene: fundo, canos, chão e pássaro pela fila de desenho, num estado real.
+        const std::vector<Theme> themes = buildDefaultThemes();
+        const Theme& theme = themes[0];
+        FixedGameSimulation sim;
+        sim.reset(1);
+        for (int tick = 0; tick < 200 && sim.getPhase() != SimPhase::DEAD; ++tick) sim.step(autopilot(sim.getState()));
+        ParallaxBackground background(theme.background, BACKGROUND_SCROLL_SPEED);
+        Floor floor(theme.floor);
+        PipePool pipePool(PIPE_POOL_SIZE);
+        pipePool.syncFrom(sim.getState().course.span(), theme.pipe);
+        Bird bird(BIRD_START_X, BIRD_START_Y, BIRD_WIDTH, BIRD_HEIGHT, theme.bird_frames);
+        const FixedSimState& state = sim.getState();
+        bird.syncPhysics(toFloat(state.birdY), toFloat(state.birdVelY), toFloat(state.birdAngle));
+        RenderQueue renderQueue(BUFFER_W, BUFFER_H);
+        measure("GameScene (fila de desenho)", renderer, frames, [&] {
+            renderQueue.clear();
+            background.submit(renderQueue);
+            pipePool.submit(renderQueue);
+            floor.submit(renderQueue);
+            bird.submit(renderQueue);
+            renderQueue.flush();
+        });
+        std::printf("  fila: %u comandos, %u recortados, %u trocas de textura por quadro\n",
+                    renderQueue.getStats().submitted, renderQueue.getStats().culled,
+                    renderQueue.getStats().textureSwitches);
+
+        // Caminho em software: o AllegroRenderer desenha num quadro de memória do tamanho da tela.
+        // Os caches compostos pelo NullRenderer estão vazios e precisam ser refeitos.
+        Renderer::setCurrent(nullptr);
+        LayerCache::invalidateAll();
+        ALLEGRO_BITMAP* frame = al_create_bitmap(BUFFER_W, BUFFER_H);
+        al_set_target_bitmap(frame);
+        std::printf("\nDesenho em software num bitmap de memória (%zu quadros por medida)\n", softwareFrames);
+        compareCaches("GameScene (fundo, canos, chão, pássaro)", softwareFrames, [&] {
+            renderQueue.clear();
+            background.submit(renderQueue);
+            pipePool.submit(renderQueue);
+            floor.submit(renderQueue);
+            bird.submit(renderQueue);
+            renderQueue.flush();
+        });
+        compareCaches("RankingScene", softwareFrames, [&] { ranking.draw(); });
+        compareCaches("CharacterSelectionScene", softwareFrames, [&] { selection.draw(); });
+
+        // Os atalhos do SoftwareRenderer: canos espelhados, pássaro pré-girado e o fade pela tabela de mistura.
+        TransitionEffect fade(al_map_rgb(0, 0, 0), 1.0f);
+        fade.fadeOut();
+        fade.update(0.5f);
+        auto fadedGame = [&] {
+            renderQueue.clear();
+            background.submit(renderQueue);
+            pipePool.submit(renderQueue);
+            floor.submit(renderQueue);
+            bird.submit(renderQueue);
+            renderQueue.flush();
+            fade.draw();
+        };
+        const double plain = timeFrames(softwareFrames, fadedGame);
+        SoftwareRenderer softwareRenderer;
+        Renderer::setCurrent(&softwareRenderer);
+        const double fast = timeFrames(softwareFrames, fadedGame);
+        Renderer::setCurrent(nullptr);
+        std::printf("  %-36s %8.1f us/quadro AllegroRenderer  %8.1f us/quadro SoftwareRenderer  (%+.0f%%)\n",
+                    "GameScene com fade de 50%", plain, fast, (fast - plain) * 100.0 / plain);
+        const SoftwareRenderer::Stats& stats = softwareRenderer.getStats();
+        const double measured = static_cast<double>(softwareFrames + 1);
+        std::printf("  por quadro: %.1f cópias por trechos, %.1f misturas pela tabela, %.1f repassadas ao Allegro\n",
+                    stats.spanBlits / measured, stats.tableFills / measured, stats.fallbacks / measured);
+        al_destroy_bitmap(frame);
+    }
+
+    al_destroy_event_queue(queue);
+    return 0;
+}
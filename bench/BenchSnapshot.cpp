@@ -0,0 +1,67 @@
+/**
+ * @file BenchSnapshot.cpp
+ * @brief Benchmark dos snapshots da GameSimulation: custo de salvar/restaurar e ramos por segundo.
+ *
+ * Simula o uso de um bot de busca: a partir do estado atual, restaura o mesmo
+ * snapshot muitas vezes e joga cada ramo por alguns passos com pulos aleatórios.
+ *
+ * Uso: bin/bench/BenchSnapshot [segundos]
+ */
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "sim/SimRandom.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+int main(int argc, char** argv)
+{
+    double duration = argc > 1 ? std::atof(argv[1]) : 1.0;
+    const int BRANCH_TICKS = 30; // 1 segundo de jogo por ramo.
+
+    GameSimulation sim;
+    sim.reset(1);
+    for (int t = 0; t < 120; ++t) sim.step(autopilot(sim.getState()));
+    SimState snapshot;
+
+    // Salvar + restaurar isolado.
+    size_t copies = 0;
+    uint64_t sink = 0;
+    BenchTimer timer;
+    do {
+        for (int k = 0; k < 4096; ++k, ++copies) {
+            sim.save(snapshot);
+            sim.restore(snapshot);
+            sink += sim.getTick();
+        }
+    } while (timer.seconds() < duration);
+    double copyNs = timer.seconds() * 1e9 / copies;
+
+    // Ramos: restaura e joga BRANCH_TICKS passos com pulos aleatórios.
+    sim.save(snapshot);
+    size_t stepsTaken = 0;
+    SimRandom rng;
+    rng.seed(5);
+    size_t branches = 0;
+    timer.restart();
+    do {
+        for (int k = 0; k < 256; ++k, ++branches) {
+            sim.restore(snapshot);
+            for (int t = 0; t < BRANCH_TICKS && sim.getPhase() != SimPhase::DEAD; ++t) {
+                sim.step((rng.next() & 7) == 0);
+                ++stepsTaken;
+            }
+            sink += sim.getScore();
+        }
+    } while (timer.seconds() < duration);
+    double branchesPerSecond = branches / timer.seconds();
+
+    std::printf("Snapshot (%zu bytes, %.1f s por medida)\n", sizeof(SimState), duration);
+    std::printf("  salvar + restaurar:              %8.1f ns\n", copyNs);
+    std::printf("  ramos de %d passos por segundo:  %8.3e (%.0f por quadro a %.0f FPS)\n",
+                BRANCH_TICKS, branchesPerSecond, branchesPerSecond / FPS, FPS);
+    std::printf("  passos médios por ramo:          %8.1f\n", static_cast<double>(stepsTaken) / branches);
+    std::printf("  (checksum %llu)\n", static_cast<unsigned long long>(sink));
+    return 0;
+}
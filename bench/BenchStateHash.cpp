@@ -0,0 +1,56 @@
+/**
+ * @file BenchStateHash.cpp
+ * @brief Benchmark do hash do estado: custo por passo de GameSimulation::hash().
+ *
+ * Uso: bin/bench/BenchStateHash [segundos]
+ */
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    double duration = argc > 1 ? std::atof(argv[1]) : 1.0;
+
+    // Grava estados reais de partidas (com 2 ou 3 canos na tela) para medir o hash isolado.
+    std::vector<GameSimulation> states;
+    GameSimulation sim;
+    uint64_t seed = 1;
+    sim.reset(seed);
+    while (states.size() < 4096) {
+        sim.step(autopilot(sim.getState()));
+        if (sim.getPhase() == SimPhase::DEAD) sim.reset(++seed);
+        else states.push_back(sim);
+    }
+
+    uint64_t sink = 0;
+    size_t hashes = 0;
+    BenchTimer timer;
+    do {
+        for (const GameSimulation& s : states) sink ^= s.hash();
+        hashes += states.size();
+    } while (timer.seconds() < duration);
+    double hashNs = timer.seconds() * 1e9 / hashes;
+
+    size_t ticks = 0;
+    sim.reset(seed);
+    timer.restart();
+    do {
+        for (int k = 0; k < 1024; ++k, ++ticks) {
+            sim.step(autopilot(sim.getState()));
+            sink ^= sim.hash();
+            if (sim.getPhase() == SimPhase::DEAD) sim.reset(++seed);
+        }
+    } while (timer.seconds() < duration);
+    double tickNs = timer.seconds() * 1e9 / ticks;
+
+    std::printf("StateHash (%.1f s por medida)\n", duration);
+    std::printf("  hash do estado:        %8.1f ns\n", hashNs);
+    std::printf("  passo + piloto + hash: %8.1f ns\n", tickNs);
+    std::printf("  (checksum %016llx)\n", static_cast<unsigned long long>(sink));
+    return 0;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file BenchSweep.cpp
+ * @brief Benchmark do DifficultySweep: combinações, partidas e passos por segundo de uma varredura.
+ *
+ * Varre vão, velocidade dos canos e gravidade (pontos^3 combinações) com o
+ * autopilot embutido, em todos os núcleos, e estima quanto levaria uma grade
+ * de 10 mil combinações.
+ *
+ * Uso: bin/bench/BenchSweep [pontos_por_eixo] [partidas_por_combinação]
+ */
+#include "env/DifficultySweep.hpp"
+#include "Constants.hpp"
+#include "BenchUtil.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    const int points = argc > 1 ? std::atoi(argv[1]) : 10;
+    const size_t games = argc > 2 ? static_cast<size_t>(std::atoi(argv[2])) : DifficultySweep::DEFAULT_GAMES;
+
+    const std::string n = std::to_string(points);
+    SweepGrid grid = SweepGrid::parse("pipe_gap 110 190 " + n + "\n"
+                                      "pipe_speed 130 230 " + n + "\n"
+                                      "gravity 800 1200 " + n + "\n");
+    DifficultySweep sweep;
+
+    BenchTimer timer;
+    std::vector<SweepResult> results = sweep.run(grid, 1, games);
+    const double elapsed = timer.seconds();
+
+    double gameSeconds = 0.0;
+    const SweepResult* easiest = &results.front();
+    const SweepResult* hardest = &results.front();
+    for (const SweepResult& result : results) {
+        gameSeconds += result.meanSeconds * result.games;
+        if (result.meanScore > easiest->meanScore) easiest = &result;
+        if (result.meanScore < hardest->meanScore) hardest = &result;
+    }
+    const double configsPerSecond = results.size() / elapsed;
+
+    std::printf("DifficultySweep (%zu combinações x %zu partidas de até %u passos, %u threads)\n",
+                results.size(), games, DifficultySweep::DEFAULT_MAX_TICKS, sweep.getThreadCount());
+    std::printf("  tempo:                       %8.2f s\n", elapsed);
+    std::printf("  combinações/s:               %8.1f\n", configsPerSecond);
+    std::printf("  partidas/s:                  %8.3e\n", results.size() * games / elapsed);
+    std::printf("  passos/s:                    %8.3e\n", gameSeconds * FPS / elapsed);
+    std::printf("  estimativa para 10 mil:      %8.1f s\n", 10000.0 / configsPerSecond);
+    std::printf("  mais fácil: vão %.0f, canos %.0f px/s, gravidade %.0f (média %.1f pontos, %.0f%% vivos ao fim)\n",
+                easiest->params.pipeGap, easiest->params.pipeSpeed, easiest->params.gravity,
+                easiest->meanScore, easiest->survival.back() * 100.0f);
+    std::printf("  mais difícil: vão %.0f, canos %.0f px/s, gravidade %.0f (média %.1f pontos, %.0f%% vivos ao fim)\n",
+                hardest->params.pipeGap, hardest->params.pipeSpeed, hardest->params.gravity,
+                hardest->meanScore, hardest->survival.back() * 100.0f);
+    return 0;
+}
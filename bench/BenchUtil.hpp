@@ -0,0 +1,28 @@
+/**
+ * @file BenchUtil.hpp
+ * @brief Cronômetro compartilhado pelos benchmarks.
+ */
+#pragma once
+
+#include <chrono>
+
+/**
+ * @class BenchTimer
+ * @brief Mede o tempo de parede desde a criação ou o último restart().
+ */
+class BenchTimer {
+public:
+    BenchTimer() : start(std::chrono::steady_clock::now()) {}
+
+    /// Zera o cronômetro.
+    void restart() { start = std::chrono::steady_clock::now(); }
+
+    /// Segundos desde o início da medida.
+    double seconds() const
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start;
+};
@@ -0,0 +1,36 @@
+/**
+ * @file ExampleBot.c
+ * @brief Bot de exemplo da ABI flappy_controller_v1, em C puro.
+ *
+ * Pula quando o pássaro está caindo e passou do centro do próximo vão
+ * (deslocado para baixo por uma margem). Não tem estado, então não precisa
+ * de create/destroy.
+ *
+ * Compilação: make bots (gera bin/bots/libExampleBot.so)
+ * Uso:        ./bin/flappy_bird --bot ./bin/bots/libExampleBot.so
+ */
+#include "env/flappy_controller.h"
+
+static int decide(void* instance, const flappy_observation_v1* obs)
+{
+    float target = obs->floor_y / 2.0f;
+    (void)instance;
+    if (obs->pipe_count > 0) {
+        target = (obs->pipes[0].gap_top + obs->pipes[0].gap_bottom) / 2.0f + 20.0f;
+    }
+    return obs->phase == 0 || (obs->bird_y > target && obs->bird_vel_y > 0.0f);
+}
+
+static const flappy_controller_v1 controller = {
+    FLAPPY_CONTROLLER_ABI_VERSION,
+    sizeof(flappy_controller_v1),
+    "ExampleBot",
+    0,
+    0,
+    decide
+};
+
+__attribute__((visibility("default"))) const flappy_controller_v1* flappy_controller_v1_entry(void)
+{
+    return &controller;
+}
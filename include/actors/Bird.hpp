@@ -11,6 +11,8 @@
 #include <vector>
 #include <allegro5/allegro.h>
 
+class RenderQueue;
+
 /**
  * @class Bird
  * @brief Gerencia o estado, a física e a renderização do pássaro do jogo.
@@ -74,6 +76,11 @@ public:
      */
     void draw() const override;
 
+    /**
+     * @brief Envia o pássaro para a fila de desenho, na camada RenderLayer::BIRD.
+     */
+    void submit(RenderQueue& queue) const;
+
     /**
      * @brief Aplica um impulso vertical para fazer o pássaro pular.
      */
@@ -104,4 +111,20 @@ public:
      * @param enable true para ativar, false para desativar.
      */
     void setHoverEnabled(bool enable) { this->hoverEnabled = enable; }
+
+    /**
+     * @brief Copia a física calculada externamente (pela GameSimulation).
+     *
+     * Com a física desativada, o update() do pássaro só anima as asas; posição,
+     * velocidade e ângulo vêm da simulação a cada passo.
+     * @param newY A posição vertical.
+     * @param newVelY A velocidade vertical.
+     * @param newAngle O ângulo em graus.
+     */
+    void syncPhysics(float newY, float newVelY, float newAngle)
+    {
+        this->y = newY;
+        this->velY = newVelY;
+        this->angle = newAngle;
+    }
 };
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "core/GameObject.hpp"
 #include "interfaces/IDrawable.hpp"
 #include "interfaces/IUpdatable.hpp"
+#include "render/LayerCache.hpp"
+
+class RenderQueue;
 
 /**
  * @file Floor.hpp
@@ -19,6 +22,9 @@
  * @details Esta classe herda de GameObject para ter uma posição no mundo do jogo,
  * de IDrawable para ser desenhada na tela a cada quadro, e de IUpdatable para
  * atualizar sua lógica, como o movimento de parallax scrolling.
+ *
+ * As duas cópias da textura são compostas uma vez numa faixa (um LayerCache)
+ * só com as linhas visíveis do chão, desenhada com um único blit por quadro.
  */
 class Floor : public GameObject, public IDrawable, public IUpdatable
 {
@@ -31,6 +37,14 @@ private:
      */
     ALLEGRO_BITMAP* texture;
 
+    /// @brief As duas cópias da textura lado a lado, cortadas na borda de baixo da tela.
+    mutable LayerCache strip;
+
+    /**
+     * @brief A faixa composta, ou nullptr com o cache desligado.
+     */
+    ALLEGRO_BITMAP* getStrip() const;
+
 public:
     /**
      * @brief Construtor da classe Floor.
@@ -46,6 +60,11 @@ public:
      */
     void draw() const override;
 
+    /**
+     * @brief Envia o chão (uma ou duas cópias da textura) para a fila de desenho.
+     */
+    void submit(RenderQueue& queue) const;
+
     /**
      * @brief Atualiza a lógica do chão.
      * @details Este método é uma sobrescrita de IUpdatable::update(). É chamado a cada quadro
@@ -0,0 +1,48 @@
+/**
+ * @file GhostBirds.hpp
+ * @brief Definição de GhostBirds, que desenha os pássaros fantasmas em um único lote.
+ */
+#pragma once
+
+#include "interfaces/IDrawable.hpp"
+#include "interfaces/IUpdatable.hpp"
+#include "sim/GhostTrack.hpp"
+#include <allegro5/allegro.h>
+#include <vector>
+
+class RenderQueue;
+
+/**
+ * @class GhostBirds
+ * @brief Desenha os fantasmas de um GhostTrackSet, semitransparentes, ao lado do pássaro ao vivo.
+ *
+ * Os frames vêm do atlas de sprites, então todos os fantasmas são desenhados
+ * com o desenho de bitmaps retido (al_hold_bitmap_drawing): centenas de
+ * fantasmas viram um único lote para a GPU.
+ */
+class GhostBirds : public IDrawable, public IUpdatable
+{
+private:
+    const GhostTrackSet& tracks;           ///< Posições decodificadas, atualizadas pela GameScene.
+    std::vector<ALLEGRO_BITMAP*> frames;   ///< Frames de animação (do mesmo atlas).
+    ALLEGRO_COLOR tint;                    ///< Cor e transparência dos fantasmas.
+    float frameTime;                       ///< Duração de cada frame de animação.
+    float animationTime;                   ///< Tempo acumulado da animação das asas.
+
+public:
+    /**
+     * @brief Construtor.
+     * @param tracks As trajetórias dos fantasmas.
+     * @param frames Frames de animação do pássaro.
+     * @param alpha Opacidade dos fantasmas (0 a 1).
+     */
+    GhostBirds(const GhostTrackSet& tracks, std::vector<ALLEGRO_BITMAP*> frames, float alpha = 0.35f);
+
+    void update(float deltaTime) override;
+    void draw() const override;
+
+    /**
+     * @brief Envia os fantasmas visíveis para a fila de desenho, na camada RenderLayer::GHOSTS.
+     */
+    void submit(RenderQueue& queue) const;
+};
@@ -7,9 +7,12 @@
 #include "core/GameObject.hpp"
 #include "interfaces/IDrawable.hpp"
 #include "interfaces/IUpdatable.hpp"
+#include "render/LayerCache.hpp"
 #include <allegro5/allegro.h>
 #include "Constants.hpp"
 
+class RenderQueue;
+
 /**
  * @class ParallaxBackground
  * @brief Gerencia um objeto de fundo que se move continuamente para criar um efeito de parallax.
@@ -17,12 +20,22 @@
  * Esta classe desenha uma imagem de fundo duas vezes, lado a lado, e a move
  * para a esquerda. Quando a primeira imagem sai completamente da tela, ela é
  * reposicionada à direita da segunda, criando uma ilusão de rolagem infinita.
+ *
+ * As duas cópias são compostas uma vez numa faixa com o dobro da largura
+ * (um LayerCache), que é copiada sem mistura de cores com um só blit por
+ * quadro: o fundo é opaco e sempre a primeira camada da cena.
  */
 class ParallaxBackground : public GameObject, public IDrawable, public IUpdatable
 {
 private:
     ALLEGRO_BITMAP* texture; ///< Ponteiro para a textura do fundo.
     float speed;             ///< Velocidade de rolagem horizontal em pixels por segundo.
+    mutable LayerCache strip; ///< A textura duas vezes, lado a lado.
+
+    /**
+     * @brief A faixa com as duas cópias, composta na primeira chamada (nullptr com o cache desligado).
+     */
+    ALLEGRO_BITMAP* getStrip() const;
 
 public:
     /**
@@ -43,6 +56,11 @@ public:
      */
     void draw() const override;
 
+    /**
+     * @brief Envia o fundo para a fila de desenho; a cópia fora da tela é recortada pela fila.
+     */
+    void submit(RenderQueue& queue) const;
+
     /**
      * @brief Define uma nova velocidade de rolagem para o fundo.
      * @param newSpeed A nova velocidade.
@@ -7,6 +7,8 @@
 #include "core/GameObject.hpp" // Herda para obter y, width, height
 #include <allegro5/allegro.h>
 
+class RenderQueue;
+
 /**
  * @enum PipeType
  * @brief Enumera os tipos de cano para diferenciação na renderização.
@@ -46,4 +48,11 @@ public:
      * @param x A coordenada X onde o cano deve ser desenhado.
      */
     void draw(float x) const;
+
+    /**
+     * @brief Envia o cano para a fila de desenho na posição X fornecida.
+     * @details O cano superior é o sprite espelhado nos dois eixos, que é o
+     * mesmo que girá-lo 180° como em draw(), mas sem rotação.
+     */
+    void submit(RenderQueue& queue, float x) const;
 };
\ No newline at end of file
@@ -11,6 +11,7 @@
 
 // Forward declaration para evitar dependência circular se Bird incluir PipePair
 class Bird; 
+class RenderQueue;
 
 /**
  * @class PipePair
@@ -61,6 +62,11 @@ public:
      * @brief Desenha o par de canos na tela. (Contrato de IDrawable)
      */
     void draw() const override;
+
+    /**
+     * @brief Envia os dois canos para a fila de desenho, se o par estiver ativo.
+     */
+    void submit(RenderQueue& queue) const;
     
     // --- Lógica de Jogo ---
 
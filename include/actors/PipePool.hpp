@@ -10,6 +10,7 @@
 #include <vector>
 #include <memory>
 #include "actors/PipePair.hpp"
+#include "sim/PipeCourse.hpp"
 
 /**
  * @brief Gerencia um pool de objetos PipePair reutilizáveis para otimizar a performance.
@@ -35,6 +36,19 @@ public:
         return reinterpret_cast<std::vector<PipePair*>&>(pool);
      }
 
+    /**
+     * @brief Reposiciona os canos do pool para espelhar um percurso simulado.
+     *
+     * Usado pelas cenas em que a simulação move e gera os canos e o pool só os
+     * desenha. O i-ésimo cano ativo recebe a posição e o vão do i-ésimo cano do
+     * percurso, no lugar: nenhum par é resetado ou procurado no pool a cada passo,
+     * só quando o percurso ganha ou perde canos.
+     *
+     * @param pipes Os canos da simulação (Q16.16), ordenados por X.
+     * @param pipeTexture Textura dos canos.
+     */
+    void syncFrom(const FixedPipeSpan& pipes, ALLEGRO_BITMAP* pipeTexture);
+
     /**
      * @brief Atualiza todos os PipePairs do pool.
      * @param deltaTime Tempo decorrido desde a última atualização.
@@ -46,6 +60,11 @@ public:
      */
     void draw() const override;
 
+    /**
+     * @brief Envia só os canos ativos para a fila de desenho (os fora da tela são recortados pela fila).
+     */
+    void submit(RenderQueue& queue) const;
+
     /**
      * @brief Reseta todos os PipePairs para o estado inicial.
      */
@@ -53,4 +72,5 @@ public:
 
 private:
     std::vector<std::unique_ptr<PipePair>> pool; ///< Vetor de ponteiros únicos para PipePair.
+    std::vector<PipePair*> activeInOrder;        ///< Canos ativos em ordem de X: os de getPipe() (expirados em update()) ou os espelhados por syncFrom().
 };
@@ -10,6 +10,7 @@
 #include "interfaces/IDrawable.hpp"
 #include "interfaces/IUpdatable.hpp"
 #include "managers/ScoreManager.hpp"
+#include "render/LayerCache.hpp"
 #include <allegro5/allegro.h>
 
 /**
@@ -58,11 +59,19 @@ private:
     int bestScore;
     bool newBestScore = false; ///< Flag que aponta se o novo score é o maior
 
+    /// Placar completo (painel, medalha, selo e números), composto uma vez por startSequence().
+    mutable LayerCache boardLayer;
+
     /**
      * @brief Define qual medalha deve ser exibida com base na pontuação.
      */
     void determineMedal();
 
+    /**
+     * @brief Desenha o placar completo com o canto superior esquerdo em (boardX, boardY).
+     */
+    void drawBoard(float boardX, float boardY) const;
+
 public:
     /**
      * @brief Construtor da GameOverScreen.
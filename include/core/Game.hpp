@@ -7,6 +7,10 @@
 #pragma once
 
 #include "managers/SceneManager.hpp"
+#include "core/LaunchOptions.hpp"
+#include "render/FrameCapture.hpp"
+#include "render/ScreenTarget.hpp"
+#include "render/SoftwareRenderer.hpp"
 #include <allegro5/allegro.h>
 #include <memory>
 
@@ -25,6 +29,9 @@ private:
     ALLEGRO_DISPLAY* display;
     ALLEGRO_TIMER* timer;
     ALLEGRO_EVENT_QUEUE* queue;
+    std::unique_ptr<ScreenTarget> screen; ///< Quadro de BUFFER_W x BUFFER_H em que as cenas desenham.
+    std::unique_ptr<SoftwareRenderer> softwareRenderer; ///< Em uso quando o quadro é um bitmap de memória.
+    std::unique_ptr<FrameCapture> capture; ///< Gravação dos quadros (--capture); nullptr desliga.
 
     // --- Gerenciadores ---
     SceneManager sceneManager;
@@ -32,6 +39,9 @@ private:
     // --- Controle do Loop ---
     bool isRunning;
 
+    // --- Configuração ---
+    LaunchOptions options; ///< Opções da linha de comando (ex.: --versus).
+
     /**
      * @brief Inicializa todos os componentes do Allegro e recursos do jogo.
      */
@@ -50,10 +60,15 @@ private:
     void update(float deltaTime);
 
     /**
-     * @brief Desenha o frame atual na tela.
+     * @brief Desenha o frame atual no quadro fora da tela e o apresenta na janela.
      */
     void draw();
 
+    /**
+     * @brief Alterna entre janela e tela cheia (F11).
+     */
+    void toggleFullscreen();
+
     /**
      * @brief Realiza a limpeza de todos os recursos alocados.
      */
@@ -64,8 +79,9 @@ public:
      * @brief Construtor da classe Game.
      *
      * Chama o método de inicialização para configurar a aplicação.
+     * @param options Opções da linha de comando; sem opções o jogo abre no menu inicial.
      */
-    Game();
+    explicit Game(const LaunchOptions& options = LaunchOptions());
 
     /**
      * @brief Destrutor da classe Game.
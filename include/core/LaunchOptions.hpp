@@ -0,0 +1,75 @@
+/**
+ * @file LaunchOptions.hpp
+ * @brief Opções de linha de comando do executável.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct VersusOptions
+ * @brief Configuração do modo versus em rede (--versus).
+ */
+struct VersusOptions {
+    bool enabled = false;       ///< Se o jogo deve abrir direto na partida versus.
+    int player = 0;             ///< Índice do jogador local (0 ou 1); os dois lados usam índices diferentes.
+    uint16_t localPort = 0;     ///< Porta UDP local.
+    std::string remoteHost;     ///< Endereço do outro jogador.
+    uint16_t remotePort = 0;    ///< Porta UDP do outro jogador.
+    uint64_t seed = 1;          ///< Semente do percurso (a mesma nos dois lados).
+    float latencyMs = 0.0f;     ///< Atraso artificial dos pacotes enviados.
+    float jitterMs = 0.0f;      ///< Variação artificial do atraso.
+    float lossPercent = 0.0f;   ///< Porcentagem artificial de pacotes perdidos.
+};
+
+/**
+ * @struct BotOptions
+ * @brief Bot carregado de uma biblioteca compartilhada (--bot) e partidas sem janela (--headless).
+ */
+struct BotOptions {
+    std::string path;           ///< Caminho do .so do bot; vazio desliga.
+    size_t headlessGames = 0;   ///< Partidas sem janela a jogar; 0 abre o jogo normalmente.
+    unsigned threads = 0;       ///< Threads das partidas sem janela (0 = todos os núcleos).
+};
+
+/**
+ * @struct SweepOptions
+ * @brief Varredura de parâmetros de dificuldade sem janela (--sweep).
+ */
+struct SweepOptions {
+    std::string gridPath;          ///< Arquivo com a grade (ver SweepGrid); vazio desliga.
+    size_t games = 64;             ///< Partidas por combinação.
+    float seconds = 60.0f;         ///< Limite de tempo de jogo por partida.
+    std::string outputPath = "sweep.csv"; ///< CSV com um resumo por combinação.
+};
+
+/**
+ * @struct LaunchOptions
+ * @brief Tudo o que pode ser configurado pela linha de comando.
+ *
+ * Sem argumentos o jogo abre no menu inicial, como sempre.
+ */
+struct LaunchOptions {
+    VersusOptions versus;
+    BotOptions bot;
+    SweepOptions sweep;
+    std::vector<std::string> verify; ///< Replays (arquivos ou pastas) a conferir sem janela; vazio desliga.
+    std::string broadcast;  ///< Endereço para transmitir a partida ("porta" ou "unix:caminho"); vazio desliga.
+    std::string spectate;   ///< Transmissão a assistir ("host:porta" ou "unix:caminho"); vazio desliga.
+    bool software = false;  ///< Desenha em bitmaps de memória, como nas máquinas sem GPU.
+    std::string capture;    ///< Arquivo em que a sessão é gravada (.y4m ou RGBA cru); vazio desliga.
+
+    /**
+     * @brief Interpreta os argumentos de main().
+     * @throw std::invalid_argument se um argumento for desconhecido ou inválido.
+     */
+    static LaunchOptions parse(int argc, const char* const* argv);
+
+    /**
+     * @brief Texto de ajuda com a sintaxe aceita.
+     */
+    static const char* usage();
+};
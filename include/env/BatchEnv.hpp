@@ -0,0 +1,117 @@
+/**
+ * @file BatchEnv.hpp
+ * @brief Definição do BatchEnv, a API de ambientes em lote (estilo Gym) da libflappy_env.
+ */
+#pragma once
+
+#include "sim/GameSimulation.hpp"
+#include "sim/ParallelRunner.hpp"
+#include "env/PixelRenderer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Índices de cada valor dentro de uma observação de BatchEnv::OBS_SIZE floats.
+ * @details Posições são divididas pelo tamanho da tela (BUFFER_W ou BUFFER_H) e a
+ * velocidade pela velocidade terminal, ficando aproximadamente em [-1, 1].
+ * "Distância" é da borda esquerda do pássaro até a borda direita do cano.
+ * Se não houver cano, a distância é 1 e o vão ocupa toda a área jogável.
+ */
+enum EnvObservation : int {
+    OBS_BIRD_Y = 0,      ///< Topo do pássaro / BUFFER_H.
+    OBS_BIRD_VEL_Y,      ///< Velocidade vertical / TERMINAL_VELOCITY.
+    OBS_PIPE_DISTANCE,   ///< Distância até o próximo cano / BUFFER_W.
+    OBS_PIPE_GAP_TOP,    ///< Início do vão do próximo cano / BUFFER_H.
+    OBS_PIPE_GAP_BOTTOM, ///< Fim do vão do próximo cano / BUFFER_H.
+    OBS_NEXT_DISTANCE,   ///< Distância até o cano seguinte / BUFFER_W.
+    OBS_NEXT_GAP_TOP,    ///< Início do vão do cano seguinte / BUFFER_H.
+    OBS_NEXT_GAP_BOTTOM, ///< Fim do vão do cano seguinte / BUFFER_H.
+    OBS_COUNT
+};
+
+/**
+ * @class BatchEnv
+ * @brief Um lote de partidas independentes, avançadas juntas com uma ação por partida.
+ *
+ * Cada partida é uma GameSimulation (a mesma física do Bird e dos canos, com os
+ * parâmetros de Constants.hpp), sem janela nem áudio. Observações, recompensas
+ * e fins de episódio são escritos direto em buffers contíguos do chamador, sem
+ * cópias intermediárias nem alocação por passo; o lote é dividido entre núcleos
+ * por um ParallelRunner.
+ *
+ * Um episódio começa já com o primeiro pulo (a fase READY não aparece para o
+ * agente) e termina quando o pássaro colide. Como nos vetores de ambientes do
+ * Gym, a partida que termina é reiniciada no mesmo passo com a próxima semente:
+ * a observação devolvida junto com done = 1 já é a do novo episódio.
+ *
+ * O resultado não depende do número de threads: a partida i do episódio k usa
+ * sempre a semente seed + i + k * size().
+ */
+class BatchEnv {
+public:
+    static constexpr int OBS_SIZE = OBS_COUNT;    ///< Floats por observação.
+    static constexpr float REWARD_ALIVE = 0.1f;   ///< Recompensa por passo sobrevivido.
+    static constexpr float REWARD_PIPE = 1.0f;    ///< Recompensa por cano ultrapassado.
+    static constexpr float REWARD_DEATH = -1.0f;  ///< Recompensa do passo da colisão.
+
+    /**
+     * @brief Cria o lote.
+     * @param size Número de partidas.
+     * @param threads Threads usadas por step() (0 = todos os núcleos).
+     */
+    explicit BatchEnv(size_t size, unsigned threads = 0);
+
+    /**
+     * @brief Reinicia todas as partidas.
+     * @param seed Semente base; a partida i usa seed + i.
+     * @param observations Destino de size() * OBS_SIZE floats (ou nullptr).
+     */
+    void reset(uint64_t seed, float* observations);
+
+    /**
+     * @brief Avança todas as partidas um passo.
+     * @param actions Um byte por partida; diferente de zero pula (nullptr = ninguém pula).
+     * @param observations Destino de size() * OBS_SIZE floats (ou nullptr).
+     * @param rewards Destino de size() floats (ou nullptr).
+     * @param dones Destino de size() bytes: 1 se o episódio terminou neste passo (ou nullptr).
+     */
+    void step(const uint8_t* actions, float* observations, float* rewards, uint8_t* dones);
+
+    /**
+     * @brief Desenha todas as partidas (observações em pixels), divididas entre as threads.
+     * @param renderer O renderizador em software.
+     * @param format O formato de cada quadro.
+     * @param frames Destino de size() * PixelRenderer::frameBytes(format) bytes, quadro a quadro.
+     */
+    void render(const PixelRenderer& renderer, PixelFormat format, uint8_t* frames);
+
+    /**
+     * @brief Escreve a observação de um estado (OBS_SIZE floats).
+     * @param state O estado da partida.
+     * @param out Destino da observação.
+     */
+    static void observe(const SimState& state, float* out);
+
+    // --- Getters ---
+    size_t size() const { return simulations.size(); }
+    unsigned getThreadCount() const { return runner.getThreadCount(); }
+    const SimState& getState(size_t i) const { return simulations[i].getState(); }
+    uint64_t getEpisodeSeed(size_t i) const { return seeds[i]; }
+
+private:
+    std::vector<GameSimulation> simulations;
+    std::vector<uint64_t> seeds; ///< Semente do episódio atual de cada partida.
+    ParallelRunner runner;
+
+    /**
+     * @brief Reinicia uma partida com a semente dada e aplica o primeiro pulo.
+     */
+    void startEpisode(size_t i, uint64_t seed);
+
+    /**
+     * @brief Avança as partidas [begin, end); chamado por cada thread.
+     */
+    void stepRange(size_t begin, size_t end, const uint8_t* actions,
+                   float* observations, float* rewards, uint8_t* dones);
+};
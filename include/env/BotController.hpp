@@ -0,0 +1,90 @@
+/**
+ * @file BotController.hpp
+ * @brief Carregamento de bots (flappy_controller_v1) e adaptação para a GameSimulation.
+ */
+#pragma once
+
+#include "env/flappy_controller.h"
+#include "sim/GameSimulation.hpp"
+#include <cstdint>
+#include <string>
+
+/**
+ * @class BotLibrary
+ * @brief Uma biblioteca compartilhada de bot aberta com dlopen.
+ *
+ * A biblioteca fica carregada enquanto o objeto existir; os BotController
+ * criados a partir dela não podem viver mais que ele.
+ */
+class BotLibrary {
+public:
+    /**
+     * @brief Abre a biblioteca e valida a tabela do bot.
+     * @param path Caminho do .so (com "/" para não procurar nos diretórios do sistema).
+     * @throw std::runtime_error se a biblioteca não abrir, não exportar
+     * FLAPPY_CONTROLLER_V1_ENTRY_NAME ou usar outra versão da ABI.
+     */
+    explicit BotLibrary(const std::string& path);
+    ~BotLibrary();
+
+    BotLibrary(const BotLibrary&) = delete;
+    BotLibrary& operator=(const BotLibrary&) = delete;
+
+    /**
+     * @brief Valida uma tabela de bot (também usada por bots ligados estaticamente).
+     * @throw std::runtime_error se a tabela for nula, de outra versão ou incompleta.
+     */
+    static void validate(const flappy_controller_v1* controller);
+
+    // --- Getters ---
+    const flappy_controller_v1* getController() const { return controller; }
+    const std::string& getPath() const { return path; }
+
+private:
+    std::string path;
+    void* handle;
+    const flappy_controller_v1* controller;
+};
+
+/**
+ * @class BotController
+ * @brief A instância de um bot em uma partida.
+ *
+ * A observação fica em um membro reaproveitado a cada passo, então decide()
+ * não aloca; o bot recebe só um ponteiro para ela. Aceita estados em float
+ * (BotRunner, DifficultySweep) e em Q16.16 (GameScene); a ABI é sempre float.
+ */
+class BotController {
+public:
+    /**
+     * @brief Cria a instância do bot para uma partida.
+     * @param controller A tabela do bot (ver BotLibrary::validate).
+     * @param seed A semente do percurso da partida.
+     */
+    BotController(const flappy_controller_v1* controller, uint64_t seed);
+    ~BotController();
+
+    BotController(const BotController&) = delete;
+    BotController& operator=(const BotController&) = delete;
+
+    /**
+     * @brief Pergunta ao bot se deve pular neste passo.
+     * @param state O estado da partida antes do passo.
+     * @return true para pular.
+     */
+    template <typename Scalar>
+    bool decide(const BasicSimState<Scalar>& state);
+
+    /**
+     * @brief Preenche a observação da ABI a partir de um estado da simulação.
+     * @param state O estado da partida.
+     * @param out Destino da observação.
+     */
+    template <typename Scalar>
+    static void observe(const BasicSimState<Scalar>& state, flappy_observation_v1& out);
+
+private:
+    const flappy_controller_v1* controller;
+    void* instance;
+    flappy_observation_v1 observation;
+};
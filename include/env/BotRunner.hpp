@@ -0,0 +1,63 @@
+/**
+ * @file BotRunner.hpp
+ * @brief Definição do BotRunner, que joga muitas partidas de um bot sem janela e em paralelo.
+ */
+#pragma once
+
+#include "env/flappy_controller.h"
+#include "sim/ParallelRunner.hpp"
+#include "Constants.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct BotGameResult
+ * @brief Resultado de uma partida jogada por um bot.
+ */
+struct BotGameResult {
+    uint64_t seed;  ///< Semente do percurso.
+    int32_t score;  ///< Canos ultrapassados.
+    uint32_t ticks; ///< Passos jogados.
+    bool died;      ///< false se a partida foi interrompida no limite de passos.
+};
+
+/**
+ * @class BotRunner
+ * @brief Joga partidas independentes de um bot, divididas entre os núcleos.
+ *
+ * Cada partida é uma GameSimulation com a sua própria instância do bot. O
+ * resultado de cada semente não depende do número de threads (desde que o bot
+ * seja determinístico).
+ */
+class BotRunner {
+public:
+    static constexpr uint32_t DEFAULT_MAX_TICKS = 10 * 60 * static_cast<uint32_t>(FPS); ///< 10 minutos de jogo.
+
+    /**
+     * @brief Prepara o runner.
+     * @param controller A tabela do bot (ver BotLibrary::validate).
+     * @param threads Número de threads (0 = todos os núcleos).
+     */
+    explicit BotRunner(const flappy_controller_v1* controller, unsigned threads = 0);
+
+    /**
+     * @brief Joga uma partida por semente, de firstSeed a firstSeed + games - 1.
+     * @param firstSeed Semente da primeira partida.
+     * @param games Número de partidas.
+     * @param maxTicks Limite de passos por partida (bots perfeitos nunca morrem).
+     * @return Os resultados, na ordem das sementes.
+     */
+    std::vector<BotGameResult> run(uint64_t firstSeed, size_t games, uint32_t maxTicks = DEFAULT_MAX_TICKS);
+
+    /**
+     * @brief Joga uma única partida na thread atual.
+     */
+    static BotGameResult play(const flappy_controller_v1* controller, uint64_t seed, uint32_t maxTicks);
+
+    unsigned getThreadCount() const { return runner.getThreadCount(); }
+
+private:
+    const flappy_controller_v1* controller;
+    ParallelRunner runner;
+};
@@ -0,0 +1,182 @@
+/**
+ * @file DifficultySweep.hpp
+ * @brief Definição do DifficultySweep, que joga muitas partidas para cada combinação de parâmetros de dificuldade.
+ */
+#pragma once
+
+#include "env/BotRunner.hpp"
+#include "env/flappy_controller.h"
+#include "sim/GameSimulation.hpp"
+#include "sim/ParallelRunner.hpp"
+#include "sim/SimParams.hpp"
+#include "Constants.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class SweepGrid
+ * @brief Grade de parâmetros: o produto cartesiano dos valores de cada eixo.
+ *
+ * No formato texto cada linha define um eixo, com um valor fixo ou um
+ * intervalo de pontos igualmente espaçados (linhas vazias e '#' são ignorados):
+ *
+ *     pipe_gap 110 170 13      # início, fim e número de pontos
+ *     gravity 1000             # valor fixo
+ *
+ * Os parâmetros são os de SimParams: gravity, jump_velocity, terminal_velocity,
+ * pipe_speed, pipe_gap e pipe_interval. Os que não aparecem ficam no padrão.
+ */
+class SweepGrid {
+public:
+    static constexpr int PARAMETER_COUNT = 6; ///< Campos de SimParams que podem variar.
+
+    /**
+     * @brief Interpreta a grade no formato texto.
+     * @throw std::runtime_error se um parâmetro for desconhecido, repetido ou inválido.
+     */
+    static SweepGrid parse(const std::string& text);
+
+    /**
+     * @brief Lê a grade de um arquivo (ver parse()).
+     * @throw std::runtime_error se o arquivo não puder ser lido ou for inválido.
+     */
+    static SweepGrid load(const std::string& path);
+
+    /**
+     * @brief Define os valores de um parâmetro, substituindo os anteriores.
+     * @throw std::runtime_error se o nome for desconhecido, a lista for vazia ou um valor for inválido.
+     */
+    void setAxis(const std::string& name, const std::vector<float>& values);
+
+    /**
+     * @brief Número de combinações (o produto do tamanho dos eixos).
+     */
+    size_t size() const;
+
+    /**
+     * @brief Retorna a combinação de índice index, em [0, size()).
+     * @details O último eixo definido varia mais rápido.
+     */
+    SimParams at(size_t index) const;
+
+    /**
+     * @brief Nome do i-ésimo parâmetro, na ordem das colunas do CSV.
+     */
+    static const char* parameterName(int i);
+
+    /**
+     * @brief Valor do i-ésimo parâmetro de uma combinação.
+     */
+    static float parameterValue(const SimParams& params, int i);
+
+private:
+    /// Um eixo da grade: o índice do parâmetro e os seus valores.
+    struct Axis {
+        int parameter;
+        std::vector<float> values;
+    };
+
+    std::vector<Axis> axes;
+};
+
+/**
+ * @struct SweepResult
+ * @brief Resumo das partidas de uma combinação de parâmetros.
+ */
+struct SweepResult {
+    static constexpr int SURVIVAL_POINTS = 10; ///< Marcos da curva de sobrevivência (décimos do limite de passos).
+    static constexpr int SCORE_BUCKETS = 12;   ///< Faixas do histograma: 0, 1, 2-3, 4-7, ..., 1024 ou mais.
+
+    SimParams params;     ///< A combinação jogada.
+    uint32_t games;       ///< Partidas jogadas.
+    double meanScore;     ///< Pontuação média.
+    int32_t medianScore;  ///< Pontuação mediana.
+    int32_t p90Score;     ///< Pontuação que 90% das partidas não superam.
+    int32_t maxScore;     ///< Melhor pontuação.
+    double meanSeconds;   ///< Tempo médio de sobrevivência, em segundos de jogo.
+    std::array<float, SURVIVAL_POINTS> survival;       ///< Fração de partidas vivas ao fim de cada décimo do limite.
+    std::array<uint32_t, SCORE_BUCKETS> scoreHistogram; ///< Partidas em cada faixa de pontuação.
+
+    /**
+     * @brief Faixa do histograma de uma pontuação.
+     */
+    static int bucketOf(int32_t score);
+};
+
+/**
+ * @class DifficultySweep
+ * @brief Joga as mesmas sementes em cada combinação de uma SweepGrid, em paralelo.
+ *
+ * Cada combinação usa as sementes firstSeed .. firstSeed + games - 1, então as
+ * diferenças entre combinações vêm dos parâmetros e não da sorte do percurso.
+ * As partidas (combinação, semente) são divididas entre os núcleos em blocos,
+ * o que mantém todas as threads ocupadas tanto em grades com muitas
+ * combinações quanto em poucas combinações com muitas partidas.
+ *
+ * Quem joga é um bot da ABI flappy_controller_v1 ou, sem bot, o autopilot()
+ * embutido, que se adapta à física de cada combinação.
+ */
+class DifficultySweep {
+public:
+    static constexpr size_t DEFAULT_GAMES = 64;                                   ///< Partidas por combinação.
+    static constexpr uint32_t DEFAULT_MAX_TICKS = 60 * static_cast<uint32_t>(FPS); ///< 1 minuto de jogo por partida.
+
+    /**
+     * @brief Prepara a varredura.
+     * @param controller O bot que joga (nullptr usa o autopilot()).
+     * @param threads Número de threads (0 = todos os núcleos).
+     */
+    explicit DifficultySweep(const flappy_controller_v1* controller = nullptr, unsigned threads = 0);
+
+    /**
+     * @brief Joga todas as combinações da grade.
+     * @param grid A grade de parâmetros.
+     * @param firstSeed Semente da primeira partida de cada combinação.
+     * @param games Partidas por combinação.
+     * @param maxTicks Limite de passos por partida.
+     * @return Um resumo por combinação, na ordem de SweepGrid::at().
+     */
+    std::vector<SweepResult> run(const SweepGrid& grid, uint64_t firstSeed, size_t games = DEFAULT_GAMES,
+                                 uint32_t maxTicks = DEFAULT_MAX_TICKS);
+
+    /**
+     * @brief Joga uma única partida na thread atual.
+     * @param controller O bot (nullptr usa o autopilot()).
+     */
+    static BotGameResult play(const flappy_controller_v1* controller, const SimParams& params,
+                              uint64_t seed, uint32_t maxTicks);
+
+    /**
+     * @brief Piloto embutido: pula quando o pássaro está abaixo do ponto mais baixo seguro do próximo vão.
+     * @details É um jogador de reflexo, sem busca (algumas dezenas de nanossegundos
+     * por decisão), e não um jogador perfeito: as curvas medem a dificuldade
+     * relativa entre combinações. A folga considera a queda de um passo na
+     * velocidade terminal e o novo pulo depende da velocidade do pulo, então o
+     * piloto continua razoável com outra gravidade, outro pulo ou outro vão.
+     */
+    static bool autopilot(const SimState& state, const SimParams& params);
+
+    /**
+     * @brief Escreve os resultados em CSV: parâmetros, estatísticas, curva de sobrevivência e histograma.
+     */
+    static void writeCsv(std::ostream& out, const std::vector<SweepResult>& results);
+
+    unsigned getThreadCount() const { return runner.getThreadCount(); }
+
+private:
+    static constexpr float AUTOPILOT_LEAD = 10.0f;  ///< Pixels antes do fim do cano em que o autopilot já mira o próximo.
+    static constexpr float AUTOPILOT_REJUMP = 0.3f; ///< Fração da velocidade do pulo abaixo da qual o autopilot pode pular de novo.
+
+    const flappy_controller_v1* controller;
+    ParallelRunner runner;
+
+    /**
+     * @brief Resume as partidas de uma combinação.
+     * @param games Os resultados das partidas (reordenados para calcular os percentis).
+     */
+    static SweepResult summarize(const SimParams& params, BotGameResult* games, size_t count, uint32_t maxTicks);
+};
@@ -0,0 +1,164 @@
+/**
+ * @file PixelRenderer.hpp
+ * @brief Definição do PixelRenderer, que desenha a partida em memória do chamador, sem GPU.
+ */
+#pragma once
+
+#include "env/SpriteAtlas.hpp"
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum PixelFormat
+ * @brief Formato das observações em pixels.
+ */
+enum class PixelFormat {
+    RGB,    ///< BUFFER_W x BUFFER_H, 3 bytes por pixel (R, G, B), linha a linha.
+    GRAY_84 ///< 84 x 84 em tons de cinza, 1 byte por pixel (como nos agentes de Atari).
+};
+
+/**
+ * @struct PixelTheme
+ * @brief Nomes dos sprites do atlas usados no desenho (por padrão, o tema "Amarelo").
+ */
+struct PixelTheme {
+    std::string birdFrames[3] = {"yellowbird-downflap", "yellowbird-midflap", "yellowbird-upflap"};
+    std::string background = "background-day";
+    std::string floor = "base";
+    std::string pipe = "pipe-green";
+};
+
+/**
+ * @struct PixelSpan
+ * @brief Trecho de uma linha de sprite com pixels visíveis.
+ */
+struct PixelSpan {
+    uint16_t x;      ///< Primeira coluna do trecho.
+    uint16_t length; ///< Número de pixels.
+    uint8_t opaque;  ///< 1 se todos os pixels são opacos (copiados com memcpy).
+};
+
+/**
+ * @struct PixelSprite
+ * @brief Um sprite pré-processado linha a linha para o formato de saída.
+ *
+ * Os pixels já estão convertidos (RGB ou cinza) e cada linha foi reduzida a
+ * trechos visíveis: pixels transparentes nunca são visitados e trechos opacos
+ * são copiados inteiros; só as bordas semitransparentes são misturadas.
+ *
+ * @tparam Pixel RgbPixel ou uint8_t.
+ */
+template <typename Pixel>
+struct PixelSprite {
+    int width = 0;
+    int height = 0;
+    std::vector<Pixel> pixels;       ///< width * height pixels convertidos.
+    std::vector<uint8_t> alpha;      ///< Alfa de cada pixel.
+    std::vector<PixelSpan> spans;    ///< Trechos visíveis de todas as linhas.
+    std::vector<uint32_t> rowSpans;  ///< Linha y usa spans[rowSpans[y], rowSpans[y + 1]).
+};
+
+/// Um pixel RGB de 3 bytes, o formato de PixelFormat::RGB.
+struct RgbPixel {
+    uint8_t r, g, b;
+};
+
+/**
+ * @struct PhasedSprite
+ * @brief Um sprite reduzido por um fator inteiro, em cada posição possível dentro de um pixel reduzido.
+ *
+ * A versão (x, y) é o sprite deslocado x colunas e y linhas da imagem cheia
+ * antes da redução, para ele cair no quadro reduzido onde cairia na imagem
+ * cheia. Sem redução (fator 1), há uma única versão.
+ */
+template <typename Pixel>
+struct PhasedSprite {
+    int width = 0;                         ///< Largura na imagem cheia.
+    int height = 0;                        ///< Altura na imagem cheia.
+    std::vector<PixelSprite<Pixel>> phases;///< Versão (x, y) no índice y * fator + x.
+};
+
+/**
+ * @struct PixelLayers
+ * @brief Todos os sprites de uma partida, pré-processados para um formato.
+ */
+template <typename Pixel>
+struct PixelLayers {
+    int scale = 1;                    ///< Os sprites e o quadro ficam reduzidos por esse fator inteiro.
+    PhasedSprite<Pixel> background;   ///< Duas cópias, a BUFFER_W pixels de distância (rolam juntas).
+    PhasedSprite<Pixel> floor;        ///< Duas cópias, a BUFFER_W pixels de distância (rolam juntas).
+    PhasedSprite<Pixel> pipe;         ///< Cano inferior.
+    PhasedSprite<Pixel> pipeFlipped;  ///< Cano superior (girado 180°, como em Pipe::draw).
+    std::vector<PhasedSprite<Pixel>> bird; ///< frame * BIRD_ANGLES + (ângulo - MIN_ANGLE).
+};
+
+/**
+ * @class PixelRenderer
+ * @brief Renderizador em software da cena de jogo (fundo, canos, chão e pássaro), sem HUD.
+ *
+ * Não usa display nem GPU: os sprites do atlas são convertidos uma única vez no
+ * construtor, incluindo o pássaro já girado em cada grau de -60° a 60°, e cada
+ * quadro é montado com cópias de linhas. Para a saída 84x84, os sprites em
+ * cinza já são reduzidos à metade no construtor (médias de blocos 2x2, uma
+ * versão para cada deslocamento de meio pixel): o quadro é montado em 144x256,
+ * um quarto dos pixels, e depois reduzido a 84x84 por médias dos mesmos blocos
+ * da imagem cheia, com limites inteiros pré-calculados (um pixel reduzido
+ * cortado pelo limite conta pela metade).
+ *
+ * O fundo e o chão rolam com o tempo da partida (tick), nas mesmas velocidades
+ * de ParallaxBackground e Floor. render() pode ser chamado por várias threads
+ * ao mesmo tempo.
+ */
+class PixelRenderer {
+public:
+    static constexpr int GRAY_SIZE = 84;   ///< Lado da observação PixelFormat::GRAY_84.
+    static constexpr int GRAY_SCALE = 2;   ///< Redução inteira do quadro em cinza antes das médias para 84x84.
+    static constexpr int GRAY_CANVAS_W = BUFFER_W / GRAY_SCALE;
+    static constexpr int GRAY_CANVAS_H = BUFFER_H / GRAY_SCALE;
+    static constexpr int MIN_ANGLE = -60;  ///< Menor ângulo pré-girado do pássaro, em graus.
+    static constexpr int BIRD_ANGLES = 121;///< Ângulos pré-girados (um por grau).
+
+    /**
+     * @brief Pré-processa os sprites do tema.
+     * @param atlas O atlas com os sprites.
+     * @param theme Os nomes dos sprites.
+     * @throw std::runtime_error se algum sprite não existir no atlas.
+     */
+    explicit PixelRenderer(const SpriteAtlas& atlas, const PixelTheme& theme = PixelTheme());
+
+    /**
+     * @brief Retorna quantos bytes um quadro ocupa no formato.
+     */
+    static size_t frameBytes(PixelFormat format);
+
+    /**
+     * @brief Desenha um estado da partida.
+     * @param state O estado.
+     * @param format O formato de saída.
+     * @param out Destino de frameBytes(format) bytes, do chamador.
+     */
+    void render(const SimState& state, PixelFormat format, uint8_t* out) const;
+
+private:
+    PixelLayers<RgbPixel> rgb;
+    PixelLayers<uint8_t> gray;
+    static constexpr int MIN_BLOCK_ROWS = BUFFER_H / GRAY_SIZE; ///< Blocos têm essa altura ou uma linha a mais.
+    static constexpr int MAX_BLOCK_COLUMNS = (BUFFER_W + GRAY_SIZE - 1) / GRAY_SIZE;
+    /// Pixels do quadro reduzido que um bloco pode tocar, na horizontal e na vertical.
+    static constexpr int COLUMN_TAPS = (MAX_BLOCK_COLUMNS + GRAY_SCALE - 2) / GRAY_SCALE + 1;
+    static constexpr int ROW_TAPS = (MIN_BLOCK_ROWS + GRAY_SCALE - 1) / GRAY_SCALE + 1;
+
+    // Cada bloco 84x84 soma ROW_TAPS linhas e COLUMN_TAPS colunas do quadro reduzido a partir de
+    // rowFirst/columnFirst. O peso de cada uma é quantas linhas (ou colunas) da imagem cheia ela tem
+    // dentro do bloco; as que sobram no fim de um bloco menor têm peso 0.
+    int rowFirst[GRAY_SIZE];
+    uint8_t rowWeight[GRAY_SIZE][ROW_TAPS];
+    uint8_t blockRows[GRAY_SIZE];     ///< Altura de cada linha de blocos na imagem cheia.
+    int columnFirst[GRAY_SIZE];
+    /// Peso da coluna vezes 1/área do bloco (16.16), por altura de bloco, tap e coluna.
+    uint32_t columnWeight[2][COLUMN_TAPS][GRAY_SIZE];
+};
@@ -0,0 +1,42 @@
+/**
+ * @file PngImage.hpp
+ * @brief Decodificador de PNG sem dependências, para carregar o atlas sem Allegro.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @struct RgbaImage
+ * @brief Uma imagem RGBA de 8 bits por canal, linha a linha, sem espaço entre linhas.
+ */
+struct RgbaImage {
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels; ///< width * height * 4 bytes (R, G, B, A).
+
+    /**
+     * @brief Retorna o endereço do pixel (x, y).
+     */
+    const uint8_t* at(int x, int y) const { return &pixels[(static_cast<size_t>(y) * width + x) * 4]; }
+};
+
+/**
+ * @brief Decodifica um PNG na memória.
+ *
+ * Suporta o que os assets do jogo usam: 8 bits por canal, RGB ou RGBA, sem
+ * entrelaçamento (os outros formatos geram erro em vez de uma imagem errada).
+ * Inclui o próprio inflate (DEFLATE), então não depende de zlib.
+ *
+ * @param data Os bytes do arquivo.
+ * @throw std::runtime_error se o arquivo estiver corrompido ou usar um formato não suportado.
+ */
+RgbaImage decodePng(const std::vector<uint8_t>& data);
+
+/**
+ * @brief Lê e decodifica um arquivo PNG.
+ * @throw std::runtime_error se o arquivo não puder ser lido ou decodificado.
+ */
+RgbaImage loadPng(const std::string& path);
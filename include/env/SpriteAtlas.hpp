@@ -0,0 +1,50 @@
+/**
+ * @file SpriteAtlas.hpp
+ * @brief Definição do SpriteAtlas, o sprite sheet do jogo carregado sem Allegro.
+ */
+#pragma once
+
+#include "env/PngImage.hpp"
+#include <map>
+#include <string>
+
+/**
+ * @class SpriteAtlas
+ * @brief Os pixels do sprite sheet e os retângulos de cada sprite, lidos do mesmo JSON usado pelo ResourceManager.
+ *
+ * É a versão headless de ResourceManager::loadAtlasJson: em vez de sub-bitmaps
+ * do Allegro, devolve cópias RGBA dos sprites para renderizadores em software.
+ */
+class SpriteAtlas {
+public:
+    static constexpr const char* DEFAULT_IMAGE = "assets/sprites/sprite_sheet.png"; ///< Atlas principal do jogo.
+    static constexpr const char* DEFAULT_JSON = "assets/sprites/sprite_sheet.json"; ///< Coordenadas do atlas principal.
+
+    /**
+     * @brief Carrega o atlas.
+     * @param imagePath O PNG do sprite sheet.
+     * @param jsonPath O JSON com nome, posição e tamanho de cada sprite.
+     * @throw std::runtime_error se algum dos arquivos não puder ser lido.
+     */
+    explicit SpriteAtlas(const std::string& imagePath = DEFAULT_IMAGE, const std::string& jsonPath = DEFAULT_JSON);
+
+    /**
+     * @brief Copia os pixels de um sprite.
+     * @param name O nome do sprite no JSON (ex.: "pipe-green").
+     * @throw std::runtime_error se o sprite não existir ou estiver fora da imagem.
+     */
+    RgbaImage getSprite(const std::string& name) const;
+
+    /**
+     * @brief Retorna se o atlas tem um sprite com esse nome.
+     */
+    bool contains(const std::string& name) const { return rects.count(name) != 0; }
+
+private:
+    struct Rect {
+        int x, y, width, height;
+    };
+
+    RgbaImage image;
+    std::map<std::string, Rect> rects;
+};
@@ -0,0 +1,96 @@
+/**
+ * @file flappy_controller.h
+ * @brief ABI C estável (versão 1) dos bots carregados de bibliotecas compartilhadas.
+ *
+ * Um bot é uma biblioteca (.so) que exporta a função FLAPPY_CONTROLLER_V1_ENTRY,
+ * em C, retornando uma tabela estática flappy_controller_v1. O mesmo bot joga na
+ * janela (--bot), em partidas sem janela (--headless) e no BotRunner paralelo.
+ *
+ * A cada passo de simulação o jogo chama decide() com um ponteiro somente-leitura
+ * para a observação, válido só durante a chamada. Nenhuma cópia ou alocação é
+ * feita por passo. Cada partida tem a sua instância (create/destroy); instâncias
+ * diferentes podem ser usadas ao mesmo tempo por threads diferentes.
+ *
+ * Regras de compatibilidade: campos só são acrescentados no fim das structs, e
+ * struct_size informa o tamanho conhecido pelo bot. Mudanças incompatíveis criam
+ * uma nova versão (flappy_controller_v2) em vez de alterar esta.
+ */
+#ifndef FLAPPY_CONTROLLER_H
+#define FLAPPY_CONTROLLER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FLAPPY_CONTROLLER_ABI_VERSION 1                              /**< Versão desta ABI. */
+#define FLAPPY_CONTROLLER_V1_ENTRY_NAME "flappy_controller_v1_entry" /**< Símbolo exportado pelo bot. */
+#define FLAPPY_OBSERVATION_PIPES 3                                   /**< Canos à frente na observação. */
+
+/**
+ * @brief Um cano à frente do pássaro, em pixels da tela (288x512).
+ */
+typedef struct flappy_pipe_v1 {
+    float x;          /**< Borda esquerda do cano. */
+    float gap_top;    /**< Início do vão (base do cano superior). */
+    float gap_bottom; /**< Fim do vão (topo do cano inferior). */
+} flappy_pipe_v1;
+
+/**
+ * @brief Observação de um passo: o pássaro e os próximos canos, em pixels e segundos.
+ *
+ * Os canos são os primeiros que ainda não ficaram totalmente para trás do
+ * pássaro, ordenados por x; só os pipe_count primeiros são válidos.
+ */
+typedef struct flappy_observation_v1 {
+    uint32_t tick;         /**< Passos desde o primeiro pulo (cada passo dura 1/FPS segundo). */
+    uint32_t phase;        /**< 0 = esperando o primeiro pulo, 1 = jogando. */
+    int32_t score;         /**< Canos ultrapassados. */
+    float bird_x;          /**< Borda esquerda do pássaro (constante). */
+    float bird_y;          /**< Topo do pássaro. */
+    float bird_vel_y;      /**< Velocidade vertical (positiva para baixo), em pixels/s. */
+    float bird_width;      /**< Largura da hitbox do pássaro. */
+    float bird_height;     /**< Altura da hitbox do pássaro. */
+    float pipe_width;      /**< Largura dos canos. */
+    float floor_y;         /**< Topo do chão. */
+    uint32_t pipe_count;   /**< Canos válidos em pipes. */
+    flappy_pipe_v1 pipes[FLAPPY_OBSERVATION_PIPES];
+} flappy_observation_v1;
+
+/**
+ * @brief Tabela de funções de um bot.
+ */
+typedef struct flappy_controller_v1 {
+    uint32_t abi_version; /**< Deve ser FLAPPY_CONTROLLER_ABI_VERSION. */
+    uint32_t struct_size; /**< sizeof(flappy_controller_v1) do lado do bot. */
+    const char* name;     /**< Nome do bot, para mensagens. */
+
+    /**
+     * @brief Cria a instância de uma partida (pode ser NULL se o bot não tiver estado).
+     * @param seed Semente do percurso da partida.
+     */
+    void* (*create)(uint64_t seed);
+
+    /**
+     * @brief Libera uma instância criada por create (pode ser NULL).
+     */
+    void (*destroy)(void* instance);
+
+    /**
+     * @brief Decide o passo atual.
+     * @param instance A instância da partida.
+     * @param observation Estado do passo; somente leitura e válido só durante a chamada.
+     * @return Diferente de zero para pular.
+     */
+    int (*decide)(void* instance, const flappy_observation_v1* observation);
+} flappy_controller_v1;
+
+/** @brief Assinatura da função exportada pelo bot. */
+typedef const flappy_controller_v1* (*flappy_controller_v1_entry_fn)(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * @file BotManager.hpp
+ * @brief Define o gerenciador do bot carregado com --bot.
+ */
+#pragma once
+
+#include "env/BotController.hpp"
+#include <memory>
+#include <string>
+
+/**
+ * @class BotManager
+ * @brief Singleton que mantém a biblioteca do bot aberta durante o jogo.
+ *
+ * O Game carrega o bot uma vez; a GameScene cria uma instância dele a cada
+ * partida e pergunta se deve pular a cada passo de simulação.
+ */
+class BotManager {
+public:
+    /**
+     * @brief Obtém a instância única do gerenciador.
+     */
+    static BotManager& getInstance();
+
+    /**
+     * @brief Abre a biblioteca do bot (substitui a anterior, se houver).
+     * @param path Caminho do .so.
+     * @throw std::runtime_error se o bot não puder ser carregado (ver BotLibrary).
+     */
+    void load(const std::string& path);
+
+    /**
+     * @brief Retorna se há um bot carregado.
+     */
+    bool isLoaded() const { return library != nullptr; }
+
+    /**
+     * @brief Retorna a tabela do bot carregado (nullptr se não houver).
+     */
+    const flappy_controller_v1* getController() const { return library ? library->getController() : nullptr; }
+
+private:
+    std::unique_ptr<BotLibrary> library;
+
+    BotManager() = default;
+    BotManager(const BotManager&) = delete;
+    BotManager& operator=(const BotManager&) = delete;
+};
@@ -17,22 +17,61 @@ enum class TextAlign {
     RIGHT   ///< O 'x' fornecido é o canto direito do último dígito.
 };
 
+/**
+ * @struct NumberLayout
+ * @brief Os dígitos de um número já posicionados, em escala 1, a partir da borda esquerda do número.
+ */
+struct NumberLayout {
+    static constexpr int MAX_DIGITS = 10; ///< Dígitos de um int positivo.
+
+    ALLEGRO_BITMAP* sprites[MAX_DIGITS]; ///< Sprite de cada dígito, da esquerda para a direita.
+    float x[MAX_DIGITS];                 ///< Borda esquerda de cada dígito.
+    float width[MAX_DIGITS];             ///< Largura de cada sprite.
+    float height[MAX_DIGITS];            ///< Altura de cada sprite.
+    int count = 0;                       ///< Quantos dígitos.
+    float totalWidth = 0.0f;             ///< Largura do número inteiro.
+};
+
 /**
  * @class ScoreManager
  * @brief Gerencia a pontuação do jogo e fornece uma interface para desenhar números na tela.
+ *
+ * O layout dos dígitos da pontuação atual fica guardado e só é refeito quando
+ * ela muda (increaseScore, reset e setScore); números avulsos são dispostos na
+ * pilha, sem alocar.
  */
 class ScoreManager : public IDrawable {
 private:
     int currentScore;
     ALLEGRO_BITMAP* digitSprites[10];
+    NumberLayout scoreLayout; ///< Layout de currentScore.
+
+    /**
+     * @brief Separa os dígitos do número e os posiciona lado a lado (negativos viram 0).
+     */
+    void layoutNumber(int number, NumberLayout& layout) const;
+
+    /**
+     * @brief Desenha um layout com a escala e o alinhamento pedidos.
+     */
+    void drawLayout(const NumberLayout& layout, float x, float y, float scale, TextAlign align) const;
 
 public:
     ScoreManager();
 
-    void increaseScore() { currentScore++; }
-    void reset() { currentScore = 0; }
+    void increaseScore() { setScore(currentScore + 1); }
+    void reset() { setScore(0); }
+    /**
+     * @brief Define a pontuação; o layout dos dígitos só é refeito se o valor mudar.
+     */
+    void setScore(int score);
     int getScore() const { return currentScore; }
 
+    /**
+     * @brief O layout guardado da pontuação atual.
+     */
+    const NumberLayout& getScoreLayout() const { return scoreLayout; }
+
     void draw() const override;
 
     /**
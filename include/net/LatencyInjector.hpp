@@ -0,0 +1,69 @@
+/**
+ * @file LatencyInjector.hpp
+ * @brief Definição do LatencyInjector, que simula uma rede ruim no localhost.
+ */
+#pragma once
+
+#include "sim/SimRandom.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class LatencyInjector
+ * @brief Fila de pacotes com atraso, variação (jitter) e perda artificiais.
+ *
+ * Os pacotes enviados entram na fila com um horário de entrega igual ao tempo
+ * atual mais a latência e uma variação uniforme em [-jitter, +jitter]; com
+ * jitter, pacotes podem chegar fora de ordem, como no UDP de verdade. Uma fração
+ * lossPercent é descartada na entrada. A fila tem capacidade fixa e não aloca.
+ */
+class LatencyInjector {
+public:
+    static constexpr size_t MAX_PACKET = 64;  ///< Maior pacote aceito, em bytes.
+    static constexpr size_t CAPACITY = 256;   ///< Pacotes em trânsito no máximo.
+
+    /**
+     * @brief Construtor.
+     * @param latencyMs Atraso médio de cada pacote, em milissegundos.
+     * @param jitterMs Variação máxima do atraso, em milissegundos.
+     * @param lossPercent Porcentagem de pacotes descartados (0 a 100).
+     * @param seed Semente da variação e da perda.
+     */
+    LatencyInjector(float latencyMs = 0.0f, float jitterMs = 0.0f, float lossPercent = 0.0f, uint64_t seed = 1);
+
+    /**
+     * @brief Coloca um pacote em trânsito.
+     * @param data Os bytes do pacote.
+     * @param size Tamanho do pacote (no máximo MAX_PACKET).
+     * @param now Tempo atual, em segundos.
+     * @return false se o pacote foi descartado (perda simulada, fila cheia ou grande demais).
+     */
+    bool push(const uint8_t* data, size_t size, double now);
+
+    /**
+     * @brief Retira um pacote cujo horário de entrega já passou.
+     * @param now Tempo atual, em segundos.
+     * @param out Destino dos bytes (pelo menos MAX_PACKET).
+     * @return O tamanho do pacote, ou 0 se nenhum estiver pronto.
+     */
+    size_t pop(double now, uint8_t* out);
+
+    // --- Getters ---
+    size_t getInFlight() const { return inFlight; }
+    uint64_t getDropped() const { return dropped; }
+
+private:
+    struct Slot {
+        double deliverAt;
+        uint8_t size;  ///< 0 quando o lugar está livre.
+        uint8_t data[MAX_PACKET];
+    };
+
+    Slot slots[CAPACITY];
+    size_t inFlight;
+    uint64_t dropped;
+    float latency;  ///< Em segundos.
+    float jitter;   ///< Em segundos.
+    float loss;     ///< Probabilidade, de 0 a 1.
+    SimRandom random;
+};
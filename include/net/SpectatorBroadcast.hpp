@@ -0,0 +1,83 @@
+/**
+ * @file SpectatorBroadcast.hpp
+ * @brief Definição do SpectatorBroadcast, o servidor que transmite a partida para espectadores.
+ */
+#pragma once
+
+#include "net/SpectatorStream.hpp"
+#include "net/StreamSocket.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class SpectatorBroadcast
+ * @brief Singleton que publica os passos da partida para todos os espectadores conectados.
+ *
+ * As cenas chamam publish() a cada passo; o registro é codificado uma única vez
+ * e os mesmos bytes vão para todos os espectadores, agrupados a cada
+ * FLUSH_FRAMES quadros (um envio por espectador a cada 100 ms). O custo por
+ * espectador é só esse envio: nada é codificado por conexão, exceto o
+ * quadro-chave de quem acabou de entrar.
+ *
+ * Um espectador pode retransmitir o que recebe (--spectate junto com
+ * --broadcast), formando uma árvore: cada processo atende só as suas conexões
+ * diretas, e o custo do jogo original não cresce com o total de espectadores.
+ */
+class SpectatorBroadcast {
+public:
+    static constexpr int FLUSH_FRAMES = 3; ///< Quadros entre envios.
+
+    /**
+     * @brief Obtém a única instância.
+     */
+    static SpectatorBroadcast& getInstance();
+
+    /**
+     * @brief Começa a aceitar espectadores.
+     * @param address "porta" ou "unix:caminho".
+     * @throw std::runtime_error se o endereço não puder ser usado.
+     */
+    void start(const std::string& address);
+
+    /**
+     * @brief Desconecta todos e para de transmitir.
+     */
+    void stop();
+
+    /**
+     * @brief Indica se a transmissão está ativa; publish() não faz nada quando não está.
+     */
+    bool isActive() const { return server != nullptr; }
+
+    /**
+     * @brief Publica o estado da simulação depois de um passo (ou de um salto no tempo).
+     */
+    void publish(const FixedSimState& state) { if (server) publish(SpectatorState::from(state)); }
+
+    /**
+     * @brief Publica um estado já convertido (usado ao retransmitir).
+     */
+    void publish(const SpectatorState& state);
+
+    /**
+     * @brief Chamado uma vez por quadro: envia os registros acumulados e aceita novos espectadores.
+     */
+    void poll();
+
+    // --- Getters ---
+    size_t getSpectatorCount() const { return server ? server->getClientCount() : 0; }
+    uint64_t getBytesSent() const { return server ? server->getBytesSent() : 0; }
+
+private:
+    SpectatorBroadcast() : framesSinceFlush(0) {}
+    SpectatorBroadcast(const SpectatorBroadcast&) = delete;
+    SpectatorBroadcast& operator=(const SpectatorBroadcast&) = delete;
+
+    std::unique_ptr<StreamServer> server;
+    SpectatorEncoder encoder;
+    std::vector<uint8_t> pending;   ///< Registros ainda não enviados.
+    std::vector<uint8_t> keyframe;  ///< Reutilizado para cada espectador novo.
+    int framesSinceFlush;
+};
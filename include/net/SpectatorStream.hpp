@@ -0,0 +1,137 @@
+/**
+ * @file SpectatorStream.hpp
+ * @brief Codificação compacta do estado da partida para espectadores.
+ * @details O fluxo é uma sequência de registros. Um quadro-chave descreve o
+ * estado completo (pássaro, pontuação e canos na tela); cada passo seguinte é
+ * um registro de diferença de 3 bytes na maioria dos passos: um byte de flags
+ * e as variações de Y (quartos de pixel) e do ângulo (graus) em varints zigzag.
+ * O espectador move os canos sozinho, com o mesmo núcleo da simulação, então só
+ * o surgimento de um cano (a altura do vão) precisa ser transmitido.
+ */
+#pragma once
+
+#include "sim/GameSimulation.hpp"
+#include "sim/PipeCourse.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+/**
+ * @struct SpectatorState
+ * @brief O que um espectador precisa para desenhar um passo da partida.
+ */
+struct SpectatorState {
+    static constexpr int MAX_PIPES = FixedPipeCourse::CAPACITY;
+    static constexpr float Y_SCALE = 4.0f; ///< Unidades de birdY por pixel.
+
+    uint32_t tick;
+    SimPhase phase;
+    int32_t score;
+    int32_t birdY;       ///< Em quartos de pixel.
+    int32_t birdAngle;   ///< Em graus inteiros.
+    int32_t pipeCount;
+    Fixed pipeX[MAX_PIPES];     ///< Em Q16.16, como na simulação, para que o espectador mova os canos igual.
+    Fixed gapTop[MAX_PIPES];
+    Fixed gapBottom[MAX_PIPES];
+
+    /**
+     * @brief Extrai o estado visível de um estado da simulação.
+     */
+    static SpectatorState from(const FixedSimState& state);
+
+    /**
+     * @brief Move os canos um passo, como BasicPipeCourse::advance().
+     */
+    void advancePipes();
+
+    /**
+     * @brief Acrescenta um cano recém-surgido na borda direita da tela.
+     */
+    void spawnPipe(Fixed top);
+
+    float getBirdY() const { return static_cast<float>(birdY) * (1.0f / Y_SCALE); }
+    float getBirdAngle() const { return static_cast<float>(birdAngle); }
+    FixedPipeSpan span() const { return FixedPipeSpan{pipeX, gapTop, gapBottom, pipeCount}; }
+
+    bool operator==(const SpectatorState& other) const;
+    bool operator!=(const SpectatorState& other) const { return !(*this == other); }
+};
+
+/**
+ * @class SpectatorEncoder
+ * @brief Gera o fluxo de registros a partir dos estados publicados pelo jogo.
+ *
+ * O codificador guarda o estado que os espectadores têm (o espelho). Cada
+ * diferença é conferida decodificando-a sobre o espelho; se o resultado não
+ * for exatamente o estado publicado (rewind, save state, nova partida), um
+ * quadro-chave é enviado no lugar.
+ */
+class SpectatorEncoder {
+public:
+    SpectatorEncoder() : valid(false) {}
+
+    /**
+     * @brief Esquece o espelho: o próximo estado vira um quadro-chave.
+     */
+    void reset() { valid = false; }
+
+    /**
+     * @brief Acrescenta o registro que leva os espectadores ao novo estado.
+     * @param state O estado publicado.
+     * @param out Destino dos bytes.
+     * @return Bytes acrescentados (0 se o estado não mudou).
+     */
+    size_t encode(const SpectatorState& state, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Acrescenta um quadro-chave do espelho atual (para um espectador que acabou de entrar).
+     */
+    void encodeKeyframe(std::vector<uint8_t>& out) const;
+
+    bool hasState() const { return valid; }
+
+private:
+    SpectatorState mirror;
+    bool valid;
+};
+
+/**
+ * @class SpectatorDecoder
+ * @brief Reconstrói os estados a partir dos bytes recebidos, em qualquer fragmentação.
+ *
+ * Os estados decodificados ficam em uma fila, para que o espectador os desenhe
+ * um por passo mesmo que os bytes cheguem em rajadas.
+ */
+class SpectatorDecoder {
+public:
+    SpectatorDecoder() : valid(false), corrupt(false) {}
+
+    /**
+     * @brief Recebe bytes do fluxo e decodifica todos os registros completos.
+     * @return false se o fluxo for inválido (a partir daí é ignorado).
+     */
+    bool feed(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Retira o próximo estado decodificado.
+     * @return false se a fila estiver vazia.
+     */
+    bool pop(SpectatorState& state);
+
+    /**
+     * @brief Descarta os estados mais antigos, deixando no máximo 'keep' na fila.
+     */
+    void trim(size_t keep);
+
+    // --- Getters ---
+    size_t pending() const { return queue.size(); }
+    bool isCorrupt() const { return corrupt; }
+
+private:
+    std::vector<uint8_t> buffer;        ///< Bytes de um registro ainda incompleto.
+    std::deque<SpectatorState> queue;
+    SpectatorState current;
+    bool valid;
+    bool corrupt;
+};
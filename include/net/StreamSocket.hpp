@@ -0,0 +1,101 @@
+/**
+ * @file StreamSocket.hpp
+ * @brief Servidor e cliente de fluxo (TCP ou socket Unix) não bloqueantes.
+ * @details Endereços: "porta" ou "host:porta" para TCP, "unix:caminho" para um
+ * socket Unix local.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class StreamServer
+ * @brief Aceita conexões e envia o mesmo fluxo de bytes para todas elas.
+ *
+ * Nada bloqueia o loop do jogo: quando um cliente não consegue receber tudo,
+ * o restante fica em uma fila só dele; se a fila passar de MAX_BACKLOG o
+ * cliente é desconectado em vez de atrasar os demais.
+ */
+class StreamServer {
+public:
+    static constexpr size_t MAX_BACKLOG = 64 * 1024; ///< Bytes pendentes tolerados por cliente.
+
+    /**
+     * @brief Começa a escutar.
+     * @param address "porta" (todas as interfaces) ou "unix:caminho".
+     * @throw std::runtime_error se o endereço for inválido ou estiver em uso.
+     */
+    explicit StreamServer(const std::string& address);
+    ~StreamServer();
+
+    StreamServer(const StreamServer&) = delete;
+    StreamServer& operator=(const StreamServer&) = delete;
+
+    /**
+     * @brief Aceita as conexões pendentes.
+     * @return Quantas foram aceitas; elas ocupam os últimos índices de cliente.
+     */
+    size_t acceptClients();
+
+    /**
+     * @brief Envia bytes para um cliente.
+     */
+    void sendTo(size_t client, const uint8_t* data, size_t size);
+
+    /**
+     * @brief Envia os mesmos bytes para todos os clientes e remove os desconectados.
+     */
+    void sendToAll(const uint8_t* data, size_t size);
+
+    // --- Getters ---
+    size_t getClientCount() const { return clients.size(); }
+    uint64_t getBytesSent() const { return bytesSent; }
+
+private:
+    struct Client {
+        int fd;
+        std::vector<uint8_t> backlog; ///< Bytes que o socket ainda não aceitou.
+        bool closed;
+    };
+
+    int listenFd;
+    std::string unixPath;            ///< Arquivo do socket Unix, removido no destrutor.
+    std::vector<Client> clients;
+    uint64_t bytesSent;
+
+    void write(Client& client, const uint8_t* data, size_t size);
+    void removeClosed();
+};
+
+/**
+ * @class StreamClient
+ * @brief Conexão de leitura com um StreamServer.
+ */
+class StreamClient {
+public:
+    /**
+     * @brief Conecta ao servidor.
+     * @param address "host:porta" ou "unix:caminho".
+     * @throw std::runtime_error se a conexão falhar.
+     */
+    explicit StreamClient(const std::string& address);
+    ~StreamClient();
+
+    StreamClient(const StreamClient&) = delete;
+    StreamClient& operator=(const StreamClient&) = delete;
+
+    /**
+     * @brief Lê os bytes disponíveis.
+     * @return Quantos bytes foram lidos (0 se não houver nenhum ou a conexão tiver fechado).
+     */
+    size_t receive(uint8_t* out, size_t capacity);
+
+    bool isClosed() const { return closed; }
+
+private:
+    int fd;
+    bool closed;
+};
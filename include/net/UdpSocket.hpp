@@ -0,0 +1,55 @@
+/**
+ * @file UdpSocket.hpp
+ * @brief Definição do UdpSocket, um socket UDP não bloqueante ligado a um único par.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class UdpSocket
+ * @brief Socket UDP (POSIX) para a troca de pacotes do modo versus.
+ *
+ * O socket escuta em uma porta local e envia para um único endereço remoto.
+ * As operações nunca bloqueiam o loop do jogo. Erros de configuração lançam
+ * std::runtime_error; erros de envio são ignorados, já que o protocolo tolera
+ * perda de pacotes.
+ */
+class UdpSocket {
+public:
+    /**
+     * @brief Abre o socket e o associa à porta local.
+     * @param localPort Porta UDP local.
+     * @param remoteHost Endereço IPv4 ou nome do outro jogador.
+     * @param remotePort Porta UDP do outro jogador.
+     * @throw std::runtime_error se o socket não puder ser criado ou o endereço for inválido.
+     */
+    UdpSocket(uint16_t localPort, const std::string& remoteHost, uint16_t remotePort);
+
+    /**
+     * @brief Fecha o socket.
+     */
+    ~UdpSocket();
+
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+
+    /**
+     * @brief Envia um datagrama para o outro jogador.
+     */
+    void send(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Lê o próximo datagrama do outro jogador, se houver.
+     * @param out Destino dos bytes.
+     * @param capacity Tamanho de out.
+     * @return O tamanho do datagrama, ou 0 se não houver nenhum.
+     */
+    size_t receive(uint8_t* out, size_t capacity);
+
+private:
+    int fd;
+    uint8_t remoteAddress[16]; ///< sockaddr_in do outro jogador (evita incluir os headers POSIX aqui).
+};
@@ -0,0 +1,54 @@
+/**
+ * @file VersusPacket.hpp
+ * @brief Formato do pacote UDP trocado entre os dois jogadores do modo versus.
+ */
+#pragma once
+
+#include "sim/RollbackSession.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct VersusPacket
+ * @brief Entradas de um jogador e a confirmação das entradas do outro.
+ *
+ * Cada pacote repete todas as entradas locais que o outro jogador ainda não
+ * confirmou (até MAX_INPUTS passos, um bit por passo), então um pacote perdido
+ * não precisa ser reenviado: o próximo já leva as mesmas entradas.
+ *
+ * Na rede são SIZE bytes em little-endian: "FBVS", firstTick, ack, jumps e count.
+ */
+struct VersusPacket {
+    static constexpr uint32_t MAGIC = 0x53564246; ///< "FBVS" em little-endian.
+    static constexpr size_t SIZE = 17;            ///< Bytes de um pacote codificado.
+    static constexpr int MAX_INPUTS = 32;         ///< Entradas por pacote (bits de jumps).
+
+    uint32_t firstTick; ///< Passo da primeira entrada do pacote.
+    uint32_t ack;       ///< Todas as entradas do destinatário antes deste passo chegaram.
+    uint32_t jumps;     ///< Bit i: pulo no passo firstTick + i.
+    uint8_t count;      ///< Entradas válidas em jumps.
+
+    /**
+     * @brief Codifica o pacote em SIZE bytes.
+     */
+    void encode(uint8_t* out) const;
+
+    /**
+     * @brief Decodifica um pacote recebido.
+     * @return false se o tamanho, o identificador ou a contagem forem inválidos.
+     */
+    static bool decode(const uint8_t* data, size_t size, VersusPacket& packet);
+};
+
+/**
+ * @brief Monta o pacote com as entradas locais que o outro jogador ainda não confirmou.
+ * @param session A sessão local.
+ * @param peerAck O último ack recebido do outro jogador.
+ */
+VersusPacket buildInputPacket(const RollbackSession& session, uint32_t peerAck);
+
+/**
+ * @brief Entrega à sessão as entradas de um pacote recebido.
+ * @return O ack do pacote (até onde o outro jogador já recebeu as entradas locais).
+ */
+uint32_t applyInputPacket(RollbackSession& session, const VersusPacket& packet);
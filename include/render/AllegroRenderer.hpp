@@ -0,0 +1,29 @@
+/**
+ * @file AllegroRenderer.hpp
+ * @brief Definição do AllegroRenderer, o backend que desenha com o Allegro.
+ */
+#pragma once
+
+#include "render/Renderer.hpp"
+
+/**
+ * @class AllegroRenderer
+ * @brief Backend padrão: cada chamada vai direto para a função equivalente do Allegro, no alvo atual.
+ */
+class AllegroRenderer : public Renderer {
+public:
+    void drawBitmap(ALLEGRO_BITMAP* bitmap, float x, float y, int flags) override;
+    void copyBitmap(ALLEGRO_BITMAP* bitmap, float x, float y) override;
+    void drawScaledBitmap(ALLEGRO_BITMAP* bitmap, float sx, float sy, float sw, float sh,
+                          float dx, float dy, float dw, float dh, int flags) override;
+    void drawTintedScaledBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float sx, float sy, float sw, float sh,
+                                float dx, float dy, float dw, float dh, int flags) override;
+    void drawTintedScaledRotatedBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float cx, float cy,
+                                       float dx, float dy, float xscale, float yscale, float angle, int flags) override;
+    void drawText(const ALLEGRO_FONT* font, ALLEGRO_COLOR color, float x, float y, int flags, const char* text) override;
+    void drawRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color, float thickness) override;
+    void drawFilledRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color) override;
+    void clear(ALLEGRO_COLOR color) override;
+    void holdDrawing(bool hold) override;
+    void drawGui(WZ_WIDGET* gui) override;
+};
@@ -0,0 +1,150 @@
+/**
+ * @file FrameCapture.hpp
+ * @brief Definição do FrameCapture, que grava os quadros da sessão num arquivo de vídeo sem travar o jogo.
+ */
+#pragma once
+
+#include "render/SoftwareRenderer.hpp"
+#include <allegro5/allegro.h>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @enum CaptureFormat
+ * @brief Formato do arquivo gravado.
+ */
+enum class CaptureFormat {
+    Y4M, ///< YUV4MPEG2 4:2:0 (faixa completa), aberto direto pelo ffmpeg e pela maioria dos players.
+    RGBA ///< Quadros RGBA crus, 4 bytes por pixel, um após o outro, sem cabeçalho.
+};
+
+/**
+ * @struct CaptureStats
+ * @brief Contadores da gravação.
+ */
+struct CaptureStats {
+    uint64_t captured = 0;      ///< Quadros copiados para o pool.
+    uint64_t written = 0;       ///< Quadros gravados no arquivo.
+    uint64_t dropped = 0;       ///< Quadros descartados porque todos os buffers do pool estavam ocupados.
+    unsigned queueDepth = 0;    ///< Quadros esperando o escritor agora.
+    unsigned maxQueueDepth = 0; ///< Maior fila vista desde o início.
+    double lastCaptureMs = 0.0; ///< Tempo da thread do jogo no último quadro copiado.
+    double maxCaptureMs = 0.0;  ///< Maior tempo da thread do jogo num quadro copiado.
+};
+
+/**
+ * @class FrameCapture
+ * @brief Grava os quadros do jogo numa thread separada, com um pool fixo de POOL_SIZE buffers.
+ *
+ * Na thread do jogo, capture() só trava o quadro, copia as linhas como estão
+ * (no formato do bitmap) para um buffer livre e o entrega à fila; a conversão
+ * para RGBA ou YUV e a escrita no disco ficam com a thread escritora. Os
+ * buffers são alocados no construtor, então gravar não aloca memória. Se o
+ * disco atrasar e os três buffers estiverem na fila, o quadro é descartado
+ * (e contado em CaptureStats::dropped) em vez de segurar o jogo.
+ */
+class FrameCapture {
+public:
+    static constexpr size_t POOL_SIZE = 3; ///< Buffers de quadro: um sendo copiado, um na fila e um sendo gravado.
+
+    /**
+     * @brief Abre o arquivo, escreve o cabeçalho e inicia a thread escritora.
+     * @param path Arquivo de saída; o formato vem da extensão (ver formatFor()).
+     * @param width Largura dos quadros.
+     * @param height Altura dos quadros.
+     * @param fps Quadros por segundo, anotados no cabeçalho Y4M.
+     * @throw std::runtime_error se o arquivo não puder ser aberto.
+     */
+    FrameCapture(const std::string& path, int width, int height, int fps);
+
+    /**
+     * @brief Grava os quadros que ainda estão na fila e fecha o arquivo.
+     */
+    ~FrameCapture();
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    /**
+     * @brief Y4M para arquivos .y4m; RGBA cru para qualquer outra extensão.
+     */
+    static CaptureFormat formatFor(const std::string& path);
+
+    /**
+     * @brief Copia o quadro para a fila de gravação (chamado a cada quadro, na thread do jogo).
+     * @details Com um bitmap de memória, é só a cópia das linhas. Com um bitmap de
+     * vídeo, al_lock_bitmap lê o quadro da GPU de forma síncrona e o Allegro aloca
+     * o buffer da trava; esse custo é medido pelo BenchCapture.
+     * @param frame Bitmap de width x height (ex.: o quadro do ScreenTarget).
+     * @return false se o quadro foi descartado (pool cheio, tamanho diferente ou bitmap que não trava).
+     */
+    bool capture(ALLEGRO_BITMAP* frame);
+
+    /**
+     * @brief Como capture(), a partir de pixels na memória.
+     * @param pixels Primeira linha; pitch em bytes (pode ser negativo).
+     * @param layout Onde fica cada canal nos pixels de 32 bits.
+     */
+    bool submit(const uint8_t* pixels, int pitch, const PixelLayout& layout);
+
+    /**
+     * @brief Espera a fila esvaziar, encerra a thread e fecha o arquivo. Chamadas seguintes não fazem nada.
+     */
+    void stop();
+
+    CaptureStats getStats() const;
+    CaptureFormat getFormat() const { return format; }
+
+    /**
+     * @brief Converte um quadro de 32 bits em bytes R, G, B, A.
+     * @param out width * height * 4 bytes.
+     */
+    static void toRgba(const uint8_t* pixels, int pitch, const PixelLayout& layout, int width, int height, uint8_t* out);
+
+    /**
+     * @brief Converte um quadro de 32 bits em YUV 4:2:0 planar (BT.601, faixa completa), como no Y4M C420jpeg.
+     * @param out Os planos Y, U e V: width * height + 2 * ((width + 1) / 2) * ((height + 1) / 2) bytes.
+     */
+    static void toYuv420(const uint8_t* pixels, int pitch, const PixelLayout& layout, int width, int height, uint8_t* out);
+
+private:
+    /// Um buffer do pool: as linhas copiadas e o formato em que estão.
+    struct Slot {
+        std::vector<uint8_t> pixels;
+        PixelLayout layout;
+    };
+
+    CaptureFormat format;
+    int width;
+    int height;
+    std::ofstream out;
+    std::array<Slot, POOL_SIZE> slots;
+    std::vector<uint8_t> converted;      ///< Quadro convertido para o arquivo (só a thread escritora usa).
+
+    mutable std::mutex mutex;
+    std::condition_variable ready;       ///< Acorda a thread escritora quando um quadro entra na fila.
+    std::array<size_t, POOL_SIZE> freeSlots;
+    size_t freeCount;
+    std::array<size_t, POOL_SIZE> queue; ///< Fila circular de quadros prontos para gravar.
+    size_t queueHead;
+    size_t queueCount;
+    CaptureStats stats;
+    bool stopping;
+    std::thread writer;
+
+    /// Reserva um buffer livre; false (e um quadro descartado) se não houver.
+    bool acquire(size_t& slot);
+    /// Devolve ao pool um buffer que não chegou a entrar na fila.
+    void release(size_t slot);
+    /// Entrega o buffer preenchido à thread escritora.
+    void publish(size_t slot, double captureMs);
+    /// Laço da thread escritora: converte e grava os quadros da fila até stop().
+    void writerLoop();
+};
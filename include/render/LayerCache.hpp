@@ -0,0 +1,91 @@
+/**
+ * @file LayerCache.hpp
+ * @brief Definição do LayerCache, um bitmap com camadas estáticas já compostas.
+ */
+#pragma once
+
+#include "managers/ResourceManager.hpp"
+#include <allegro5/allegro.h>
+#include <cstdint>
+
+/**
+ * @class LayerCache
+ * @brief Guarda o resultado de desenhar camadas que não mudam de um quadro para o outro.
+ *
+ * Na primeira vez que get() é chamado, a função de composição desenha as
+ * camadas no bitmap do cache; depois disso, get() só devolve o bitmap, que é
+ * desenhado com uma única cópia por quadro. O cache é refeito quando a chave
+ * muda (ex.: a textura do tema) ou depois de invalidate().
+ *
+ * Com o cache desligado (setEnabled(false)), get() devolve nullptr e quem
+ * chamou desenha as camadas direto, como antes; serve para comparar os dois
+ * caminhos no benchmark.
+ */
+class LayerCache {
+public:
+    /**
+     * @brief O bitmap só é criado na primeira composição.
+     */
+    LayerCache(int width, int height);
+
+    /**
+     * @brief O bitmap composto para a chave, compondo-o antes se preciso.
+     * @param key Identifica o conteúdo (ex.: a textura do tema); uma chave diferente refaz o cache.
+     * @param compose Desenha as camadas por Renderer::current(), com o cache como alvo.
+     * @return O bitmap, ou nullptr se o cache estiver desligado ou o bitmap não puder ser criado.
+     */
+    template <typename Compose>
+    ALLEGRO_BITMAP* get(const void* key, Compose compose)
+    {
+        if (!enabled) return nullptr;
+        if (!valid || key != currentKey || composedGeneration != generation) {
+            if (!beginCompose()) return nullptr;
+            compose();
+            endCompose(key);
+        }
+        return bitmap.get();
+    }
+
+    /**
+     * @brief Força a próxima chamada de get() a compor de novo.
+     */
+    void invalidate() { valid = false; }
+
+    bool isValid() const { return valid; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    /**
+     * @brief Quantas vezes o cache foi composto.
+     */
+    uint32_t getCompositions() const { return compositions; }
+
+    /**
+     * @brief Invalida todos os caches de uma vez (ex.: depois de trocar o Renderer em uso).
+     */
+    static void invalidateAll() { ++generation; }
+
+    /**
+     * @brief Liga ou desliga todos os caches de camadas (ligados por padrão).
+     */
+    static void setEnabled(bool on) { enabled = on; }
+    static bool isEnabled() { return enabled; }
+
+private:
+    BitmapPtr bitmap;
+    int width;
+    int height;
+    const void* currentKey;
+    bool valid;
+    uint32_t compositions;
+    uint32_t composedGeneration;
+    ALLEGRO_BITMAP* previousTarget;
+
+    static bool enabled;
+    static uint32_t generation;
+
+    /// Cria o bitmap se preciso, faz dele o alvo e o limpa para transparente.
+    bool beginCompose();
+    /// Volta ao alvo anterior, avisa o Renderer em uso que o bitmap mudou e marca o cache como válido para a chave.
+    void endCompose(const void* key);
+};
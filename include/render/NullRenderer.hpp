@@ -0,0 +1,105 @@
+/**
+ * @file NullRenderer.hpp
+ * @brief Definição do NullRenderer, o backend que conta as chamadas de desenho sem desenhar.
+ */
+#pragma once
+
+#include "render/Renderer.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum RenderCall
+ * @brief Tipos de chamada de desenho, um por método do Renderer.
+ */
+enum class RenderCall : uint8_t {
+    BITMAP,
+    COPY,
+    SCALED_BITMAP,
+    TINTED_SCALED_BITMAP,
+    ROTATED_BITMAP,
+    TEXT,
+    RECTANGLE,
+    FILLED_RECTANGLE,
+    CLEAR,
+    HOLD,
+    GUI,
+    COUNT
+};
+
+/**
+ * @struct RecordedCall
+ * @brief Uma chamada gravada: o tipo, a textura (ou nullptr) e o retângulo de destino.
+ */
+struct RecordedCall {
+    RenderCall call;
+    ALLEGRO_BITMAP* bitmap;
+    float x, y, w, h; ///< Para bitmaps girados, w e h são a escala.
+};
+
+/**
+ * @class NullRenderer
+ * @brief Backend que não toca no Allegro: conta as chamadas e, se pedido, as grava.
+ *
+ * Usado para medir o custo de CPU dos draw() em máquinas sem display e para
+ * conferir nos testes o que uma cena desenharia. A gravação usa um vetor
+ * reservado de antemão, então não aloca enquanto couber em capacity.
+ */
+class NullRenderer : public Renderer {
+public:
+    /**
+     * @param capacity Chamadas que cabem na gravação sem realocar.
+     */
+    explicit NullRenderer(size_t capacity = 256);
+
+    void drawBitmap(ALLEGRO_BITMAP* bitmap, float x, float y, int flags) override;
+    void copyBitmap(ALLEGRO_BITMAP* bitmap, float x, float y) override;
+    void drawScaledBitmap(ALLEGRO_BITMAP* bitmap, float sx, float sy, float sw, float sh,
+                          float dx, float dy, float dw, float dh, int flags) override;
+    void drawTintedScaledBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float sx, float sy, float sw, float sh,
+                                float dx, float dy, float dw, float dh, int flags) override;
+    void drawTintedScaledRotatedBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float cx, float cy,
+                                       float dx, float dy, float xscale, float yscale, float angle, int flags) override;
+    void drawText(const ALLEGRO_FONT* font, ALLEGRO_COLOR color, float x, float y, int flags, const char* text) override;
+    void drawRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color, float thickness) override;
+    void drawFilledRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color) override;
+    void clear(ALLEGRO_COLOR color) override;
+    void holdDrawing(bool hold) override;
+    void drawGui(WZ_WIDGET* gui) override;
+
+    /**
+     * @brief Liga ou desliga a gravação das chamadas (desligada por padrão).
+     */
+    void setRecording(bool enabled) { recording = enabled; }
+
+    /**
+     * @brief Zera os contadores e descarta as chamadas gravadas.
+     */
+    void reset();
+
+    /**
+     * @brief Chamadas de um tipo desde o último reset().
+     */
+    uint64_t getCount(RenderCall call) const { return counts[static_cast<size_t>(call)]; }
+
+    /**
+     * @brief Chamadas que desenham algo (todas, exceto HOLD) desde o último reset().
+     */
+    uint64_t getDrawCalls() const;
+
+    /**
+     * @brief Soma das coordenadas recebidas, para que um benchmark não possa ser otimizado até sumir.
+     */
+    double getChecksum() const { return checksum; }
+
+    const std::vector<RecordedCall>& getCalls() const { return calls; }
+
+private:
+    std::array<uint64_t, static_cast<size_t>(RenderCall::COUNT)> counts;
+    std::vector<RecordedCall> calls;
+    double checksum;
+    bool recording;
+
+    void record(RenderCall call, ALLEGRO_BITMAP* bitmap, float x, float y, float w, float h);
+};
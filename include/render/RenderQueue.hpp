@@ -0,0 +1,147 @@
+/**
+ * @file RenderQueue.hpp
+ * @brief Definição da RenderQueue, a fila de comandos de desenho ordenada por camada e textura.
+ */
+#pragma once
+
+#include <allegro5/allegro.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum RenderLayer
+ * @brief Camadas de desenho, da mais ao fundo para a mais à frente.
+ *
+ * Dentro de uma camada os sprites não se sobrepõem de forma visível (ou a
+ * ordem entre eles não importa), então a fila pode reordená-los por textura.
+ */
+enum class RenderLayer : uint8_t {
+    BACKGROUND, ///< Fundo com parallax.
+    PIPES,      ///< Canos.
+    FLOOR,      ///< Chão (cobre a base dos canos).
+    GHOSTS,     ///< Fantasmas de partidas anteriores.
+    BIRD,       ///< O pássaro do jogador.
+    COUNT
+};
+
+/**
+ * @struct RenderCommand
+ * @brief Um sprite a desenhar: textura, transformação, cor e camada.
+ *
+ * O sprite é desenhado com o ponto (pivotX, pivotY) da textura em (x, y) na
+ * tela, escalado e girado em torno desse ponto, como em
+ * al_draw_tinted_scaled_rotated_bitmap.
+ */
+struct RenderCommand {
+    ALLEGRO_BITMAP* bitmap; ///< O sprite.
+    ALLEGRO_BITMAP* sheet;  ///< A textura de verdade (o atlas de um sub-bitmap), usada para ordenar.
+    float width, height;    ///< Dimensões do sprite, para o recorte.
+    float pivotX, pivotY;   ///< Ponto do sprite que fica em (x, y).
+    float x, y;             ///< Posição na tela.
+    float scaleX, scaleY;   ///< Escala.
+    float angle;            ///< Rotação em radianos (sentido horário na tela).
+    ALLEGRO_COLOR tint;     ///< Cor multiplicada pelo sprite.
+    int flags;              ///< ALLEGRO_FLIP_HORIZONTAL / ALLEGRO_FLIP_VERTICAL.
+    bool opaque;            ///< Copiado sem mistura de cores (Renderer::copyBitmap).
+    RenderLayer layer;      ///< Camada.
+    uint32_t sequence;      ///< Ordem de envio, que desempata a ordenação.
+};
+
+/**
+ * @struct RenderStats
+ * @brief Contadores do último quadro executado pela fila.
+ */
+struct RenderStats {
+    uint32_t submitted = 0;       ///< Comandos enviados.
+    uint32_t culled = 0;          ///< Comandos descartados por estarem fora da tela.
+    uint32_t drawCalls = 0;       ///< Sprites efetivamente desenhados.
+    uint32_t textureSwitches = 0; ///< Trocas de textura durante a execução.
+};
+
+/**
+ * @class RenderQueue
+ * @brief Fila de comandos de desenho de um quadro.
+ *
+ * Os atores enviam comandos em vez de desenhar na hora. Comandos totalmente
+ * fora da área do jogo são descartados no envio; os demais são ordenados por
+ * camada e, dentro da camada, pela textura (o atlas), e executados numa única
+ * passada com al_hold_bitmap_drawing. Sprites do mesmo atlas ficam seguidos,
+ * então o Allegro os junta em poucos lotes. A memória dos comandos é reusada
+ * de um quadro para o outro.
+ */
+class RenderQueue {
+public:
+    /**
+     * @brief Cria a fila com espaço para capacity comandos.
+     * @param width Largura da área visível (os comandos fora dela são recortados).
+     * @param height Altura da área visível.
+     */
+    RenderQueue(float width, float height, size_t capacity = 64);
+
+    /**
+     * @brief Descarta os comandos e os contadores do quadro anterior.
+     */
+    void clear();
+
+    /**
+     * @brief Envia um comando, descartando-o se estiver fora da área visível.
+     * @return true se o comando entrou na fila.
+     */
+    bool submit(const RenderCommand& command);
+
+    /**
+     * @brief Envia um sprite sem transformação, com o canto superior esquerdo em (x, y).
+     * @return true se o comando entrou na fila (texturas nulas são ignoradas).
+     */
+    bool draw(RenderLayer layer, ALLEGRO_BITMAP* bitmap, float x, float y, int flags = 0);
+
+    /**
+     * @brief Envia um sprite opaco, copiado sem mistura de cores com o canto superior esquerdo em (x, y).
+     * @details Só para camadas que cobrem tudo o que está embaixo, como o fundo.
+     * @return true se o comando entrou na fila (texturas nulas são ignoradas).
+     */
+    bool copy(RenderLayer layer, ALLEGRO_BITMAP* bitmap, float x, float y);
+
+    /**
+     * @brief Envia um sprite girado e colorido, com (pivotX, pivotY) do sprite em (x, y).
+     * @return true se o comando entrou na fila (texturas nulas são ignoradas).
+     */
+    bool drawRotated(RenderLayer layer, ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint,
+                     float pivotX, float pivotY, float x, float y, float angle, int flags = 0);
+
+    /**
+     * @brief Ordena os comandos por camada, textura e ordem de envio.
+     */
+    void sort();
+
+    /**
+     * @brief Ordena e desenha todos os comandos no alvo atual.
+     * @details Os comandos continuam na fila até o próximo clear().
+     */
+    void flush();
+
+    const std::vector<RenderCommand>& getCommands() const { return commands; }
+
+    /**
+     * @brief Contadores do quadro atual: enviados e recortados desde o clear(), desenhados no flush().
+     */
+    const RenderStats& getStats() const { return stats; }
+
+    /**
+     * @brief Se um comando cruza a área [0, width) x [0, height).
+     */
+    static bool isVisible(const RenderCommand& command, float width, float height);
+
+    /**
+     * @brief Monta um comando com os valores neutros (sem escala, rotação ou cor).
+     */
+    static RenderCommand makeCommand(RenderLayer layer, ALLEGRO_BITMAP* bitmap, ALLEGRO_BITMAP* sheet,
+                                     float width, float height, float x, float y);
+
+private:
+    float viewWidth;
+    float viewHeight;
+    uint32_t nextSequence;
+    std::vector<RenderCommand> commands;
+    RenderStats stats;
+};
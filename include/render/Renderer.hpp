@@ -0,0 +1,89 @@
+/**
+ * @file Renderer.hpp
+ * @brief Definição da interface Renderer, por onde os atores e as cenas desenham.
+ */
+#pragma once
+
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+
+struct WZ_WIDGET;
+
+/**
+ * @class Renderer
+ * @brief Backend de desenho usado por todos os draw() do jogo.
+ *
+ * Os métodos espelham as funções de desenho do Allegro que o jogo usa. O
+ * backend padrão (AllegroRenderer) só repassa as chamadas; o NullRenderer
+ * apenas as conta, o que permite medir o custo da lógica de desenho das
+ * cenas sem display nem GPU.
+ *
+ * O backend em uso é global, como os demais gerenciadores: os draw() pegam
+ * Renderer::current() e quem quiser trocar de backend chama setCurrent().
+ */
+class Renderer {
+public:
+    virtual ~Renderer() = default;
+
+    /**
+     * @brief O backend em uso (o AllegroRenderer, se nenhum outro foi definido).
+     */
+    static Renderer& current();
+
+    /**
+     * @brief Troca o backend em uso.
+     * @param renderer O novo backend (nullptr volta ao AllegroRenderer). Deve viver enquanto estiver em uso.
+     */
+    static void setCurrent(Renderer* renderer);
+
+    /// Como al_draw_bitmap.
+    virtual void drawBitmap(ALLEGRO_BITMAP* bitmap, float x, float y, int flags) = 0;
+
+    /**
+     * @brief Copia o bitmap em (x, y) sem misturar cores: os pixels do destino são substituídos.
+     * @details Para camadas opacas que cobrem tudo o que está embaixo. Em bitmaps de memória,
+     * o Allegro faz a cópia linha a linha, sem a mistura por pixel de drawBitmap.
+     */
+    virtual void copyBitmap(ALLEGRO_BITMAP* bitmap, float x, float y) = 0;
+
+    /// Como al_draw_scaled_bitmap.
+    virtual void drawScaledBitmap(ALLEGRO_BITMAP* bitmap, float sx, float sy, float sw, float sh,
+                                  float dx, float dy, float dw, float dh, int flags) = 0;
+
+    /// Como al_draw_tinted_scaled_bitmap.
+    virtual void drawTintedScaledBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float sx, float sy, float sw, float sh,
+                                        float dx, float dy, float dw, float dh, int flags) = 0;
+
+    /// Como al_draw_tinted_scaled_rotated_bitmap (cobre também as versões só giradas).
+    virtual void drawTintedScaledRotatedBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float cx, float cy,
+                                               float dx, float dy, float xscale, float yscale, float angle, int flags) = 0;
+
+    /// Como al_draw_text.
+    virtual void drawText(const ALLEGRO_FONT* font, ALLEGRO_COLOR color, float x, float y, int flags, const char* text) = 0;
+
+    /// Como al_draw_rectangle.
+    virtual void drawRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color, float thickness) = 0;
+
+    /// Como al_draw_filled_rectangle.
+    virtual void drawFilledRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color) = 0;
+
+    /// Como al_clear_to_color.
+    virtual void clear(ALLEGRO_COLOR color) = 0;
+
+    /// Como al_hold_bitmap_drawing.
+    virtual void holdDrawing(bool hold) = 0;
+
+    /// Como wz_draw: desenha uma interface do WidgetZ.
+    virtual void drawGui(WZ_WIDGET* gui) = 0;
+
+    /**
+     * @brief Avisa que o conteúdo do bitmap mudou (ex.: um LayerCache recomposto).
+     * @details Backends que guardam cópias preparadas das texturas descartam as desse bitmap.
+     */
+    virtual void bitmapChanged(ALLEGRO_BITMAP* bitmap) { (void)bitmap; }
+
+    /**
+     * @brief Como al_draw_textf: formata o texto (até 255 caracteres, sem alocar) e chama drawText().
+     */
+    void drawTextf(const ALLEGRO_FONT* font, ALLEGRO_COLOR color, float x, float y, int flags, const char* format, ...);
+};
@@ -0,0 +1,80 @@
+/**
+ * @file ScreenTarget.hpp
+ * @brief Definição do ScreenTarget, o quadro de BUFFER_W x BUFFER_H apresentado em escala inteira na janela.
+ */
+#pragma once
+
+#include "managers/ResourceManager.hpp"
+#include <allegro5/allegro.h>
+
+/**
+ * @struct Letterbox
+ * @brief Onde o quadro do jogo aparece dentro da janela.
+ *
+ * A escala é inteira sempre que o quadro cabe pelo menos uma vez na janela,
+ * o que mantém os pixels nítidos; o que sobra vira faixas pretas. Só em
+ * janelas menores que o quadro a escala fica fracionária (menor que 1).
+ */
+struct Letterbox {
+    float scale; ///< Pixels da janela por pixel do quadro.
+    int x, y;    ///< Canto superior esquerdo do quadro na janela.
+    int width;   ///< Largura do quadro na janela.
+    int height;  ///< Altura do quadro na janela.
+
+    /**
+     * @brief Encaixa um quadro frameW x frameH numa janela windowW x windowH, centralizado.
+     */
+    static Letterbox fit(int windowW, int windowH, int frameW, int frameH);
+
+    /**
+     * @brief Converte uma posição da janela (ex.: o mouse) para coordenadas do quadro.
+     */
+    void toFrame(int& px, int& py) const;
+};
+
+/**
+ * @class ScreenTarget
+ * @brief Quadro fora da tela em que todas as cenas desenham, copiado para a janela de uma vez.
+ *
+ * As cenas continuam desenhando em BUFFER_W x BUFFER_H, com o mesmo custo por
+ * sprite em qualquer resolução. A cada quadro, present() limpa o backbuffer e
+ * faz uma única cópia escalada do quadro para o retângulo do Letterbox.
+ */
+class ScreenTarget {
+public:
+    /**
+     * @brief Cria o quadro fora da tela.
+     * @throw std::runtime_error se o bitmap não puder ser criado.
+     */
+    ScreenTarget(int width, int height);
+
+    /**
+     * @brief Recalcula o encaixe para o novo tamanho da janela.
+     */
+    void resize(int windowW, int windowH);
+
+    /**
+     * @brief Faz do quadro o alvo de desenho.
+     */
+    void begin();
+
+    /**
+     * @brief Copia o quadro para o backbuffer do display, com faixas pretas em volta.
+     * @details Não chama al_flip_display.
+     */
+    void present(ALLEGRO_DISPLAY* display);
+
+    /**
+     * @brief Converte a posição de um evento de mouse da janela para o quadro.
+     */
+    void toFrame(int& px, int& py) const { letterbox.toFrame(px, py); }
+
+    ALLEGRO_BITMAP* getBitmap() const { return frame.get(); }
+    const Letterbox& getLetterbox() const { return letterbox; }
+
+private:
+    BitmapPtr frame;
+    int width;
+    int height;
+    Letterbox letterbox;
+};
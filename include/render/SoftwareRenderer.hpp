@@ -0,0 +1,176 @@
+/**
+ * @file SoftwareRenderer.hpp
+ * @brief Definição do SoftwareRenderer, o backend para quando o quadro é um bitmap de memória (sem GPU).
+ */
+#pragma once
+
+#include "env/PixelRenderer.hpp"
+#include "render/AllegroRenderer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @struct PixelLayout
+ * @brief Onde cada canal fica num pixel de 32 bits lido como uint32_t.
+ */
+struct PixelLayout {
+    int shift[4]; ///< Deslocamento, em bits, de r, g, b e a.
+
+    /**
+     * @brief O layout de um formato do Allegro.
+     * @return false se o formato não for de 32 bits com alfa.
+     */
+    static bool of(int format, PixelLayout& layout);
+};
+
+/**
+ * @struct BlendTable
+ * @brief Resultado, para cada valor de cada byte, de misturar uma cor fixa sobre o pixel.
+ *
+ * Reproduz al_draw_filled_rectangle com o blender padrão (ONE, INVERSE_ALPHA):
+ * cada canal vira src + dst * (1 - alfa). Como a cor é a mesma para a tela
+ * inteira, o resultado só depende do valor do byte de destino, e a mistura
+ * vira quatro consultas de tabela por pixel.
+ */
+struct BlendTable {
+    uint8_t bytes[4][256]; ///< Resultado por byte do pixel (do menos para o mais significativo).
+
+    /**
+     * @param color A cor do retângulo, sem alfa pré-multiplicado, como a recebe al_draw_filled_rectangle.
+     */
+    static BlendTable forColor(ALLEGRO_COLOR color, const PixelLayout& layout);
+
+    uint32_t apply(uint32_t pixel) const
+    {
+        return bytes[0][pixel & 0xFF] | (bytes[1][(pixel >> 8) & 0xFF] << 8) |
+               (bytes[2][(pixel >> 16) & 0xFF] << 16) | (static_cast<uint32_t>(bytes[3][pixel >> 24]) << 24);
+    }
+
+    void applyRow(uint32_t* row, int count) const
+    {
+        for (int i = 0; i < count; ++i) row[i] = apply(row[i]);
+    }
+};
+
+/**
+ * @class SoftwareRenderer
+ * @brief AllegroRenderer com atalhos para o rasterizador em software do Allegro.
+ *
+ * Sem GPU, o Allegro desenha em bitmaps de memória, e as chamadas mais usadas
+ * pelo jogo ficam caras por pixel: o cano de cima girado em π, o pássaro girado
+ * a cada quadro e os retângulos translúcidos que cobrem a tela nos fades. Aqui,
+ * quando o alvo é de memória (e o blender e a transformação são os padrões):
+ *
+ * - os sprites viram PixelSprite (os mesmos trechos de linha do PixelRenderer)
+ *   e são desenhados com um memcpy por trecho direto no alvo travado;
+ * - rotações de π e espelhamentos usam uma cópia já espelhada do sprite;
+ * - as demais rotações de sprites pequenos usam cópias já giradas, com o
+ *   ângulo arredondado para múltiplos de ANGLE_STEP graus;
+ * - retângulos preenchidos de coordenadas inteiras usam uma BlendTable.
+ *
+ * Qualquer outra chamada (tinta, escala, texto, alvo de vídeo) vai para o
+ * AllegroRenderer, então o resultado é o mesmo, só mais rápido.
+ */
+class SoftwareRenderer : public AllegroRenderer {
+public:
+    static constexpr float ANGLE_STEP = 2.0f;   ///< Passo das rotações pré-calculadas, em graus.
+    static constexpr int ANGLE_COUNT = static_cast<int>(360 / ANGLE_STEP);
+    static constexpr int MAX_ROTATED_SIZE = 64; ///< Maior lado de um sprite que ganha cópias giradas.
+
+    /**
+     * @brief Contadores de quantas chamadas usaram cada caminho.
+     */
+    struct Stats {
+        uint64_t spanBlits = 0; ///< Sprites copiados por trechos.
+        uint64_t tableFills = 0; ///< Retângulos misturados pela tabela.
+        uint64_t tableBuilds = 0; ///< Tabelas calculadas (uma por cor nova; as repetidas só consultam).
+        uint64_t fallbacks = 0; ///< Chamadas repassadas ao AllegroRenderer.
+    };
+
+    void drawBitmap(ALLEGRO_BITMAP* bitmap, float x, float y, int flags) override;
+    void drawTintedScaledRotatedBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float cx, float cy,
+                                       float dx, float dy, float xscale, float yscale, float angle, int flags) override;
+    void drawFilledRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color) override;
+
+    /**
+     * @brief O ângulo (em radianos) arredondado para o passo de ANGLE_STEP graus, em [0, 360 / ANGLE_STEP).
+     */
+    static int quantizeAngle(float angle);
+
+    /**
+     * @brief Separa os trechos visíveis de uma imagem de 32 bits já no formato do alvo.
+     * @param data Primeira linha; pitch em bytes (negativo nos bitmaps travados de baixo para cima).
+     * @param alphaShift Deslocamento do alfa no pixel (ver PixelLayout).
+     * @return false se algum pixel for parcialmente transparente: o sprite precisa de mistura.
+     */
+    static bool buildSprite(const uint8_t* data, int pitch, int width, int height, int alphaShift,
+                            PixelSprite<uint32_t>& sprite);
+
+    /**
+     * @brief Copia os trechos opacos do sprite com o canto em (left, top), recortados ao retângulo de clip.
+     */
+    static void blitSprite(const PixelSprite<uint32_t>& sprite, uint8_t* target, int pitch,
+                           int clipX, int clipY, int clipW, int clipH, int left, int top);
+
+    /**
+     * @brief Descarta os sprites preparados a partir do bitmap, em todos os espelhamentos e ângulos.
+     */
+    void bitmapChanged(ALLEGRO_BITMAP* bitmap) override;
+
+    size_t getCachedSprites() const { return sprites.size(); }
+    const Stats& getStats() const { return stats; }
+    void resetStats() { stats = Stats(); }
+
+private:
+    /// Um sprite preparado: a textura, o espelhamento, o passo de rotação e o pivô.
+    struct Key {
+        ALLEGRO_BITMAP* bitmap;
+        int flags;
+        int angle;
+        float pivotX, pivotY;
+        int format;
+        bool operator==(const Key& other) const
+        {
+            return bitmap == other.bitmap && flags == other.flags && angle == other.angle &&
+                   pivotX == other.pivotX && pivotY == other.pivotY && format == other.format;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const
+        {
+            size_t h = std::hash<const void*>()(key.bitmap);
+            h = h * 31 + static_cast<size_t>(key.flags);
+            h = h * 31 + static_cast<size_t>(key.angle);
+            return h * 31 + static_cast<size_t>(key.format);
+        }
+    };
+
+    /// Um sprite preparado; usable é false se ele precisar de mistura (fica no cache para não ser refeito).
+    struct Prepared {
+        PixelSprite<uint32_t> sprite;
+        bool usable = false;
+    };
+
+    std::unordered_map<Key, Prepared, KeyHash> sprites;
+    Stats stats;
+
+    /// A última tabela de mistura e a cor e o layout para os quais ela foi calculada.
+    BlendTable fillTable;
+    ALLEGRO_COLOR fillColor = {0.0f, 0.0f, 0.0f, -1.0f}; // Alfa inválido: a primeira cor sempre calcula.
+    PixelLayout fillLayout = {{0, 0, 0, 0}};
+
+    /// A tabela da cor no layout, recalculada só quando um dos dois muda.
+    const BlendTable& blendTable(ALLEGRO_COLOR color, const PixelLayout& layout);
+
+    /// O sprite preparado para a chave, montando-o na primeira vez; nullptr se não puder ser copiado por trechos.
+    const PixelSprite<uint32_t>* prepare(const Key& key);
+    /**
+     * @brief Copia o sprite da chave no alvo atual, se ele for de memória com blender e transformação padrão.
+     * @param centered Se (x, y) é o centro do sprite preparado (rotações) em vez do canto.
+     */
+    bool blit(Key key, float x, float y, bool centered);
+};
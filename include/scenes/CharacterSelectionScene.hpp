@@ -7,6 +7,7 @@
 #include "core/Scene.hpp"
 #include "interfaces/IDrawable.hpp"
 #include "util/Theme.hpp"
+#include "render/LayerCache.hpp"
 #include <vector>
 #include <allegro5/allegro.h>
 #include <allegro5/allegro_font.h>
@@ -26,6 +27,13 @@ private:
 
     std::vector<int> positionsX;
 
+    mutable LayerCache staticLayer; ///< Fundo do tema, título e prévias dos pássaros; refeito ao trocar de tema.
+
+    /**
+     * @brief Desenha o que só muda com o tema: fundo, título e as prévias.
+     */
+    void drawStaticLayer() const;
+
     /**
      * @brief Constrói os objetos de Tema a partir do ResourceManager.
      */
@@ -14,16 +14,23 @@
 #include "actors/ParallaxBackground.hpp"
 #include "actors/Floor.hpp"
 #include "actors/PipePool.hpp"
+#include "actors/GhostBirds.hpp"
 #include "managers/ScoreManager.hpp"
 #include "actors/effects/SplashScreen.hpp"
 #include "actors/ui/GameOverScreen.hpp"
 #include "actors/ui/GetReadyUI.hpp"
 #include "actors/SoundButton.hpp"
 #include "core/GameSound.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Replay.hpp"
+#include "sim/RewindBuffer.hpp"
+#include "sim/GhostTrack.hpp"
+#include "sim/BeamPlanner.hpp"
+#include "env/BotController.hpp"
+#include "render/RenderQueue.hpp"
 #include "widgetz/widgetz.h"
 #include <memory>
 #include <vector>
-#include <random>
 
 enum class GameState {
     GAME_INIT,      // Jogo na tela inicial, esperando o jogador.
@@ -61,20 +68,48 @@ private:
 
     // --- Estado e Controle ---
     GameState state;
-    float timeSinceLastPipe;
     ALLEGRO_BITMAP* currentPipeTexture;
 
-    // --- Gerador de Números Aleatórios ---
-    std::mt19937 rng;
-    std::uniform_real_distribution<float> dist;
+    // --- Simulação ---
+    FixedGameSimulation simulation; ///< Regras do jogo em Q16.16 (replays valem em qualquer build); os atores só espelham o estado dela.
+    float tickAccumulator;     ///< Tempo de jogo ainda não simulado, em segundos.
+    bool jumpQueued;           ///< Pulo pedido pelo jogador, aplicado no próximo passo.
+    Replay replay;             ///< Gravação da partida atual (semente, pulos e hashes).
+    static constexpr int REPLAY_RESERVE_TICKS = static_cast<int>(10 * 60 * FPS); ///< 10 min de partida (cerca de 160 KB) gravados sem alocar.
+    FixedSimState checkpoint;  ///< Save state da partida (F5 salva, F9 volta para ele).
+    bool hasCheckpoint;        ///< Se checkpoint contém um estado válido desta partida.
+    RewindBuffer rewindBuffer; ///< Últimos segundos de jogo, para voltar no tempo.
+    bool rewindHeld;           ///< Se a tecla de rewind (Backspace) está pressionada.
+    bool assisted;             ///< Se a partida teve ajuda (piloto automático, bot, rewind ou checkpoint): fica fora do placar.
+
+    // --- Fantasmas ---
+    static constexpr int MAX_GHOSTS = 300;   ///< Recordes do placar carregados como fantasmas.
+    GhostTrackSet ghosts;                    ///< Trajetórias dos replays do placar na semente da corrida.
+    std::unique_ptr<GhostBirds> ghostBirds;  ///< Desenho em lote dos fantasmas.
+    uint64_t ghostSeed;                      ///< Semente dos replays carregados (a do líder do placar).
+    bool ghostsEnabled;                      ///< Se a partida é uma corrida contra os fantasmas (tecla G).
+
+    // --- Bot ---
+    std::unique_ptr<BotController> botPilot; ///< Instância do bot de --bot nesta partida (nullptr sem bot).
+    BeamPlanner planner;                     ///< Piloto automático por busca, usado no modo demonstração.
+    bool autopilotEnabled;                   ///< Se o piloto automático joga as próximas partidas (tecla A).
+
+    // --- Desenho ---
+    mutable RenderQueue renderQueue; ///< Comandos de desenho do cenário e dos pássaros, refeitos a cada quadro.
 
     // --- Tema ---
     const Theme& selectedTheme;
 
     // --- Métodos de Lógica Interna ---
+    void flap();
     void updatePlaying(float deltaTime);
-    void checkCollisions();
-    void spawnPipe();
+    void syncActors();
+    void saveReplay(bool personalBest);
+    void loadGhosts();
+    void saveCheckpoint();
+    void loadCheckpoint();
+    void updateRewind(float deltaTime);
+    void resumePlaying();
     void initiateDeathSequence();
     void restart();
     void initGUI();
@@ -92,4 +127,17 @@ public:
     void processEvent(const ALLEGRO_EVENT& event) override;
     void update(float deltaTime) override;
     void draw() const override;
+
+    /**
+     * @brief Recomeça a partida numa semente escolhida, em vez de uma aleatória.
+     * @details Os quadros de referência (tests/render/TestGoldenFrames.cpp) usam para
+     * desenhar a cena em percursos fixos.
+     * @param seed A semente do percurso.
+     */
+    void restart(uint64_t seed);
+
+    /**
+     * @brief Contadores de desenho do último quadro (comandos, recortes, draw calls e trocas de textura).
+     */
+    const RenderStats& getRenderStats() const { return renderQueue.getStats(); }
 };
\ No newline at end of file
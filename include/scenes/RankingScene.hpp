@@ -6,6 +6,7 @@
 
 #include "core/Scene.hpp"
 #include "widgetz/widgetz.h"
+#include "render/LayerCache.hpp"
 #include <allegro5/allegro_font.h>
 #include <allegro5/allegro.h>
 #include <vector>
@@ -22,6 +23,10 @@ private:
     ALLEGRO_BITMAP* title_image = nullptr;
     ALLEGRO_BITMAP* scoreboard_image = nullptr;
     ALLEGRO_FONT* text_font = nullptr;
+    mutable LayerCache staticLayer; ///< Fundo, título e placar vazio, compostos uma vez.
+    mutable std::vector<LayerCache> pageLayers; ///< O texto de cada página, do tamanho do placar.
+    float board_x = 0.0f; ///< Canto superior esquerdo do placar, calculado em buildUI().
+    float board_y = 0.0f;
 
     // --- Dados do Ranking ---
     std::vector<std::pair<std::string, int>> scores;
@@ -35,8 +40,15 @@ private:
     void buildUI();
 
     void loadDummyData();
-    
-    void drawScores() const;
+
+    /// Descarta as páginas compostas e prepara um cache vazio por página das pontuações atuais.
+    void rebuildPages();
+
+    /// Desenha as linhas da página atual com o canto do placar em (originX, originY).
+    void drawScores(float originX, float originY) const;
+
+    /// Desenha o fundo, o título e a moldura do placar (o conteúdo do staticLayer).
+    void drawStaticLayer() const;
 
 public:
     RankingScene(SceneManager* sceneManager);
@@ -45,4 +57,9 @@ public:
     void processEvent(const ALLEGRO_EVENT& event) override;
     void update(float deltaTime) override;
     void draw() const override;
+
+    /**
+     * @brief Substitui as pontuações exibidas (em vez das do ScoreSystem) e volta para a primeira página.
+     */
+    void setScores(std::vector<std::pair<std::string, int>> newScores);
 };
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * @file SpectatorScene.hpp
+ * @brief Definição da cena que assiste a uma partida transmitida com --broadcast.
+ */
+#pragma once
+
+#include "core/Scene.hpp"
+#include "util/Theme.hpp"
+#include "actors/Bird.hpp"
+#include "actors/ParallaxBackground.hpp"
+#include "actors/Floor.hpp"
+#include "actors/PipePool.hpp"
+#include "managers/ScoreManager.hpp"
+#include "net/SpectatorStream.hpp"
+#include "net/StreamSocket.hpp"
+#include <allegro5/allegro_font.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @class SpectatorScene
+ * @brief Desenha a partida recebida de um SpectatorBroadcast, um passo por 1/FPS segundo.
+ *
+ * Os registros chegam em rajadas (um envio a cada poucos quadros); os estados
+ * decodificados esperam em uma fila curta e são mostrados na velocidade do
+ * jogo. Se a fila crescer demais (o espectador ficou para trás), os estados
+ * mais antigos são descartados. Com --broadcast, cada estado mostrado também
+ * é retransmitido.
+ */
+class SpectatorScene : public Scene
+{
+private:
+    static constexpr size_t MAX_QUEUED = 12; ///< Estados na fila antes de descartar os antigos.
+
+    // --- Rede ---
+    StreamClient client;
+    SpectatorDecoder decoder;
+    SpectatorState shown;       ///< O estado desenhado.
+    bool hasState;              ///< Se algum estado já foi recebido.
+    float tickAccumulator;      ///< Tempo ainda não mostrado, em segundos.
+
+    // --- Entidades ---
+    std::vector<Theme> themes;
+    std::unique_ptr<Bird> bird;
+    std::unique_ptr<ParallaxBackground> background;
+    std::unique_ptr<Floor> floor;
+    PipePool pipePool;
+    std::unique_ptr<ScoreManager> scoreManager;
+    ALLEGRO_FONT* font;
+
+    void receive();
+    void syncActors();
+
+public:
+    /**
+     * @brief Construtor: conecta à transmissão.
+     * @param sceneManager Ponteiro para o gerenciador de cenas.
+     * @param address "host:porta" ou "unix:caminho".
+     * @throw std::runtime_error se a conexão falhar.
+     */
+    SpectatorScene(SceneManager* sceneManager, const std::string& address);
+    ~SpectatorScene();
+
+    // --- Implementação dos contratos de Scene ---
+    void processEvent(const ALLEGRO_EVENT& event) override;
+    void update(float deltaTime) override;
+    void draw() const override;
+};
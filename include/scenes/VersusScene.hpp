@@ -0,0 +1,77 @@
+/**
+ * @file VersusScene.hpp
+ * @brief Definição da cena do modo versus, dois jogadores em rede com rollback.
+ */
+#pragma once
+
+#include "core/Scene.hpp"
+#include "core/LaunchOptions.hpp"
+#include "core/GameSound.hpp"
+#include "util/Theme.hpp"
+#include "actors/Bird.hpp"
+#include "actors/ParallaxBackground.hpp"
+#include "actors/Floor.hpp"
+#include "actors/PipePool.hpp"
+#include "managers/ScoreManager.hpp"
+#include "net/LatencyInjector.hpp"
+#include "net/UdpSocket.hpp"
+#include "sim/RollbackSession.hpp"
+#include <allegro5/allegro_font.h>
+#include <memory>
+#include <vector>
+
+/**
+ * @class VersusScene
+ * @brief Partida de dois jogadores no mesmo percurso, sincronizada por uma RollbackSession.
+ *
+ * Cada processo controla um pássaro e envia seus pulos por UDP; o pássaro do
+ * rival aparece com o sprite de outro tema. O passo local nunca espera a rede:
+ * a sessão prevê as entradas do rival e re-simula quando elas chegam. Os
+ * pacotes enviados passam por um LatencyInjector, o que permite testar latência,
+ * jitter e perda com os dois processos no mesmo computador.
+ */
+class VersusScene : public Scene
+{
+private:
+    // --- Rede e Simulação ---
+    VersusOptions options;
+    UdpSocket socket;
+    LatencyInjector outgoing;                  ///< Rede artificial aplicada aos pacotes enviados.
+    std::unique_ptr<RollbackSession> session;  ///< Snapshots e entradas (alguns KB, fora da pilha).
+    uint32_t peerAck;                          ///< Até onde o rival já recebeu as entradas locais.
+    bool connected;                            ///< Se algum pacote do rival já chegou.
+    float tickAccumulator;                     ///< Tempo de jogo ainda não simulado, em segundos.
+    bool jumpQueued;                           ///< Pulo local aplicado no próximo passo.
+    uint32_t stalls;                           ///< Passos adiados esperando a rede.
+
+    // --- Entidades ---
+    std::vector<Theme> themes;
+    std::unique_ptr<Bird> localBird;
+    std::unique_ptr<Bird> remoteBird;
+    std::unique_ptr<ParallaxBackground> background;
+    std::unique_ptr<Floor> floor;
+    PipePool pipePool;
+    std::unique_ptr<ScoreManager> scoreManager;
+    std::unique_ptr<GameSound> gSound;
+    ALLEGRO_FONT* font;
+
+    // --- Métodos de Lógica Interna ---
+    void receivePackets();
+    void sendInputs();
+    void syncActors();
+
+public:
+    /**
+     * @brief Construtor: abre o socket e prepara a partida.
+     * @param sceneManager Ponteiro para o gerenciador de cenas.
+     * @param options Portas, endereço do rival, semente e rede artificial.
+     * @throw std::runtime_error se o socket não puder ser aberto.
+     */
+    VersusScene(SceneManager* sceneManager, const VersusOptions& options);
+    ~VersusScene();
+
+    // --- Implementação dos contratos de Scene ---
+    void processEvent(const ALLEGRO_EVENT& event) override;
+    void update(float deltaTime) override;
+    void draw() const override;
+};
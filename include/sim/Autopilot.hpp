@@ -0,0 +1,27 @@
+/**
+ * @file Autopilot.hpp
+ * @brief Piloto simples que gera as partidas dos testes e dos benchmarks.
+ */
+#pragma once
+
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+
+/**
+ * @brief Pula quando o pássaro cai abaixo do centro do próximo vão.
+ * @details Não é um bom jogador (morre em alguns percursos), mas é barato e
+ * determinístico: a mesma semente e o mesmo offset geram sempre a mesma
+ * partida, e offsets diferentes geram partidas diferentes no mesmo percurso.
+ * @tparam Scalar float ou Fixed.
+ * @param state O estado da partida antes do passo.
+ * @param offset Quantos pixels abaixo do centro do vão o pássaro mira.
+ * @return true para pular.
+ */
+template <typename Scalar>
+inline bool autopilot(const BasicSimState<Scalar>& state, float offset = 20.0f)
+{
+    const BasicPipeCourse<Scalar>& course = state.course;
+    const int p = course.firstAhead(Scalar(BIRD_START_X));
+    const float target = p < course.getCount() ? toFloat(course.getGapTop(p)) + PIPE_GAP / 2 + offset : BUFFER_H / 2.0f;
+    return state.phase == SimPhase::READY || (toFloat(state.birdY) > target && toFloat(state.birdVelY) > 0.0f);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file BeamPlanner.hpp
+ * @brief Definição do BeamPlanner, o piloto automático que planeja os pulos por busca em feixe.
+ */
+#pragma once
+
+#include "sim/GameSimulation.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class BeamPlanner
+ * @brief Escolhe o próximo pulo simulando as sequências de pulos mais promissoras.
+ *
+ * A cada chamada de plan() a busca parte de uma cópia do estado atual e avança
+ * HORIZON passos. Em cada nível, cada plano do feixe é expandido em "pula" e
+ * "não pula" (um passo da FixedGameSimulation a partir do snapshot do pai), e só os
+ * WIDTH melhores (e distintos entre si) seguem. A busca usa a mesma física em Q16.16 da
+ * GameScene e o estado inclui o gerador dos canos, então os passos e os canos que ainda
+ * vão surgir são exatamente os da partida real.
+ *
+ * Um plano vale mais quanto mais tempo sobrevive e quanto mais perto do centro
+ * do próximo vão o pássaro está. A decisão é o primeiro passo do melhor plano;
+ * no passo seguinte a busca é refeita (horizonte deslizante).
+ *
+ * Os feixes são pré-alocados no construtor: plan() só copia snapshots para
+ * posições já existentes e não aloca memória.
+ */
+class BeamPlanner {
+public:
+    static constexpr int DEFAULT_WIDTH = 64;   ///< Planos mantidos por nível (48 já perde percursos na física em Q16.16).
+    static constexpr int DEFAULT_HORIZON = 45; ///< Passos simulados à frente (1,5 s, mais que a distância entre canos).
+
+    /**
+     * @brief Pré-aloca os feixes.
+     * @param width Planos mantidos por nível.
+     * @param horizon Passos simulados à frente.
+     */
+    explicit BeamPlanner(int width = DEFAULT_WIDTH, int horizon = DEFAULT_HORIZON);
+
+    /**
+     * @brief Decide o próximo passo.
+     * @param state O estado atual da partida (não é alterado).
+     * @return true se o pássaro deve pular neste passo.
+     */
+    bool plan(const FixedSimState& state);
+
+    // --- Estatísticas ---
+    uint64_t getPlansEvaluated() const { return plansEvaluated; } ///< Planos completos (folhas) avaliados desde o início.
+    uint64_t getStepsSimulated() const { return stepsSimulated; } ///< Passos de simulação executados desde o início.
+    uint32_t getLastSurvival() const { return lastSurvival; }     ///< Passos que o melhor plano da última busca sobrevive.
+    int getWidth() const { return width; }
+    int getHorizon() const { return horizon; }
+
+private:
+    /// Um plano do feixe: o estado ao fim dos passos já simulados e o seu primeiro pulo.
+    struct Node {
+        FixedSimState state;
+        float value;
+        uint8_t firstJump;
+        uint8_t alive;
+    };
+
+    int width;
+    int horizon;
+    std::vector<Node> beam;     ///< Planos do nível atual (até width).
+    std::vector<Node> children; ///< Expansões do nível atual (até 2 * width).
+    FixedGameSimulation sim;    ///< Simulação reaproveitada para avançar cada filho.
+    uint64_t plansEvaluated;
+    uint64_t stepsSimulated;
+    uint32_t lastSurvival;
+
+    /**
+     * @brief Nota de um estado após depth passos: sobrevivência primeiro, depois pontos e distância ao vão.
+     */
+    static float evaluate(const FixedSimState& state, int depth);
+
+    static constexpr float VELOCITY_CELL = 20.0f; ///< Faixa de velocidade (pixels/s) em que dois planos são considerados iguais.
+
+    /**
+     * @brief Diz se dois planos levam o pássaro ao mesmo pixel com velocidade parecida.
+     */
+    static bool sameCell(const Node& a, const Node& b);
+};
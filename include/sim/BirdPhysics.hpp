@@ -0,0 +1,77 @@
+/**
+ * @file BirdPhysics.hpp
+ * @brief Núcleo da física do pássaro, compartilhado entre Bird e as simulações headless.
+ * @details As funções aqui não dependem do Allegro e são pequenas o bastante para
+ * serem inlinadas (e vetorizadas) dentro de laços sobre muitos pássaros.
+ *
+ * Todas são templates sobre o tipo escalar: float para o jogo e as simulações
+ * rápidas, Fixed (Q16.16) para o modo determinístico. As constantes do jogo
+ * são convertidas com Scalar(CONSTANTE), o que para Fixed acontece em tempo
+ * de compilação.
+ */
+#pragma once
+
+#include "Constants.hpp"
+
+/**
+ * @brief Aplica um passo de física com gravidade e velocidade terminal dadas.
+ * @tparam Scalar float ou Fixed.
+ * @param y Posição vertical do pássaro (atualizada).
+ * @param velY Velocidade vertical do pássaro (atualizada).
+ * @param deltaTime O tempo do passo, em segundos.
+ * @param gravity Aceleração da gravidade, em pixels/s².
+ * @param terminalVelocity Velocidade máxima de queda, em pixels/s.
+ */
+template <typename Scalar>
+inline void integrateBird(Scalar& y, Scalar& velY, Scalar deltaTime, Scalar gravity, Scalar terminalVelocity)
+{
+    velY += gravity * deltaTime;
+    velY = velY > terminalVelocity ? terminalVelocity : velY;
+    y += velY * deltaTime;
+}
+
+/**
+ * @brief Aplica um passo de física normal: gravidade, limite de velocidade terminal e movimento.
+ * @tparam Scalar float ou Fixed.
+ * @param y Posição vertical do pássaro (atualizada).
+ * @param velY Velocidade vertical do pássaro (atualizada).
+ * @param deltaTime O tempo do passo, em segundos.
+ */
+template <typename Scalar>
+inline void integrateBird(Scalar& y, Scalar& velY, Scalar deltaTime)
+{
+    constexpr Scalar gravity = Scalar(GRAVITY);
+    constexpr Scalar terminalVelocity = Scalar(TERMINAL_VELOCITY);
+    integrateBird(y, velY, deltaTime, gravity, terminalVelocity);
+}
+
+/**
+ * @brief Calcula o ângulo visual do pássaro a partir da sua velocidade vertical.
+ * @tparam Scalar float ou Fixed.
+ * @param velY A velocidade vertical atual.
+ * @return O ângulo em graus (positivo para cima, negativo para baixo).
+ */
+template <typename Scalar>
+inline Scalar birdAngleFor(Scalar velY)
+{
+    // Multiplicação por constantes no lugar da divisão: as duas ramificações podem
+    // ser calculadas sem risco (divisão pode gerar exceção de ponto flutuante) e o
+    // compilador consegue transformar a escolha numa seleção vetorizada.
+    constexpr Scalar UP_ANGLE_PER_VELOCITY = Scalar(MAX_UP_ANGLE / JUMP_IMPULSE_VELOCITY);
+    constexpr Scalar DOWN_ANGLE_PER_VELOCITY = Scalar(MAX_DOWN_ANGLE / TERMINAL_VELOCITY);
+    constexpr Scalar HALF_JUMP_VELOCITY = Scalar(JUMP_IMPULSE_VELOCITY / 2);
+    return velY < HALF_JUMP_VELOCITY ? velY * UP_ANGLE_PER_VELOCITY
+                                     : velY * DOWN_ANGLE_PER_VELOCITY;
+}
+
+/**
+ * @brief Verifica se o pássaro saiu da área jogável (teto ou chão).
+ * @tparam Scalar float ou Fixed.
+ * @param y Posição vertical do topo do pássaro.
+ * @param height Altura da hitbox do pássaro.
+ */
+template <typename Scalar>
+inline bool birdOutOfBounds(Scalar y, Scalar height)
+{
+    return (y + height >= Scalar(PLAYABLE_AREA_HEIGHT)) | (y <= Scalar(0));
+}
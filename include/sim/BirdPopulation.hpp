@@ -0,0 +1,91 @@
+/**
+ * @file BirdPopulation.hpp
+ * @brief Definição da BirdPopulation, uma simulação de milhares de pássaros no mesmo percurso.
+ */
+#pragma once
+
+#include "sim/PipeCourse.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class BasicBirdPopulation
+ * @brief Simula N pássaros independentes voando pelo mesmo PipeCourse.
+ *
+ * O estado é guardado como estrutura de arrays (SoA): um array contíguo para
+ * cada campo (y, velY, ângulo, vivo, pontuação). Assim o laço de física, que
+ * usa o mesmo núcleo do Bird::update, e o teste de colisão não têm desvios
+ * por pássaro e podem ser vetorizados pelo compilador (SSE/AVX/NEON).
+ *
+ * Todos os pássaros ficam na mesma coluna X (BIRD_START_X), então os canos que
+ * cruzam essa coluna são resolvidos uma única vez por passo e reduzidos a uma
+ * faixa livre [topo, base] que cada pássaro testa com duas comparações.
+ *
+ * Pássaros mortos ficam congelados e deixam de pontuar.
+ *
+ * @tparam Scalar float (BirdPopulation) ou Fixed (FixedBirdPopulation), cujo
+ * resultado é idêntico bit a bit em qualquer compilador, flag ou arquitetura.
+ */
+template <typename Scalar>
+class BasicBirdPopulation {
+public:
+    /**
+     * @brief Cria a população com todos os pássaros na posição inicial.
+     * @param size Número de pássaros.
+     */
+    explicit BasicBirdPopulation(size_t size);
+
+    /**
+     * @brief Recoloca todos os pássaros na posição inicial, vivos e com pontuação zero.
+     */
+    void reset();
+
+    /**
+     * @brief Executa um passo de jogo completo: canos, física, colisão e pontuação.
+     *
+     * A ordem é a mesma da GameScene: os canos andam, um novo cano pode surgir,
+     * os pássaros aplicam os pulos e a física e então colidem e pontuam.
+     *
+     * @param jumps Um byte por pássaro; diferente de zero faz o pássaro pular neste passo.
+     * Pode ser nullptr (ninguém pula).
+     * @param course O percurso compartilhado (atualizado).
+     * @param deltaTime O tempo do passo, em segundos.
+     * @return O número de pássaros ainda vivos.
+     */
+    size_t step(const uint8_t* jumps, BasicPipeCourse<Scalar>& course, Scalar deltaTime);
+
+    /**
+     * @brief Executa só a física, colisão e pontuação contra uma sequência de canos já posicionada.
+     * @param jumps Um byte por pássaro (ou nullptr).
+     * @param pipes Os canos, ordenados por X.
+     * @param passedPipes Quantos canos foram ultrapassados neste passo.
+     * @param deltaTime O tempo do passo, em segundos.
+     * @return O número de pássaros ainda vivos.
+     */
+    size_t stepBirds(const uint8_t* jumps, const BasicPipeSpan<Scalar>& pipes, int passedPipes, Scalar deltaTime);
+
+    // --- Getters ---
+    size_t size() const { return y.size(); }
+    size_t getAliveCount() const { return aliveCount; }
+    const Scalar* getY() const { return y.data(); }
+    const Scalar* getVelY() const { return velY.data(); }
+    const Scalar* getAngle() const { return angle.data(); }
+    const int32_t* getAlive() const { return alive.data(); }
+    const int32_t* getScore() const { return score.data(); }
+
+private:
+    std::vector<Scalar> y;      ///< Posição vertical de cada pássaro.
+    std::vector<Scalar> velY;   ///< Velocidade vertical de cada pássaro.
+    std::vector<Scalar> angle;  ///< Ângulo visual de cada pássaro, em graus.
+    std::vector<int32_t> alive; ///< 1 se o pássaro está vivo, 0 caso contrário.
+    std::vector<int32_t> score; ///< Canos ultrapassados por cada pássaro.
+    size_t aliveCount;
+};
+
+// Instanciadas em BirdPopulation.cpp.
+extern template class BasicBirdPopulation<float>;
+extern template class BasicBirdPopulation<Fixed>;
+
+using BirdPopulation = BasicBirdPopulation<float>;
+using FixedBirdPopulation = BasicBirdPopulation<Fixed>;
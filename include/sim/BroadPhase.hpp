@@ -0,0 +1,70 @@
+/**
+ * @file BroadPhase.hpp
+ * @brief Fase ampla (broad-phase) da colisão: encontra os canos que cruzam a coluna dos pássaros.
+ * @details Os canos andam todos à mesma velocidade e surgem sempre à direita, então
+ * qualquer sequência em ordem de geração também está ordenada por X. Com isso os
+ * canos candidatos a colisão formam um intervalo contíguo, achado por busca binária
+ * em O(log n) uma única vez por passo, independentemente de quantos pássaros existam.
+ */
+#pragma once
+
+#include "sim/PipeCourse.hpp"
+#include "Constants.hpp"
+
+/**
+ * @struct PipeWindow
+ * @brief Intervalo semiaberto [first, last) de índices de canos.
+ */
+struct PipeWindow {
+    int first; ///< Primeiro cano que pode colidir.
+    int last;  ///< Um além do último cano que pode colidir.
+
+    bool empty() const { return first >= last; }
+    int size() const { return last - first; }
+};
+
+/**
+ * @brief Busca binária pelos canos cuja coluna se sobrepõe a [left, right].
+ *
+ * O critério é o mesmo de pipeOverlapsColumn(): o cano i está na janela se
+ * x(i) + pipeWidth > left e x(i) < right.
+ *
+ * @tparam XOf Função (int) -> Scalar que retorna a borda esquerda do cano i.
+ * @tparam Scalar float ou Fixed.
+ * @param count Número de canos, ordenados por X crescente.
+ * @param xOf Acesso à borda esquerda de cada cano.
+ * @param left Borda esquerda da coluna dos pássaros.
+ * @param right Borda direita da coluna dos pássaros.
+ * @param pipeWidth Largura dos canos.
+ */
+template <typename XOf, typename Scalar>
+inline PipeWindow findPipeWindow(int count, XOf xOf, Scalar left, Scalar right, Scalar pipeWidth)
+{
+    // Primeiro cano cuja borda direita já passou da borda esquerda da coluna.
+    int lo = 0, hi = count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (xOf(mid) + pipeWidth > left) hi = mid;
+        else lo = mid + 1;
+    }
+    const int first = lo;
+
+    // Primeiro cano que começa depois da borda direita da coluna.
+    hi = count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (xOf(mid) < right) lo = mid + 1;
+        else hi = mid;
+    }
+    return PipeWindow{first, lo};
+}
+
+/**
+ * @brief Versão para uma PipeSpan, com a largura padrão dos canos.
+ */
+template <typename Scalar>
+inline PipeWindow findPipeWindow(const BasicPipeSpan<Scalar>& pipes, Scalar left, Scalar right)
+{
+    const Scalar* x = pipes.x;
+    return findPipeWindow(pipes.count, [x](int i) { return x[i]; }, left, right, Scalar(PIPE_WIDTH));
+}
@@ -0,0 +1,93 @@
+/**
+ * @file Fixed.hpp
+ * @brief Número em ponto fixo Q16.16 para a física determinística.
+ * @details Com float, o resultado de cada passo depende do compilador (contração
+ * em FMA, precisão estendida, flags de otimização), então replays e sessões em
+ * rede podem divergir entre builds. Em Q16.16 toda operação é aritmética inteira
+ * e o resultado é o mesmo bit a bit em -O0/-O3, x86 e ARM.
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @struct Fixed
+ * @brief Valor com sinal em Q16.16: 16 bits de parte inteira e 16 de fração.
+ *
+ * Cobre ±32768 com resolução de 1/65536, suficiente para posições em pixels e
+ * velocidades em pixels/s do jogo. A multiplicação usa um intermediário de 64
+ * bits e trunca em direção a -infinito (deslocamento aritmético, que é o
+ * comportamento do GCC, Clang e MSVC em todas as arquiteturas suportadas).
+ *
+ * É trivialmente copiável e tem o mesmo tamanho de um float, então pode
+ * substituir o float nos núcleos templados de BirdPhysics e PipePhysics.
+ */
+struct Fixed {
+    static constexpr int FRACTION_BITS = 16;
+    static constexpr int32_t ONE = 1 << FRACTION_BITS;
+
+    int32_t raw; ///< Valor multiplicado por 2^16.
+
+    Fixed() = default;
+
+    /**
+     * @brief Converte um float, arredondando para o valor representável mais próximo.
+     * @details Usado para as constantes do jogo, convertidas em tempo de compilação.
+     */
+    constexpr explicit Fixed(float value)
+        : raw(static_cast<int32_t>(value * ONE + (value < 0 ? -0.5f : 0.5f))) {}
+
+    /**
+     * @brief Converte um inteiro (exato).
+     */
+    constexpr explicit Fixed(int value) : raw(static_cast<int32_t>(static_cast<uint32_t>(value) << FRACTION_BITS)) {}
+
+    /**
+     * @brief Cria um Fixed diretamente a partir da representação interna.
+     */
+    static constexpr Fixed fromRaw(int32_t raw)
+    {
+        Fixed f{};
+        f.raw = raw;
+        return f;
+    }
+
+    /**
+     * @brief Converte para float (para desenho e depuração; não volta para a simulação).
+     */
+    constexpr float toFloat() const { return static_cast<float>(raw) * (1.0f / ONE); }
+
+    // --- Aritmética ---
+    // Soma e subtração são feitas em 32 bits sem sinal para que um eventual
+    // estouro dê a volta de forma definida, em vez de comportamento indefinido.
+    friend constexpr Fixed operator+(Fixed a, Fixed b)
+    {
+        return fromRaw(static_cast<int32_t>(static_cast<uint32_t>(a.raw) + static_cast<uint32_t>(b.raw)));
+    }
+    friend constexpr Fixed operator-(Fixed a, Fixed b)
+    {
+        return fromRaw(static_cast<int32_t>(static_cast<uint32_t>(a.raw) - static_cast<uint32_t>(b.raw)));
+    }
+    friend constexpr Fixed operator*(Fixed a, Fixed b)
+    {
+        return fromRaw(static_cast<int32_t>((static_cast<int64_t>(a.raw) * b.raw) >> FRACTION_BITS));
+    }
+    constexpr Fixed operator-() const { return Fixed(0) - *this; }
+    Fixed& operator+=(Fixed other) { return *this = *this + other; }
+    Fixed& operator-=(Fixed other) { return *this = *this - other; }
+    Fixed& operator*=(Fixed other) { return *this = *this * other; }
+
+    // --- Comparações ---
+    friend constexpr bool operator==(Fixed a, Fixed b) { return a.raw == b.raw; }
+    friend constexpr bool operator!=(Fixed a, Fixed b) { return a.raw != b.raw; }
+    friend constexpr bool operator<(Fixed a, Fixed b) { return a.raw < b.raw; }
+    friend constexpr bool operator>(Fixed a, Fixed b) { return a.raw > b.raw; }
+    friend constexpr bool operator<=(Fixed a, Fixed b) { return a.raw <= b.raw; }
+    friend constexpr bool operator>=(Fixed a, Fixed b) { return a.raw >= b.raw; }
+};
+
+/**
+ * @brief Converte um escalar da simulação (float ou Fixed) para float.
+ */
+inline float toFloat(float value) { return value; }
+inline float toFloat(Fixed value) { return value.toFloat(); }
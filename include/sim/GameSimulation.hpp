@@ -0,0 +1,165 @@
+/**
+ * @file GameSimulation.hpp
+ * @brief Definição da GameSimulation, a partida de um jogador sem Allegro e com passo fixo.
+ */
+#pragma once
+
+#include "sim/PipeCourse.hpp"
+#include "sim/SimParams.hpp"
+#include "Constants.hpp"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @enum SimPhase
+ * @brief Fase da partida simulada.
+ */
+enum class SimPhase : uint8_t {
+    READY,   ///< Esperando o primeiro pulo (equivale a GameState::GAME_INIT).
+    PLAYING, ///< Partida em andamento.
+    DEAD     ///< O pássaro colidiu; passos seguintes não mudam o estado.
+};
+
+/**
+ * @brief Eventos que um passo pode gerar, combinados como bits.
+ * @details A GameScene usa os eventos para tocar sons e disparar efeitos.
+ */
+enum SimEvent : uint8_t {
+    SIM_EVENT_NONE = 0,
+    SIM_EVENT_JUMP = 1 << 0,  ///< O pássaro pulou neste passo.
+    SIM_EVENT_SCORE = 1 << 1, ///< Um cano foi ultrapassado neste passo.
+    SIM_EVENT_DEATH = 1 << 2  ///< O pássaro colidiu neste passo.
+};
+
+/**
+ * @struct BasicSimState
+ * @brief Todo o estado que influencia a partida, em uma struct trivialmente copiável.
+ *
+ * Também é o formato dos snapshots: não há ponteiros nem alocação, então
+ * salvar e restaurar uma partida é um único memcpy de poucas centenas de bytes.
+ *
+ * @tparam Scalar float (SimState) ou Fixed (FixedSimState). Quem só lê o
+ * estado (desenho, bots) converte com toFloat() e aceita os dois.
+ */
+template <typename Scalar>
+struct BasicSimState {
+    uint32_t tick;    ///< Passos executados desde o primeiro pulo.
+    SimPhase phase;   ///< Fase atual.
+    int32_t score;    ///< Canos ultrapassados.
+    Scalar birdY;     ///< Posição vertical do pássaro.
+    Scalar birdVelY;  ///< Velocidade vertical do pássaro.
+    Scalar birdAngle; ///< Ângulo visual do pássaro, em graus.
+    BasicPipeCourse<Scalar> course; ///< Canos e gerador das alturas dos vãos.
+};
+
+using SimState = BasicSimState<float>;
+using FixedSimState = BasicSimState<Fixed>;
+
+static_assert(std::is_trivially_copyable<SimState>::value, "SimState precisa ser copiável com memcpy");
+static_assert(std::is_trivially_copyable<FixedSimState>::value, "FixedSimState precisa ser copiável com memcpy");
+
+/**
+ * @class BasicGameSimulation
+ * @brief Executa as regras da GameScene em passos fixos de 1/FPS segundo, sem desenho nem som.
+ *
+ * A mesma semente e a mesma sequência de pulos produzem sempre a mesma partida,
+ * o que permite gravar replays (só a semente e os pulos) e comparar execuções
+ * pelo hash do estado a cada passo. A GameScene usa esta classe como fonte da
+ * verdade do gameplay e apenas copia o resultado para os atores que desenham.
+ *
+ * Em float (GameSimulation) a partida só se repete no mesmo build: flags de
+ * otimização e contração em FMA mudam os últimos bits. Em Q16.16
+ * (FixedGameSimulation) o passo é só aritmética inteira e dá o mesmo resultado
+ * bit a bit em qualquer build; é a versão usada onde duas execuções precisam
+ * concordar (a GameScene, que grava replays, o ReplayVerifier, os fantasmas, o
+ * versus em rede e os espectadores). Os ambientes de treino e as varreduras de
+ * dificuldade usam float.
+ *
+ * @tparam Scalar float ou Fixed.
+ */
+template <typename Scalar>
+class BasicGameSimulation {
+public:
+    using State = BasicSimState<Scalar>;
+
+    static constexpr float TICK = 1.0f / FPS; ///< Duração de um passo, em segundos.
+    static constexpr Scalar SCALAR_TICK = Scalar(TICK); ///< TICK em Scalar, o passo usado pela física.
+
+    BasicGameSimulation() { setParams(SimParams()); }
+
+    /**
+     * @brief Reinicia a partida na fase READY, com o pássaro na posição inicial.
+     * @param seed Semente do percurso de canos.
+     */
+    void reset(uint64_t seed);
+
+    /**
+     * @brief Executa um passo.
+     *
+     * Na fase READY o passo só tem efeito se houver pulo, que inicia a partida.
+     * A ordem é a mesma da GameScene: canos andam, o pássaro pula e cai, um novo
+     * cano pode surgir, as colisões são testadas e os canos ultrapassados pontuam.
+     *
+     * @param jump true se o jogador pulou desde o último passo.
+     * @return Combinação de SimEvent ocorridos no passo.
+     */
+    uint8_t step(bool jump);
+
+    /**
+     * @brief Copia o estado atual para um snapshot.
+     * @details Um memcpy de sizeof(State) bytes; barato o bastante para que
+     * bots de busca ramifiquem a partida milhares de vezes por quadro.
+     * @param snapshot Destino da cópia.
+     */
+    void save(State& snapshot) const { std::memcpy(&snapshot, &state, sizeof(State)); }
+
+    /**
+     * @brief Restaura um snapshot salvo com save().
+     * @param snapshot O estado a restaurar.
+     */
+    void restore(const State& snapshot) { std::memcpy(&state, &snapshot, sizeof(State)); }
+
+    /**
+     * @brief Calcula o hash de 64 bits do estado atual (ver StateHash.hpp).
+     * @details Custa algumas dezenas de nanossegundos; pode ser chamado a cada passo.
+     */
+    uint64_t hash() const;
+
+    /**
+     * @brief Troca a física e o ritmo dos canos (ver SimParams).
+     * @details Os parâmetros não fazem parte do estado nem do hash: replays e
+     * snapshots só são comparáveis entre simulações com os mesmos parâmetros.
+     * O jogo sempre usa os padrões de Constants.hpp. Os valores são convertidos
+     * para Scalar aqui, uma vez, e não a cada passo.
+     */
+    void setParams(const SimParams& newParams);
+    const SimParams& getParams() const { return params; }
+
+    // --- Getters ---
+    const State& getState() const { return state; }
+    SimPhase getPhase() const { return state.phase; }
+    uint32_t getTick() const { return state.tick; }
+    int32_t getScore() const { return state.score; }
+
+private:
+    /// Os SimParams já em Scalar (o vão continua float: só entra no sorteio dos canos).
+    struct ScalarParams {
+        Scalar gravity;
+        Scalar jumpVelocity;
+        Scalar terminalVelocity;
+        Scalar pipeSpeed;
+        Scalar pipeInterval;
+    };
+
+    State state;
+    SimParams params;
+    ScalarParams scalarParams;
+};
+
+// Instanciadas em GameSimulation.cpp.
+extern template class BasicGameSimulation<float>;
+extern template class BasicGameSimulation<Fixed>;
+
+using GameSimulation = BasicGameSimulation<float>;
+using FixedGameSimulation = BasicGameSimulation<Fixed>;
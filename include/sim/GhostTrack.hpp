@@ -0,0 +1,95 @@
+/**
+ * @file GhostTrack.hpp
+ * @brief Definição do GhostTrackSet, as trajetórias compactas dos pássaros fantasmas.
+ */
+#pragma once
+
+#include "sim/Replay.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class GhostTrackSet
+ * @brief Trajetórias de muitos pássaros fantasmas, decodificadas em lock-step com a partida.
+ *
+ * Cada replay é simulado uma única vez, ao ser adicionado, e vira uma trajetória
+ * de posições: Y em quartos de pixel e ângulo em graus inteiros, gravados como
+ * diferenças entre passos consecutivos em varints zigzag (pouco mais de 2 bytes
+ * por passo). Durante a partida os fantasmas não rodam física: avançar um passo
+ * é decodificar uma diferença por fantasma.
+ *
+ * A cada KEYFRAME_INTERVAL passos há um quadro-chave com o valor absoluto, então
+ * pular para qualquer passo (rewind, save states) decodifica no máximo
+ * KEYFRAME_INTERVAL diferenças por fantasma. As posições ficam em arrays
+ * contíguos (SoA), prontos para serem desenhados em lote.
+ */
+class GhostTrackSet {
+public:
+    static constexpr float Y_SCALE = 4.0f;              ///< Unidades de Y por pixel.
+    static constexpr uint32_t KEYFRAME_INTERVAL = 64;   ///< Passos entre quadros-chave.
+
+    GhostTrackSet() { clear(); }
+
+    /**
+     * @brief Descarta todas as trajetórias.
+     */
+    void clear();
+
+    /**
+     * @brief Simula um replay e adiciona a trajetória do pássaro.
+     * @details A simulação é conferida contra os hashes gravados no replay.
+     * @param replay A partida gravada.
+     * @throw std::runtime_error se o replay não reproduzir os próprios hashes.
+     */
+    void add(const Replay& replay);
+
+    /**
+     * @brief Posiciona todos os fantasmas no mesmo passo da partida ao vivo.
+     * @details Avançar um passo é O(fantasmas); qualquer outro salto volta ao
+     * quadro-chave mais próximo.
+     * @param tick O passo da FixedGameSimulation (número de passos já simulados).
+     */
+    void setTick(uint32_t tick);
+
+    // --- Getters ---
+    size_t size() const { return tracks.size(); }
+    bool empty() const { return tracks.empty(); }
+    uint32_t getTick() const { return tick; }
+    size_t getEncodedBytes() const { return bytes.size(); }
+    bool isVisible(size_t ghost) const { return visible[ghost] != 0; }
+    float getY(size_t ghost) const { return static_cast<float>(y[ghost]) * (1.0f / Y_SCALE); }
+    float getAngle(size_t ghost) const { return static_cast<float>(angle[ghost]); }
+    int32_t getScore(size_t ghost) const { return tracks[ghost].finalScore; }
+
+private:
+    /// Estado absoluto de um quadro-chave e onde começam as diferenças seguintes.
+    struct Keyframe {
+        int32_t y;
+        int32_t angle;
+        uint32_t offset;
+    };
+
+    /// Onde a trajetória de um fantasma está em bytes e keyframes.
+    struct Track {
+        uint32_t length;       ///< Passos gravados (até a morte).
+        uint32_t firstKeyframe;
+        int32_t finalScore;
+    };
+
+    std::vector<uint8_t> bytes;        ///< Diferenças de todas as trajetórias.
+    std::vector<Keyframe> keyframes;   ///< Quadros-chave de todas as trajetórias.
+    std::vector<Track> tracks;
+
+    // --- Estado decodificado (SoA) ---
+    uint32_t tick;
+    std::vector<int32_t> y;
+    std::vector<int32_t> angle;
+    std::vector<uint32_t> cursor;      ///< Próximo byte de cada trajetória.
+    std::vector<uint8_t> visible;
+
+    /**
+     * @brief Decodifica a posição de um fantasma em um passo a partir do quadro-chave anterior.
+     */
+    void seekGhost(size_t ghost, uint32_t forTick);
+};
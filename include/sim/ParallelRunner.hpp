@@ -0,0 +1,81 @@
+/**
+ * @file ParallelRunner.hpp
+ * @brief Definição do ParallelRunner, que divide um laço de simulações entre vários núcleos.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class ParallelRunner
+ * @brief Executa um laço [0, count) dividido em fatias contíguas, uma por thread.
+ *
+ * As threads são criadas uma vez no construtor e ficam dormindo entre chamadas,
+ * então o custo de run() é só acordá-las e esperar a última fatia (alguns
+ * microssegundos), o que permite chamá-lo a cada passo de um lote de partidas.
+ * A thread que chama run() também processa uma fatia.
+ *
+ * A divisão depende só de count e do número de threads, e cada índice é
+ * processado por exatamente uma thread; se as tarefas forem independentes o
+ * resultado é o mesmo com qualquer número de threads.
+ */
+class ParallelRunner {
+public:
+    /// Tarefa que processa os índices [begin, end).
+    using Task = std::function<void(size_t begin, size_t end)>;
+
+    /**
+     * @brief Cria as threads de trabalho.
+     * @param threads Número total de threads (incluindo a que chama run()).
+     * 0 usa std::thread::hardware_concurrency().
+     */
+    explicit ParallelRunner(unsigned threads = 0);
+
+    /**
+     * @brief Encerra e aguarda as threads de trabalho.
+     */
+    ~ParallelRunner();
+
+    ParallelRunner(const ParallelRunner&) = delete;
+    ParallelRunner& operator=(const ParallelRunner&) = delete;
+
+    /**
+     * @brief Executa a tarefa sobre [0, count) e retorna quando todas as fatias terminarem.
+     * @param count Número de índices.
+     * @param task A tarefa; chamada no máximo uma vez por thread, com fatias disjuntas.
+     */
+    void run(size_t count, const Task& task);
+
+    /**
+     * @brief Retorna o número total de threads usadas por run().
+     */
+    unsigned getThreadCount() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;     ///< Acorda as threads quando há uma nova rodada.
+    std::condition_variable finished; ///< Avisa run() quando a última fatia termina.
+    const Task* task;                 ///< Tarefa da rodada atual.
+    size_t count;                     ///< Número de índices da rodada atual.
+    uint64_t round;                   ///< Incrementado a cada chamada de run().
+    unsigned pending;                 ///< Threads de trabalho que ainda não terminaram a rodada.
+    bool stopping;
+
+    /**
+     * @brief Calcula a fatia [begin, end) de uma thread.
+     */
+    void slice(unsigned index, size_t& begin, size_t& end) const;
+
+    /**
+     * @brief Laço de cada thread de trabalho: espera uma rodada, processa a fatia e avisa.
+     * @param index Índice da thread (1 em diante; 0 é a thread que chama run()).
+     */
+    void workerLoop(unsigned index);
+};
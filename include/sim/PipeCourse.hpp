@@ -0,0 +1,130 @@
+/**
+ * @file PipeCourse.hpp
+ * @brief Definição do PipeCourse, a versão headless (sem Allegro) do percurso de canos.
+ */
+#pragma once
+
+#include "sim/Fixed.hpp"
+#include "sim/SimRandom.hpp"
+#include "Constants.hpp"
+#include <cstdint>
+
+/**
+ * @struct BasicPipeSpan
+ * @brief Visão somente-leitura (SoA) de uma sequência de canos ordenada por X.
+ *
+ * Os arrays são paralelos: o cano i ocupa a coluna [x[i], x[i] + PIPE_WIDTH]
+ * e tem o vão entre gapTop[i] e gapBottom[i].
+ *
+ * @tparam Scalar float ou Fixed.
+ */
+template <typename Scalar>
+struct BasicPipeSpan {
+    const Scalar* x;         ///< Borda esquerda de cada cano.
+    const Scalar* gapTop;    ///< Início do vão (base do cano superior).
+    const Scalar* gapBottom; ///< Fim do vão (topo do cano inferior).
+    int count;               ///< Número de canos na sequência.
+};
+
+/**
+ * @class BasicPipeCourse
+ * @brief Percurso de canos com as mesmas regras de geração e movimento do PipePool.
+ *
+ * Guarda os canos ativos em arrays paralelos de capacidade fixa, na ordem em
+ * que foram gerados (portanto ordenados por X). Não aloca memória e é
+ * trivialmente copiável, o que permite que muitos pássaros compartilhem o
+ * mesmo percurso em simulações sem janela.
+ *
+ * @tparam Scalar float (PipeCourse) ou Fixed (FixedPipeCourse, determinístico).
+ */
+template <typename Scalar>
+class BasicPipeCourse {
+public:
+    static constexpr int CAPACITY = 8; ///< Máximo de canos simultâneos no percurso.
+
+    /**
+     * @brief Reinicia o percurso, sem canos e com o gerador na semente dada.
+     * @param seed Semente do gerador das alturas dos vãos.
+     */
+    void reset(uint64_t seed);
+
+    /**
+     * @brief Move os canos e descarta os que saíram da tela (equivalente a PipePool::update).
+     * @param deltaTime O tempo do passo, em segundos.
+     */
+    void advance(Scalar deltaTime) { advance(deltaTime, Scalar(PIPE_SPEED)); }
+
+    /**
+     * @brief Move os canos com outra velocidade (experimentos de dificuldade, ver SimParams).
+     * @param deltaTime O tempo do passo, em segundos.
+     * @param speed Velocidade horizontal dos canos, em pixels/s.
+     */
+    void advance(Scalar deltaTime, Scalar speed);
+
+    /**
+     * @brief Avança o temporizador de geração e cria um novo cano quando o intervalo vence.
+     * @param deltaTime O tempo do passo, em segundos.
+     * @return true se um cano foi gerado neste passo.
+     */
+    bool spawnIfDue(Scalar deltaTime) { return spawnIfDue(deltaTime, Scalar(PIPE_INTERVAL), PIPE_GAP); }
+
+    /**
+     * @brief Gera canos com outro intervalo e outro vão (experimentos de dificuldade, ver SimParams).
+     * @param deltaTime O tempo do passo, em segundos.
+     * @param interval Tempo entre dois canos, em segundos.
+     * @param gap Altura do vão, em pixels.
+     * @return true se um cano foi gerado neste passo.
+     */
+    bool spawnIfDue(Scalar deltaTime, Scalar interval, float gap);
+
+    /**
+     * @brief Marca como ultrapassados os canos cujo centro ficou para trás do pássaro.
+     * @param birdX A posição X do pássaro.
+     * @return O número de canos ultrapassados neste passo.
+     */
+    int collectPassed(Scalar birdX);
+
+    /**
+     * @brief Procura o primeiro cano que ainda não ficou totalmente para trás do pássaro.
+     * @param birdX A posição X do pássaro.
+     * @return O índice do cano, ou getCount() se não houver nenhum à frente.
+     */
+    int firstAhead(Scalar birdX) const;
+
+    /**
+     * @brief Retorna a visão SoA dos canos ativos, ordenados por X.
+     */
+    BasicPipeSpan<Scalar> span() const { return BasicPipeSpan<Scalar>{x, gapTop, gapBottom, count}; }
+
+    // --- Getters ---
+    int getCount() const { return count; }
+    Scalar getX(int i) const { return x[i]; }
+    Scalar getGapTop(int i) const { return gapTop[i]; }
+    Scalar getGapBottom(int i) const { return gapBottom[i]; }
+    bool hasPassed(int i) const { return passed[i] != 0; }
+    Scalar getTimeSinceLastPipe() const { return timeSinceLastPipe; }
+    const SimRandom& getRandom() const { return rng; }
+
+private:
+    Scalar x[CAPACITY];
+    Scalar gapTop[CAPACITY];
+    Scalar gapBottom[CAPACITY];
+    uint8_t passed[CAPACITY];
+    int count;
+    Scalar timeSinceLastPipe;
+    SimRandom rng;
+
+    /**
+     * @brief Remove o cano mais antigo (o primeiro da sequência).
+     */
+    void popFront();
+};
+
+// Instanciadas em PipeCourse.cpp.
+extern template class BasicPipeCourse<float>;
+extern template class BasicPipeCourse<Fixed>;
+
+using PipeSpan = BasicPipeSpan<float>;
+using PipeCourse = BasicPipeCourse<float>;
+using FixedPipeSpan = BasicPipeSpan<Fixed>;
+using FixedPipeCourse = BasicPipeCourse<Fixed>;
@@ -0,0 +1,52 @@
+/**
+ * @file PipePhysics.hpp
+ * @brief Núcleo do movimento e da colisão dos canos, compartilhado entre PipePair e as simulações headless.
+ * @details Assim como em BirdPhysics.hpp, as funções são templates sobre o tipo
+ * escalar (float ou Fixed).
+ */
+#pragma once
+
+#include "Constants.hpp"
+
+/**
+ * @brief Move um cano para a esquerda.
+ * @param x Posição X do cano (atualizada).
+ * @param speed Velocidade horizontal, em pixels/s.
+ * @param deltaTime O tempo do passo, em segundos.
+ */
+template <typename Scalar>
+inline void advancePipe(Scalar& x, Scalar speed, Scalar deltaTime)
+{
+    x -= speed * deltaTime;
+}
+
+/**
+ * @brief Indica se um cano já saiu completamente da tela pela esquerda.
+ */
+template <typename Scalar>
+inline bool pipeOffScreen(Scalar x, Scalar width)
+{
+    return x + width < Scalar(0);
+}
+
+/**
+ * @brief Indica se o intervalo horizontal do pássaro se sobrepõe ao do cano.
+ */
+template <typename Scalar>
+inline bool pipeOverlapsColumn(Scalar pipeLeft, Scalar pipeRight, Scalar birdLeft, Scalar birdRight)
+{
+    return (birdRight > pipeLeft) & (birdLeft < pipeRight);
+}
+
+/**
+ * @brief Indica se o pássaro está fora do vão de um cano cuja coluna ele ocupa.
+ * @param birdTop Topo da hitbox do pássaro.
+ * @param birdBottom Base da hitbox do pássaro.
+ * @param gapTop Coordenada Y onde o vão começa (base do cano superior).
+ * @param gapBottom Coordenada Y onde o vão termina (topo do cano inferior).
+ */
+template <typename Scalar>
+inline bool birdOutsideGap(Scalar birdTop, Scalar birdBottom, Scalar gapTop, Scalar gapBottom)
+{
+    return (birdTop < gapTop) | (birdBottom > gapBottom);
+}
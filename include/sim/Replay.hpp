@@ -0,0 +1,94 @@
+/**
+ * @file Replay.hpp
+ * @brief Definição do Replay, a gravação de uma partida da FixedGameSimulation.
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class Replay
+ * @brief Guarda a semente, os pulos e o hash do estado de cada passo de uma partida.
+ *
+ * Como a FixedGameSimulation é determinística, a semente e os pulos bastam para
+ * reproduzir a partida. Os hashes permitem verificar a reprodução passo a passo
+ * e apontar o primeiro passo em que duas execuções divergem.
+ *
+ * O arquivo é binário, little-endian: "FBRP", versão, semente, número de passos,
+ * pontuação final, um byte de pulo por passo e um hash de 8 bytes por passo.
+ */
+class Replay {
+public:
+    static constexpr uint32_t VERSION = 2; ///< 2: física em Q16.16; os hashes da versão 1 (float) não valem mais.
+
+    /**
+     * @brief Descarta a gravação atual e começa uma nova.
+     * @param seed A semente da partida.
+     */
+    void clear(uint64_t seed);
+
+    /**
+     * @brief Reserva espaço para uma partida de até ticks passos.
+     * @details clear() mantém a capacidade, então depois da reserva record() não
+     * aloca memória durante a partida nem entre uma partida e outra.
+     * @param ticks Número de passos a reservar.
+     */
+    void reserve(size_t ticks);
+
+    /**
+     * @brief Grava um passo.
+     * @param jump Se houve pulo no passo.
+     * @param stateHash O hash do estado depois do passo.
+     */
+    void record(bool jump, uint64_t stateHash);
+
+    /**
+     * @brief Descarta os passos gravados depois de um ponto.
+     * @details Usado ao voltar para um checkpoint: a gravação continua a partir dele.
+     * @param ticks Número de passos a manter.
+     */
+    void truncate(size_t ticks);
+
+    /**
+     * @brief Define a pontuação final (gravada para conferência).
+     */
+    void setFinalScore(int32_t score) { finalScore = score; }
+
+    /**
+     * @brief Retorna o primeiro passo em que os hashes das duas gravações diferem.
+     * @param other A outra gravação.
+     * @return O índice do passo, ou -1 se os passos em comum forem idênticos e
+     * as duas tiverem o mesmo tamanho.
+     */
+    long firstMismatch(const Replay& other) const;
+
+    /**
+     * @brief Salva a gravação em disco.
+     * @param path Caminho do arquivo.
+     * @throw std::runtime_error se o arquivo não puder ser escrito.
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief Carrega uma gravação do disco.
+     * @param path Caminho do arquivo.
+     * @throw std::runtime_error se o arquivo não existir ou for inválido.
+     */
+    static Replay load(const std::string& path);
+
+    // --- Getters ---
+    uint64_t getSeed() const { return seed; }
+    size_t getTickCount() const { return jumps.size(); }
+    size_t getCapacity() const { return jumps.capacity(); }
+    int32_t getFinalScore() const { return finalScore; }
+    bool getJump(size_t tick) const { return jumps[tick] != 0; }
+    uint64_t getHash(size_t tick) const { return hashes[tick]; }
+
+private:
+    uint64_t seed = 0;
+    int32_t finalScore = 0;
+    std::vector<uint8_t> jumps;   ///< 1 se houve pulo no passo.
+    std::vector<uint64_t> hashes; ///< Hash do estado depois de cada passo.
+};
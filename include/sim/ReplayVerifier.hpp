@@ -0,0 +1,91 @@
+/**
+ * @file ReplayVerifier.hpp
+ * @brief Definição do ReplayVerifier, que confere replays re-simulando as partidas.
+ */
+#pragma once
+
+#include "sim/ParallelRunner.hpp"
+#include "sim/Replay.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @enum ReplayStatus
+ * @brief Resultado da conferência de um replay.
+ */
+enum class ReplayStatus : uint8_t {
+    VALID,          ///< A re-simulação reproduz todos os hashes e a pontuação gravada.
+    HASH_MISMATCH,  ///< O estado re-simulado diverge do hash gravado em algum passo.
+    AFTER_DEATH,    ///< Há passos gravados depois da colisão.
+    SCORE_MISMATCH, ///< A pontuação gravada (ou a declarada) não é a que a partida fez.
+    UNREADABLE      ///< O arquivo não pôde ser lido (só em verifyFiles).
+};
+
+/**
+ * @struct ReplayCheck
+ * @brief Detalhes da conferência de um replay.
+ */
+struct ReplayCheck {
+    ReplayStatus status; ///< Resultado.
+    int32_t score;       ///< Pontuação que a re-simulação fez até o passo conferido.
+    uint32_t ticks;      ///< Passos re-simulados.
+    long tick;           ///< Primeiro passo com problema (-1 se não houver).
+
+    bool valid() const { return status == ReplayStatus::VALID; }
+};
+
+/**
+ * @class ReplayVerifier
+ * @brief Confere lotes de replays re-simulando cada um, dividido entre os núcleos.
+ *
+ * A FixedGameSimulation é determinística em qualquer build: a semente e os pulos
+ * de um replay reproduzem a partida inteira, então a pontuação não precisa ser confiada ao
+ * cliente. A conferência re-simula sem janela, compara o hash do estado a cada
+ * passo com o gravado (o que aponta o passo exato de uma edição) e compara a
+ * pontuação final com a gravada. Cada replay custa poucos microssegundos por
+ * segundo de jogo, o que permite a um servidor de placar conferir toda submissão.
+ */
+class ReplayVerifier {
+public:
+    /**
+     * @brief Prepara o verificador.
+     * @param threads Número de threads (0 = todos os núcleos).
+     */
+    explicit ReplayVerifier(unsigned threads = 0);
+
+    /**
+     * @brief Confere um lote de replays; a pontuação declarada é a gravada em cada um.
+     * @return Um resultado por replay, na mesma ordem.
+     */
+    std::vector<ReplayCheck> verify(const std::vector<Replay>& replays);
+
+    /**
+     * @brief Lê e confere um lote de arquivos de replay, também em paralelo.
+     * @return Um resultado por arquivo; arquivos inválidos voltam como UNREADABLE.
+     */
+    std::vector<ReplayCheck> verifyFiles(const std::vector<std::string>& paths);
+
+    /**
+     * @brief Confere um único replay na thread atual.
+     * @param replay O replay.
+     * @param claimedScore A pontuação que o jogador declara ter feito.
+     */
+    static ReplayCheck check(const Replay& replay, int32_t claimedScore);
+
+    /**
+     * @brief Confere um único replay contra a pontuação gravada nele.
+     */
+    static ReplayCheck check(const Replay& replay) { return check(replay, replay.getFinalScore()); }
+
+    /**
+     * @brief Descrição curta de um resultado, para mensagens.
+     */
+    static const char* describe(ReplayStatus status);
+
+    unsigned getThreadCount() const { return runner.getThreadCount(); }
+
+private:
+    ParallelRunner runner;
+};
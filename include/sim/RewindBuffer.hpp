@@ -0,0 +1,75 @@
+/**
+ * @file RewindBuffer.hpp
+ * @brief Definição do RewindBuffer, o histórico compacto usado para voltar no tempo.
+ */
+#pragma once
+
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class RewindBuffer
+ * @brief Anel de memória fixa com as diferenças entre snapshots consecutivos da FixedGameSimulation da GameScene.
+ *
+ * Cada passo grava o XOR entre o estado anterior e o novo, codificado como uma
+ * máscara dos blocos de 4 bytes que mudaram seguida só desses blocos (em média
+ * umas poucas dezenas de bytes, contra os sizeof(FixedSimState) de um snapshot).
+ * Como o XOR é reversível, voltar um passo é aplicar a diferença mais recente
+ * ao estado atual: não são necessários quadros-chave.
+ *
+ * Não há alocação: os bytes ficam em um array interno e, quando o anel enche,
+ * as diferenças mais antigas são descartadas. O tamanho garante pelo menos
+ * REWIND_SECONDS de histórico mesmo no pior caso (todos os blocos mudando).
+ */
+class RewindBuffer {
+public:
+    static constexpr int REWIND_SECONDS = 10;                               ///< Histórico garantido, em segundos.
+    static constexpr size_t MAX_TICKS = static_cast<size_t>(REWIND_SECONDS * FPS); ///< Passos guardados no máximo.
+    static constexpr size_t WORDS = (sizeof(FixedSimState) + 3) / 4;        ///< Blocos de 4 bytes por estado.
+    static constexpr size_t MASK_BYTES = (WORDS + 7) / 8;                   ///< Bytes da máscara de blocos alterados.
+    static constexpr size_t MAX_ENTRY_BYTES = MASK_BYTES + WORDS * 4;       ///< Pior caso de uma diferença.
+    static constexpr size_t BYTE_CAPACITY = MAX_TICKS * MAX_ENTRY_BYTES;    ///< Bytes do anel.
+
+    RewindBuffer() { clear(); }
+
+    /**
+     * @brief Descarta todo o histórico.
+     */
+    void clear();
+
+    /**
+     * @brief Grava a transição de um passo.
+     * @param previous O estado antes do passo.
+     * @param current O estado depois do passo (o mais recente).
+     */
+    void push(const FixedSimState& previous, const FixedSimState& current);
+
+    /**
+     * @brief Volta um passo no tempo.
+     * @param state O estado mais recente gravado; é transformado no anterior.
+     * @return false se não houver mais histórico (state fica inalterado).
+     */
+    bool stepBack(FixedSimState& state);
+
+    // --- Getters ---
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t getBytesUsed() const { return bytesUsed; }
+
+private:
+    uint8_t bytes[BYTE_CAPACITY];      ///< Diferenças codificadas, em anel.
+    uint16_t entrySizes[MAX_TICKS];    ///< Tamanho de cada diferença, em anel.
+    size_t firstEntry;                 ///< Índice da diferença mais antiga.
+    size_t count;                      ///< Diferenças guardadas.
+    size_t writePos;                   ///< Onde a próxima diferença começa em bytes.
+    size_t bytesUsed;                  ///< Bytes ocupados no anel.
+
+    /**
+     * @brief Descarta a diferença mais antiga.
+     */
+    void dropOldest();
+};
+
+static_assert(sizeof(RewindBuffer) <= 256 * 1024, "O histórico de rewind deve caber em 256 KB");
@@ -0,0 +1,112 @@
+/**
+ * @file RollbackSession.hpp
+ * @brief Definição da RollbackSession, o netcode com predição e rollback do modo versus.
+ */
+#pragma once
+
+#include "sim/VersusSimulation.hpp"
+#include <cstdint>
+
+/**
+ * @class RollbackSession
+ * @brief Avança a VersusSimulation sem esperar pela rede, corrigindo previsões erradas.
+ *
+ * No estilo do GGPO: o passo local nunca espera a entrada do outro jogador.
+ * Quando ela ainda não chegou, a sessão prevê "sem pulo" (o caso mais comum em
+ * Flappy Bird) e segue em frente. Antes de cada passo é guardado um snapshot
+ * (uma cópia de sizeof(VersusSimulation) bytes); quando a entrada real chega e
+ * difere da prevista, a sessão volta ao snapshot daquele passo e re-simula até
+ * o presente dentro do mesmo quadro.
+ *
+ * A sessão pode ficar no máximo MAX_PREDICTION passos à frente da última entrada
+ * remota confirmada; além disso advance() recusa o passo e o jogo espera a rede.
+ * Não há sockets aqui: quem usa a sessão entrega as entradas remotas com
+ * addRemoteInput() e lê as locais com getLocalInput() (ver net/VersusPacket.hpp).
+ */
+class RollbackSession {
+public:
+    static constexpr uint32_t MAX_PREDICTION = 16;              ///< Passos à frente das entradas remotas confirmadas.
+    static constexpr uint32_t INPUT_WINDOW = 64;                ///< Entradas guardadas por jogador, em anel.
+    static constexpr uint32_t SNAPSHOTS = MAX_PREDICTION + 1;   ///< Snapshots guardados, em anel.
+
+    /**
+     * @brief Inicia uma nova partida.
+     * @param seed Semente do percurso (a mesma nos dois jogadores).
+     * @param localPlayer Índice do jogador local (0 ou 1).
+     */
+    void start(uint64_t seed, int localPlayer);
+
+    /**
+     * @brief Indica se o próximo passo pode ser simulado sem exceder a predição máxima.
+     */
+    bool canAdvance() const { return currentTick < remoteConfirmed + MAX_PREDICTION; }
+
+    /**
+     * @brief Aplica o rollback pendente, se houver, e simula um passo com a entrada local.
+     * @param localJump Se o jogador local pulou neste passo.
+     * @return false se a sessão está MAX_PREDICTION passos à frente e precisa esperar a rede.
+     */
+    bool advance(bool localJump);
+
+    /**
+     * @brief Volta ao passo da previsão errada mais antiga e re-simula até o presente.
+     * @details Chamado por advance(); pode ser chamado sozinho para corrigir o
+     * estado desenhado enquanto a sessão espera a rede.
+     * @return Quantos passos foram re-simulados (0 se nenhuma previsão errou).
+     */
+    uint32_t rollback();
+
+    /**
+     * @brief Entrega a entrada real do jogador remoto em um passo.
+     * @details Entradas repetidas ou já confirmadas são ignoradas, então o mesmo
+     * passo pode chegar em vários pacotes.
+     * @param tick O passo da entrada.
+     * @param jump Se o jogador remoto pulou.
+     */
+    void addRemoteInput(uint32_t tick, bool jump);
+
+    /**
+     * @brief Retorna a entrada local de um passo já simulado.
+     * @param tick Um passo em [getTick() - INPUT_WINDOW, getTick()).
+     */
+    bool getLocalInput(uint32_t tick) const { return localInputs[tick % INPUT_WINDOW] != 0; }
+
+    /**
+     * @brief Indica se o estado atual é definitivo (todas as entradas remotas chegaram).
+     */
+    bool isConfirmed() const { return remoteConfirmed >= currentTick && pendingRollback == NO_ROLLBACK; }
+
+    // --- Getters ---
+    const VersusSimulation& getSimulation() const { return sim; }
+    int getLocalPlayer() const { return localPlayer; }
+    uint32_t getTick() const { return currentTick; }
+    uint32_t getRemoteConfirmed() const { return remoteConfirmed; }
+    uint32_t getRollbackCount() const { return rollbackCount; }
+    uint64_t getResimulatedTicks() const { return resimulatedTicks; }
+    uint32_t getLastRollback() const { return lastRollback; }
+    uint32_t getMaxRollback() const { return maxRollback; }
+
+private:
+    static constexpr uint32_t NO_ROLLBACK = UINT32_MAX;
+
+    VersusSimulation sim;                   ///< O estado atual (previsto, se faltar alguma entrada remota).
+    VersusSimulation snapshots[SNAPSHOTS];  ///< Estado antes de cada um dos últimos passos.
+    uint8_t localInputs[INPUT_WINDOW];      ///< Pulos locais por passo.
+    uint8_t remoteInputs[INPUT_WINDOW];     ///< Pulos remotos por passo: reais ou previstos.
+    uint8_t remoteKnown[INPUT_WINDOW];      ///< Se a entrada remota do passo já chegou (só passos >= remoteConfirmed).
+    int localPlayer;
+    uint32_t currentTick;                   ///< Próximo passo a simular.
+    uint32_t remoteConfirmed;               ///< Todas as entradas remotas antes deste passo chegaram.
+    uint32_t pendingRollback;               ///< Passo da previsão errada mais antiga, ou NO_ROLLBACK.
+
+    // --- Estatísticas ---
+    uint32_t rollbackCount;
+    uint64_t resimulatedTicks;
+    uint32_t lastRollback;
+    uint32_t maxRollback;
+
+    /**
+     * @brief Guarda o snapshot do passo e o simula com as entradas gravadas.
+     */
+    void simulateTick(uint32_t tick);
+};
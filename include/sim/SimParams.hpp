@@ -0,0 +1,24 @@
+/**
+ * @file SimParams.hpp
+ * @brief Definição dos SimParams, as constantes de dificuldade que a GameSimulation aceita em tempo de execução.
+ */
+#pragma once
+
+#include "Constants.hpp"
+
+/**
+ * @struct SimParams
+ * @brief Física do pássaro e ritmo dos canos usados por uma GameSimulation.
+ *
+ * Os valores padrão são os de Constants.hpp, que continuam sendo os do jogo,
+ * dos replays e do placar. Outros valores servem para experimentos de
+ * balanceamento (ver DifficultySweep) sem recompilar.
+ */
+struct SimParams {
+    float gravity = GRAVITY;                     ///< Aceleração da gravidade (pixels/s²).
+    float jumpVelocity = JUMP_IMPULSE_VELOCITY;  ///< Velocidade vertical aplicada ao pular (pixels/s, negativa).
+    float terminalVelocity = TERMINAL_VELOCITY;  ///< Velocidade máxima de queda (pixels/s).
+    float pipeSpeed = PIPE_SPEED;                ///< Velocidade horizontal dos canos (pixels/s).
+    float pipeGap = PIPE_GAP;                    ///< Altura do vão entre os canos (pixels).
+    float pipeInterval = PIPE_INTERVAL;          ///< Tempo entre dois canos (segundos).
+};
@@ -0,0 +1,42 @@
+/**
+ * @file SimRandom.hpp
+ * @brief Gerador de números pseudoaleatórios determinístico usado pelas simulações.
+ */
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @struct SimRandom
+ * @brief Gerador splitmix64 com estado de 8 bytes.
+ *
+ * Diferente de std::mt19937 + std::uniform_real_distribution, a sequência gerada
+ * é idêntica em qualquer compilador e biblioteca padrão, e o estado é um POD
+ * que pode ser copiado, comparado e salvo junto com o restante da simulação.
+ */
+struct SimRandom {
+    uint64_t state; ///< Estado interno do gerador.
+
+    /**
+     * @brief Reinicia o gerador a partir de uma semente.
+     * @param seed A semente da sequência.
+     */
+    void seed(uint64_t seed) { state = seed; }
+
+    /**
+     * @brief Gera o próximo inteiro de 64 bits da sequência.
+     */
+    uint64_t next()
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * @brief Gera um float uniforme no intervalo [0, 1).
+     * @details Usa os 24 bits mais altos, que cabem exatamente na mantissa de um float.
+     */
+    float nextFloat() { return static_cast<float>(next() >> 40) * (1.0f / 16777216.0f); }
+};
@@ -0,0 +1,82 @@
+/**
+ * @file StateHash.hpp
+ * @brief Checksum incremental do estado da simulação, no estilo do xxHash64.
+ * @details Cada passo da simulação gera um hash de 64 bits do estado completo.
+ * Comparando a sequência de hashes é possível achar o primeiro passo em que
+ * duas execuções divergem: entre builds, entre a simulação headless e o jogo
+ * com janela, ou entre dois jogadores em rede.
+ */
+#pragma once
+
+#include "sim/Fixed.hpp"
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @class StateHasher
+ * @brief Acumula palavras de 64 bits com as rodadas do xxHash64.
+ *
+ * Não é o xxHash64 de um buffer de bytes (não há blocos de 32 bytes nem
+ * cauda), mas usa as mesmas constantes, rodada e avalanche final. Os campos são
+ * adicionados um a um, pelo valor dos bits, então bytes de preenchimento das
+ * structs nunca entram no resultado.
+ */
+class StateHasher {
+public:
+    explicit StateHasher(uint64_t seed = 0) : acc(seed + PRIME5) {}
+
+    /**
+     * @brief Adiciona uma palavra de 64 bits.
+     */
+    void add(uint64_t value)
+    {
+        acc ^= round(value);
+        acc = rotl(acc, 27) * PRIME1 + PRIME4;
+    }
+
+    /**
+     * @brief Adiciona dois valores de 32 bits empacotados em uma só palavra.
+     */
+    void add(uint32_t low, uint32_t high) { add(static_cast<uint64_t>(high) << 32 | low); }
+
+    /**
+     * @brief Retorna os bits de um float (a comparação é bit a bit, não por valor).
+     */
+    static uint32_t bits(float value)
+    {
+        uint32_t b;
+        std::memcpy(&b, &value, sizeof(b));
+        return b;
+    }
+
+    /**
+     * @brief Retorna a representação Q16.16 de um Fixed.
+     */
+    static uint32_t bits(Fixed value) { return static_cast<uint32_t>(value.raw); }
+
+    /**
+     * @brief Finaliza e retorna o hash.
+     */
+    uint64_t digest() const
+    {
+        uint64_t h = acc;
+        h ^= h >> 33;
+        h *= PRIME2;
+        h ^= h >> 29;
+        h *= PRIME3;
+        h ^= h >> 32;
+        return h;
+    }
+
+private:
+    static constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t PRIME3 = 0x165667B19E3779F9ull;
+    static constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ull;
+    static constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ull;
+
+    uint64_t acc;
+
+    static uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+    static uint64_t round(uint64_t lane) { return rotl(lane * PRIME2, 31) * PRIME1; }
+};
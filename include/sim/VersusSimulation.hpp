@@ -0,0 +1,64 @@
+/**
+ * @file VersusSimulation.hpp
+ * @brief Definição da VersusSimulation, a partida de dois jogadores no mesmo percurso.
+ */
+#pragma once
+
+#include "sim/GameSimulation.hpp"
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @class VersusSimulation
+ * @brief Duas FixedGameSimulations com a mesma semente, avançadas em lock-step.
+ *
+ * Cada jogador tem o seu pássaro e a sua cópia do percurso; como a semente é a
+ * mesma, os canos são idênticos. A física é Q16.16 para que as duas máquinas
+ * da sessão em rede calculem os mesmos passos mesmo com builds diferentes. A partida começa com um pulo dos dois no
+ * passo 0 e termina quando os dois pássaros morrem.
+ *
+ * A classe é trivialmente copiável: um snapshot é uma cópia do objeto inteiro,
+ * o que o rollback da RollbackSession usa a cada passo.
+ */
+class VersusSimulation {
+public:
+    static constexpr int PLAYERS = 2;
+
+    /**
+     * @brief Reinicia a partida com os dois jogadores em READY.
+     * @param seed Semente do percurso (a mesma nos dois processos).
+     */
+    void reset(uint64_t seed);
+
+    /**
+     * @brief Executa um passo para os dois jogadores.
+     * @param jumps Pulo de cada jogador neste passo.
+     */
+    void step(const bool jumps[PLAYERS]);
+
+    /**
+     * @brief Hash do estado dos dois jogadores (ver StateHash.hpp).
+     */
+    uint64_t hash() const;
+
+    /**
+     * @brief Indica se a partida acabou (os dois pássaros morreram).
+     */
+    bool isOver() const;
+
+    /**
+     * @brief Retorna o vencedor: o jogador com mais pontos ou, no empate, o que morreu depois.
+     * @return 0 ou 1, ou -1 se a partida terminou empatada ou ainda não acabou.
+     */
+    int getWinner() const;
+
+    // --- Getters ---
+    const FixedGameSimulation& getPlayer(int player) const { return players[player]; }
+    uint32_t getTick() const { return tick; }
+
+private:
+    FixedGameSimulation players[PLAYERS];
+    uint32_t tick;
+};
+
+static_assert(std::is_trivially_copyable<VersusSimulation>::value, "VersusSimulation precisa ser copiável com memcpy");
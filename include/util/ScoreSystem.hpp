@@ -11,6 +11,8 @@
 #include <map>
 #include <stdexcept>
 
+class Replay;
+
 /**
  * @class NameException
  * @brief Exceção customizada para erros de validação de nome de jogador.
@@ -68,6 +70,21 @@ public:
      * @throw ScoreException se a pontuação estiver fora do intervalo permitido.
      */
     void registerOrUpdateScore(const std::string& name, int score);
+
+    /**
+     * @brief Registra uma pontuação só depois de conferi-la re-simulando o replay da partida.
+     *
+     * A pontuação vem da re-simulação (ver ReplayVerifier::check), não da palavra
+     * do cliente: o replay precisa reproduzir todos os hashes gravados e fazer
+     * exatamente a pontuação declarada.
+     *
+     * @param name O nome do jogador.
+     * @param score A pontuação declarada.
+     * @param replay O replay da partida, com a pontuação final gravada.
+     * @throw NameException se o nome for inválido.
+     * @throw ScoreException se a pontuação estiver fora do intervalo ou o replay não a confirmar.
+     */
+    void registerVerifiedScore(const std::string& name, int score, const Replay& replay);
     
     /**
      * @brief Obtém uma lista das melhores pontuações, ordenadas da maior para a menor.
@@ -24,4 +24,12 @@ struct Theme {
     ALLEGRO_BITMAP* floor;                     ///< Bitmap da base/chão.
     ALLEGRO_BITMAP* pipe;                      ///< Bitmap do cano.
     std::string music_path;           ///< Amostra de áudio para a música de fundo do tema.
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Monta os temas do jogo a partir dos assets já carregados pelo ResourceManager.
+ * @details Usado pela tela de seleção e pelo modo versus, que desenha o rival
+ * com o pássaro de outro tema.
+ * @return Os temas na ordem em que aparecem na seleção.
+ */
+std::vector<Theme> buildDefaultThemes();
@@ -13,6 +13,7 @@
 #include "util/Theme.hpp"
 #include "core/PlayerData.hpp"
 #include "util/ScoreSystem.hpp"
+#include "render/Renderer.hpp"
 #include <iostream>
 #include <allegro5/allegro_image.h>
 
@@ -226,12 +227,13 @@ void StartMenu::draw() const
 {
     if (background_image)
     {
-        al_draw_bitmap(background_image, 0, 0, 0);
+        // O fundo é opaco e cobre a tela: copiado sem mistura de cores.
+        Renderer::current().copyBitmap(background_image, 0, 0);
     }
 
     if (gui)
     {
-        wz_draw(gui);
+        Renderer::current().drawGui(gui);
     }
 
     if (flappyLogo)
@@ -4,10 +4,12 @@
  */
 
 #include "actors/Bird.hpp"
-#include <allegro5/allegro_primitives.h>
 #include <iostream>
 #include <cmath>
 #include "Constants.hpp"
+#include "sim/BirdPhysics.hpp"
+#include "render/RenderQueue.hpp"
+#include "render/Renderer.hpp"
 
 Bird::Bird(float x, float y, float w, float h, std::vector<ALLEGRO_BITMAP *> frames) : GameObject(x, y, w, h),
                                                                                        frames(frames)
@@ -20,14 +22,26 @@ void Bird::draw() const
 {
     if (frames.empty()) {
         std::cerr << "Erro: Vetor de frames do pássaro está vazio!" << std::endl;
-        al_draw_filled_rectangle(x, y, x + width, y + height, al_map_rgb(255, 0, 0));
+        Renderer::current().drawFilledRectangle(x, y, x + width, y + height, al_map_rgb(255, 0, 0));
         return;
     }
 
     float radian_angles = angle * (ALLEGRO_PI / 180.0f);
     int frameToDraw = isDying ? 1 : currentFrameIndex; // Se estiver morrendo, trava no frame 1 (asas paradas)
 
-    al_draw_rotated_bitmap(frames[frameToDraw], width / 2, height / 2, x + width / 2, y + height / 2, -radian_angles, 0);
+    Renderer::current().drawTintedScaledRotatedBitmap(frames[frameToDraw], al_map_rgb(255, 255, 255), width / 2, height / 2,
+                                                      x + width / 2, y + height / 2, 1.0f, 1.0f, -radian_angles, 0);
+}
+
+void Bird::submit(RenderQueue& queue) const
+{
+    if (frames.empty()) return;
+
+    float radian_angles = angle * (ALLEGRO_PI / 180.0f);
+    int frameToDraw = isDying ? 1 : currentFrameIndex;
+
+    queue.drawRotated(RenderLayer::BIRD, frames[frameToDraw], al_map_rgba_f(1.0f, 1.0f, 1.0f, 1.0f),
+                      width / 2, height / 2, x + width / 2, y + height / 2, -radian_angles);
 }
 
 void Bird::update(float deltaTime)
@@ -50,18 +64,11 @@ void Bird::update(float deltaTime)
     }
     else if (physicsEnabled) {
         // Se a física normal está ativa (durante o jogo).
-        velY += GRAVITY * deltaTime;
-        if (velY > TERMINAL_VELOCITY) {
-            velY = TERMINAL_VELOCITY;
-        }
-        y += velY * deltaTime;
+        // O núcleo é o mesmo usado pela simulação headless (sim/BirdPhysics.hpp).
+        integrateBird(y, velY, deltaTime);
         
         // O cálculo do ângulo só acontece quando a física está ativa.
-        if (velY < JUMP_IMPULSE_VELOCITY / 2) {
-            angle = (velY / (JUMP_IMPULSE_VELOCITY) * MAX_UP_ANGLE);
-        } else {
-            angle = (velY / TERMINAL_VELOCITY) * MAX_DOWN_ANGLE;
-        }
+        angle = birdAngleFor(velY);
     }
     
     // 2. LÓGICA DE ANIMAÇÃO
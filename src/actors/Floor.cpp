@@ -1,6 +1,8 @@
 #include "actors/Floor.hpp"
 #include "Constants.hpp"
-#include <allegro5/allegro_primitives.h>
+#include "render/RenderQueue.hpp"
+#include "render/Renderer.hpp"
+#include <algorithm>
 #include <iostream>
 
 /**
@@ -10,7 +12,10 @@
  * @param texture Ponteiro para o bitmap do Allegro que será usado como textura do chão.
  * @throw std::runtime_error Se o ponteiro da textura for nulo.
  */
-Floor::Floor(ALLEGRO_BITMAP *texture) : GameObject(0, PLAYABLE_AREA_HEIGHT, BUFFER_W, FLOOR_HEIGHT)
+Floor::Floor(ALLEGRO_BITMAP *texture)
+    : GameObject(0, PLAYABLE_AREA_HEIGHT, BUFFER_W, FLOOR_HEIGHT),
+      strip(texture ? BUFFER_W + al_get_bitmap_width(texture) : 0,
+            texture ? std::min(al_get_bitmap_height(texture), BUFFER_H - PLAYABLE_AREA_HEIGHT) : 0)
 {
     if (!texture) {
         // Garante que o objeto não seja criado com uma textura inválida.
@@ -19,6 +24,17 @@ Floor::Floor(ALLEGRO_BITMAP *texture) : GameObject(0, PLAYABLE_AREA_HEIGHT, BUFF
     this->texture = texture;
 }
 
+/**
+ * @brief Compõe a faixa do chão: a textura em 0 e de novo em `width`, como as duas cópias de draw().
+ * @details A textura é mais alta que a parte visível do chão; as linhas abaixo da tela ficam de fora.
+ */
+ALLEGRO_BITMAP* Floor::getStrip() const {
+    return strip.get(texture, [this] {
+        Renderer::current().drawBitmap(texture, 0, 0, 0);
+        Renderer::current().drawBitmap(texture, width, 0, 0);
+    });
+}
+
 /**
  * @brief Desenha o chão na tela.
  * @details Implementa um efeito de scroll contínuo. Desenha a textura principal na posição (x, y)
@@ -26,13 +42,34 @@ Floor::Floor(ALLEGRO_BITMAP *texture) : GameObject(0, PLAYABLE_AREA_HEIGHT, BUFF
  * para preencher o espaço vazio, criando a ilusão de um chão infinito.
  */
 void Floor::draw() const {
+    // Com o cache, a faixa cobre o chão visível para qualquer x em [-width, 0] num só blit.
+    if (ALLEGRO_BITMAP* cached = getStrip()) {
+        Renderer::current().drawBitmap(cached, x, y, 0);
+        return;
+    }
+
     // Desenha a primeira instância da textura do chão.
-    al_draw_bitmap(texture, x, y, 0);
+    Renderer::current().drawBitmap(texture, x, y, 0);
 
     // Se a primeira instância já começou a sair pela esquerda da tela (x < 0),
     // desenha uma segunda instância logo em seguida para criar o loop visual.
     if(x < 0){
-        al_draw_bitmap(texture, x + width, y, 0);
+        Renderer::current().drawBitmap(texture, x + width, y, 0);
+    }
+}
+
+/**
+ * @brief Envia o chão para a fila de desenho, com as mesmas cópias de draw().
+ * @param queue A fila do quadro.
+ */
+void Floor::submit(RenderQueue& queue) const {
+    if (ALLEGRO_BITMAP* cached = getStrip()) {
+        queue.draw(RenderLayer::FLOOR, cached, x, y);
+        return;
+    }
+    queue.draw(RenderLayer::FLOOR, texture, x, y);
+    if (x < 0) {
+        queue.draw(RenderLayer::FLOOR, texture, x + width, y);
     }
 }
 
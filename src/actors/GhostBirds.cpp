@@ -0,0 +1,57 @@
+/**
+ * @file GhostBirds.cpp
+ * @brief Implementação do desenho em lote dos fantasmas.
+ */
+#include "actors/GhostBirds.hpp"
+#include "Constants.hpp"
+#include "render/RenderQueue.hpp"
+#include "render/Renderer.hpp"
+
+GhostBirds::GhostBirds(const GhostTrackSet& tracks, std::vector<ALLEGRO_BITMAP*> frames, float alpha)
+    : tracks(tracks), frames(frames), tint(al_map_rgba_f(1.0f, 1.0f, 1.0f, alpha)),
+      frameTime(0.1f), animationTime(0.0f)
+{
+}
+
+void GhostBirds::update(float deltaTime)
+{
+    animationTime += deltaTime;
+}
+
+void GhostBirds::draw() const
+{
+    if (frames.empty() || tracks.empty()) return;
+
+    const size_t frameCount = frames.size();
+    const size_t baseFrame = static_cast<size_t>(animationTime / frameTime);
+    const float halfW = BIRD_WIDTH / 2.0f;
+    const float halfH = BIRD_HEIGHT / 2.0f;
+
+    Renderer& renderer = Renderer::current();
+    renderer.holdDrawing(true);
+    for (size_t g = 0; g < tracks.size(); ++g) {
+        if (!tracks.isVisible(g)) continue;
+        // Cada fantasma com a animação defasada, para não baterem asas em uníssono.
+        ALLEGRO_BITMAP* frame = frames[(baseFrame + g) % frameCount];
+        const float radians = tracks.getAngle(g) * (ALLEGRO_PI / 180.0f);
+        renderer.drawTintedScaledRotatedBitmap(frame, tint, halfW, halfH, BIRD_START_X + halfW, tracks.getY(g) + halfH, 1.0f, 1.0f, -radians, 0);
+    }
+    renderer.holdDrawing(false);
+}
+
+void GhostBirds::submit(RenderQueue& queue) const
+{
+    if (frames.empty() || tracks.empty()) return;
+
+    const size_t frameCount = frames.size();
+    const size_t baseFrame = static_cast<size_t>(animationTime / frameTime);
+    const float halfW = BIRD_WIDTH / 2.0f;
+    const float halfH = BIRD_HEIGHT / 2.0f;
+
+    for (size_t g = 0; g < tracks.size(); ++g) {
+        if (!tracks.isVisible(g)) continue;
+        ALLEGRO_BITMAP* frame = frames[(baseFrame + g) % frameCount];
+        const float radians = tracks.getAngle(g) * (ALLEGRO_PI / 180.0f);
+        queue.drawRotated(RenderLayer::GHOSTS, frame, tint, halfW, halfH, BIRD_START_X + halfW, tracks.getY(g) + halfH, -radians);
+    }
+}
@@ -3,11 +3,14 @@
  * @brief Implementação dos métodos da classe ParallaxBackground.
  */
 #include "actors/ParallaxBackground.hpp"
+#include "render/RenderQueue.hpp"
+#include "render/Renderer.hpp"
 
 ParallaxBackground::ParallaxBackground(ALLEGRO_BITMAP* image, float scrollSpeed)
     : GameObject(0, 0, 0, 0),
       texture(image),
-      speed(scrollSpeed) 
+      speed(scrollSpeed),
+      strip(image ? 2 * al_get_bitmap_width(image) : 0, image ? al_get_bitmap_height(image) : 0)
 {
     // As dimensões do objeto são herdadas da própria imagem
     if (texture) {
@@ -28,14 +31,42 @@ void ParallaxBackground::update(float deltaTime)
     }
 }
 
+ALLEGRO_BITMAP* ParallaxBackground::getStrip() const
+{
+    return strip.get(texture, [this] {
+        Renderer::current().drawBitmap(texture, 0, 0, 0);
+        Renderer::current().drawBitmap(texture, width, 0, 0);
+    });
+}
+
 void ParallaxBackground::draw() const
 {
     if (!texture) return;
 
+    // Uma única cópia da faixa cobre a tela inteira para qualquer x em (-width, 0].
+    if (ALLEGRO_BITMAP* cached = getStrip()) {
+        Renderer::current().copyBitmap(cached, x, y);
+        return;
+    }
+
     // Desenha a primeira instância da imagem na posição atual de 'x'.
-    al_draw_bitmap(texture, x, y, 0);
+    Renderer::current().drawBitmap(texture, x, y, 0);
     
     // Desenha uma segunda instância da imagem exatamente à direita da primeira.
     // Isso cria a ilusão de um fundo contínuo enquanto 'x' se move.
-    al_draw_bitmap(texture, x + width, y, 0);
-}
\ No newline at end of file
+    Renderer::current().drawBitmap(texture, x + width, y, 0);
+}
+
+void ParallaxBackground::submit(RenderQueue& queue) const
+{
+    if (!texture) return;
+
+    if (ALLEGRO_BITMAP* cached = getStrip()) {
+        queue.copy(RenderLayer::BACKGROUND, cached, x, y);
+        return;
+    }
+
+    // As mesmas duas cópias de draw(); quando a primeira cobre a tela toda, a fila descarta a segunda.
+    queue.draw(RenderLayer::BACKGROUND, texture, x, y);
+    queue.draw(RenderLayer::BACKGROUND, texture, x + width, y);
+}
@@ -3,7 +3,8 @@
  * @brief Implementação dos métodos da classe Pipe.
  */
 #include "actors/Pipe.hpp"
-#include <allegro5/allegro_primitives.h>
+#include "render/RenderQueue.hpp"
+#include "render/Renderer.hpp"
 #include <iostream>
 
 Pipe::Pipe(float y, float width, float height, PipeType type, ALLEGRO_BITMAP* texture)
@@ -14,14 +15,27 @@ Pipe::Pipe(float y, float width, float height, PipeType type, ALLEGRO_BITMAP* te
 
 void Pipe::draw(float x) const {
     if (!texture) {
-        al_draw_filled_rectangle(x, this->y, x + this->width, this->y + this->height, al_map_rgb(0, 255, 0));
+        Renderer::current().drawFilledRectangle(x, this->y, x + this->width, this->y + this->height, al_map_rgb(0, 255, 0));
         return;
     }
     
     if (pipeType == PipeType::TOP) {
-        al_draw_rotated_bitmap(texture, width / 2, height / 2, x + width / 2, y + height / 2, ALLEGRO_PI, 0);
+        Renderer::current().drawTintedScaledRotatedBitmap(texture, al_map_rgb(255, 255, 255), width / 2, height / 2,
+                                                          x + width / 2, y + height / 2, 1.0f, 1.0f, ALLEGRO_PI, 0);
     } 
     else {
-        al_draw_bitmap(texture, x, y, 0);
+        Renderer::current().drawBitmap(texture, x, y, 0);
     }
-}
\ No newline at end of file
+}
+
+void Pipe::submit(RenderQueue& queue, float x) const {
+    if (pipeType == PipeType::TOP) {
+        // A base do sprite girado fica na borda de baixo do cano (y + height).
+        const float textureHeight = texture ? al_get_bitmap_height(texture) : height;
+        queue.draw(RenderLayer::PIPES, texture, x, y + height - textureHeight,
+                   ALLEGRO_FLIP_HORIZONTAL | ALLEGRO_FLIP_VERTICAL);
+    }
+    else {
+        queue.draw(RenderLayer::PIPES, texture, x, y);
+    }
+}
@@ -6,6 +6,8 @@
 #include "actors/Bird.hpp"
 #include "Constants.hpp"
 #include "managers/ResourceManager.hpp"
+#include "sim/PipePhysics.hpp"
+#include "render/RenderQueue.hpp"
 
 PipePair::PipePair() 
     : GameObject(0, 0, PIPE_WIDTH, 0), // A altura do par não é relevante
@@ -38,8 +40,8 @@ void PipePair::reset()
 void PipePair::update(float deltaTime)
 {
     if (!active) return;
-    x -= speed * deltaTime;
-    if (x + width < 0) {
+    advancePipe(x, speed, deltaTime);
+    if (pipeOffScreen(x, width)) {
         active = false;
     }
 }
@@ -51,6 +53,13 @@ void PipePair::draw() const
     bottomPipe.draw(this->x);
 }
 
+void PipePair::submit(RenderQueue& queue) const
+{
+    if (!active) return;
+    topPipe.submit(queue, this->x);
+    bottomPipe.submit(queue, this->x);
+}
+
 bool PipePair::isColliding(const Bird& bird) const
 {
     if (!active) return false;
@@ -63,16 +72,10 @@ bool PipePair::isColliding(const Bird& bird) const
     const float pipeLeft = this->x;
     const float pipeRight = this->x + this->width;
 
-    // Colisão com cano superior
-    if (birdRight > pipeLeft && birdLeft < pipeRight && birdTop < topPipe.getY() + topPipe.getHeight()) {
-        return true;
-    }
-    // Colisão com cano inferior
-    if (birdRight > pipeLeft && birdLeft < pipeRight && birdBottom > bottomPipe.getY()) {
-        return true;
-    }
-
-    return false;
+    // Colisão com o cano superior ou inferior: o pássaro ocupa a coluna do cano
+    // e não está inteiramente dentro do vão. O mesmo teste é usado pela simulação headless.
+    return pipeOverlapsColumn(pipeLeft, pipeRight, birdLeft, birdRight) &&
+           birdOutsideGap(birdTop, birdBottom, topPipe.getY() + topPipe.getHeight(), bottomPipe.getY());
 }
 
 bool PipePair::hasPassed(const Bird& bird)
@@ -4,6 +4,8 @@
  */
 
 #include "actors/PipePool.hpp"
+#include "render/RenderQueue.hpp"
+#include "Constants.hpp"
 #include <iostream>
 
 /**
@@ -16,6 +18,7 @@ PipePool::PipePool(size_t initialSize)
     {
         pool.push_back(std::make_unique<PipePair>());
     }
+    activeInOrder.reserve(initialSize);
 }
 
 /**
@@ -29,6 +32,9 @@ PipePair* PipePool::getPipe()
     {
         if (!pipePair->isActive())
         {
+            // O cano entregue será ativado logo em seguida (PipePair::init) na borda direita,
+            // então ele entra no fim da ordem de X.
+            activeInOrder.push_back(pipePair.get());
             return pipePair.get();
         }
     }
@@ -36,9 +42,33 @@ PipePair* PipePool::getPipe()
     // Se não houver canos inativos, cria um novo e adiciona ao pool
     std::cout << "Criando novo PipePair, pois não há canos inativos. Canos no pool: " << pool.size() << std::endl;
     pool.push_back(std::make_unique<PipePair>());
+    activeInOrder.push_back(pool.back().get());
     return pool.back().get();
 }
 
+/**
+ * @brief Reposiciona os canos do pool a partir de um percurso simulado.
+ * @param pipes Os canos da simulação.
+ * @param pipeTexture Textura dos canos.
+ */
+void PipePool::syncFrom(const FixedPipeSpan& pipes, ALLEGRO_BITMAP* pipeTexture)
+{
+    // O i-ésimo cano ativo espelha o i-ésimo cano do percurso. Os pares continuam ativos
+    // de um passo para o outro e são atualizados no lugar; só os que sobram voltam ao pool.
+    const size_t count = static_cast<size_t>(pipes.count);
+    while (activeInOrder.size() > count)
+    {
+        activeInOrder.back()->reset();
+        activeInOrder.pop_back();
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        PipePair* pipePair = i < activeInOrder.size() ? activeInOrder[i] : getPipe();
+        const float gapTop = toFloat(pipes.gapTop[i]);
+        pipePair->init(toFloat(pipes.x[i]), gapTop, toFloat(pipes.gapBottom[i]) - gapTop, PIPE_SPEED, pipeTexture);
+    }
+}
+
 /**
  * @brief Atualiza todos os PipePairs do pool.
  * @param deltaTime Tempo decorrido desde a última atualização.
@@ -49,6 +79,14 @@ void PipePool::update(float deltaTime)
     {
         pipePair->update(deltaTime);
     }
+
+    // Os canos saem da tela na mesma ordem em que entraram: basta descartar os do início.
+    size_t expired = 0;
+    while (expired < activeInOrder.size() && !activeInOrder[expired]->isActive())
+    {
+        ++expired;
+    }
+    activeInOrder.erase(activeInOrder.begin(), activeInOrder.begin() + expired);
 }
 
 /**
@@ -62,6 +100,19 @@ void PipePool::draw() const
     }
 }
 
+/**
+ * @brief Envia os canos ativos para a fila de desenho.
+ * @param queue A fila do quadro.
+ */
+void PipePool::submit(RenderQueue& queue) const
+{
+    // Só os canos entregues e ainda ativos; os inativos do pool nem são visitados.
+    for (const PipePair* pipePair : activeInOrder)
+    {
+        pipePair->submit(queue);
+    }
+}
+
 /**
  * @brief Reseta todos os PipePairs do pool para o estdo inicial.
  */
@@ -69,4 +120,5 @@ void PipePool::reset() {
     for (auto& pipePair : pool) {
         pipePair->reset();
     }
+    activeInOrder.clear();
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
  */
 
 #include "actors/SoundButton.hpp"
+#include "render/Renderer.hpp"
 #include <allegro5/allegro.h>
 #include <iostream>
 
@@ -21,7 +22,7 @@ void SoundButton::draw() const {
     ALLEGRO_BITMAP* img = muted ? img_off : img_on;
     if (img) {
         // Desenha o bitmap escalonado para caber nas dimensões do botão
-        al_draw_scaled_bitmap(
+        Renderer::current().drawScaledBitmap(
             img,
             0, 0,
             al_get_bitmap_width(img), al_get_bitmap_height(img),
@@ -5,7 +5,7 @@
 
 #include "actors/effects/SplashScreen.hpp"
 #include "Constants.hpp"
-#include <allegro5/allegro_primitives.h>
+#include "render/Renderer.hpp"
 
 SplashScreen::SplashScreen(float duration, ALLEGRO_COLOR flashColor)
     // O GameObject em si pode ter tamanho 0, pois usamos o buffer para desenhar
@@ -45,7 +45,7 @@ void SplashScreen::draw() const {
     a_color.a = currentAlpha;
 
     // Desenha um retângulo que preenche a tela inteira
-    al_draw_filled_rectangle(0, 0, BUFFER_W, BUFFER_H, a_color);
+    Renderer::current().drawFilledRectangle(0, 0, BUFFER_W, BUFFER_H, a_color);
 }
 
 void SplashScreen::reset() {
@@ -4,7 +4,7 @@
  */
 #include "actors/effects/TransitionEffect.hpp"
 #include "Constants.hpp"
-#include <allegro5/allegro_primitives.h>
+#include "render/Renderer.hpp"
 
 TransitionEffect::TransitionEffect(ALLEGRO_COLOR fadeColor, float fadeDuration)
     : state(FadeState::IDLE),
@@ -51,5 +51,5 @@ void TransitionEffect::draw() const {
     ALLEGRO_COLOR a_color = color;
     a_color.a = currentAlpha;
     
-    al_draw_filled_rectangle(0, 0, BUFFER_W, BUFFER_H, a_color);
+    Renderer::current().drawFilledRectangle(0, 0, BUFFER_W, BUFFER_H, a_color);
 }
\ No newline at end of file
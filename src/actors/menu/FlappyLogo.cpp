@@ -4,6 +4,7 @@
  */
 #include "actors/menu/FlappyLogo.hpp"
 #include "Constants.hpp"
+#include "render/Renderer.hpp"
 #include <cmath>
 
 FlappyLogo::FlappyLogo(float x, float y, float w, float h, ALLEGRO_BITMAP *logo, std::vector<ALLEGRO_BITMAP *> frames) 
@@ -41,10 +42,10 @@ void FlappyLogo::draw() const
     // --- 1. Desenha o logo de texto "Flappy Bird" ---
     // Ele é desenhado na posição (x, y) flutuante do objeto.
     if (logoTexture) {
-        al_draw_scaled_bitmap(logoTexture,
-                              0, 0, al_get_bitmap_width(logoTexture), al_get_bitmap_height(logoTexture),
-                              this->x, this->y,
-                              this->width, this->height, 0);
+        Renderer::current().drawScaledBitmap(logoTexture,
+                                             0, 0, al_get_bitmap_width(logoTexture), al_get_bitmap_height(logoTexture),
+                                             this->x, this->y,
+                                             this->width, this->height, 0);
     }
 
     // --- 2. Desenha o pássaro animado ---
@@ -56,6 +57,6 @@ void FlappyLogo::draw() const
         float bird_x = this->x + this->width + spacing;
         float bird_y = this->y + (this->height / 2) - (BIRD_HEIGHT / 2);
 
-        al_draw_bitmap(birdFrames[currentFrameIndex], bird_x, bird_y, 0);
+        Renderer::current().drawBitmap(birdFrames[currentFrameIndex], bird_x, bird_y, 0);
     }
 }
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "actors/ui/GameOverScreen.hpp"
 #include "managers/ResourceManager.hpp"
 #include "Constants.hpp"
+#include "render/Renderer.hpp"
 #include <cmath>
 
 
@@ -19,7 +20,8 @@
 GameOverScreen::GameOverScreen(const ScoreManager& scManager)
     : scoreManagerRef(scManager),
       gameOverGO(0,0,0,0),
-      scoreBoardGO(0,0,0,0)
+      scoreBoardGO(0,0,0,0),
+      boardLayer(0, 0)
 {
     ResourceManager& rm = ResourceManager::getInstance();
 
@@ -43,6 +45,8 @@ GameOverScreen::GameOverScreen(const ScoreManager& scManager)
         scoreBoardGO.setX((BUFFER_W - scoreBoardGO.getWidth()) / 2.0f); // Centraliza horizontalmente.
         this->scoreBoard_endY = 180.0f;
         this->scoreBoard_startY = -scoreBoardGO.getHeight(); // Inicia fora da tela, acima.
+        boardLayer = LayerCache(static_cast<int>(std::ceil(scoreBoardGO.getWidth())),
+                                static_cast<int>(std::ceil(scoreBoardGO.getHeight())));
     }
 
     this->animationDuration = 0.6f; // Duração para cada estágio da animação em segundos.
@@ -64,6 +68,7 @@ void GameOverScreen::startSequence(int score, int best) {
         this->bestScore = best;
     }
     determineMedal(); // Seleciona a medalha com base na pontuação final.
+    boardLayer.invalidate(); // O placar é composto de novo, com os números desta partida.
 
     // Prepara a máquina de estados para iniciar a animação.
     this->elapsedTime = 0.0f;
@@ -85,6 +90,7 @@ void GameOverScreen::reset() {
     this->newBestScore = false;
     this->finalScore = 0;
     this->bestScore = 0;
+    boardLayer.invalidate();
 }
 
 /**
@@ -141,72 +147,97 @@ void GameOverScreen::update(float deltaTime) {
  */
 void GameOverScreen::draw() const {
     if (currentState == AnimationState::INACTIVE) return;
+    Renderer& renderer = Renderer::current();
 
     // 1. Desenha o bitmap "Game Over" durante sua animação e depois.
     if (gameOverTexture) {
-        al_draw_bitmap(gameOverTexture, gameOverGO.getX(), gameOverGO.getY(), 0);
+        renderer.drawBitmap(gameOverTexture, gameOverGO.getX(), gameOverGO.getY(), 0);
     }
 
     // 2. O placar só é desenhado após o "Game Over" começar a se mover para a posição.
     if (currentState == AnimationState::SLIDING_SCOREBOARD || currentState == AnimationState::FINISHED) {
-        // 2a. Desenha o painel do placar, que também está sendo animado e é escalado.
-        if (boardTexture) {
-            al_draw_scaled_bitmap(boardTexture,
+        // Durante a entrada, só o painel vazio; no fim, o placar completo vem do cache numa única cópia.
+        if (currentState == AnimationState::FINISHED) {
+            ALLEGRO_BITMAP* cached = boardLayer.get(this, [this] { drawBoard(0.0f, 0.0f); });
+            if (cached) {
+                renderer.drawBitmap(cached, scoreBoardGO.getX(), scoreBoardGO.getY(), 0);
+            } else {
+                drawBoard(scoreBoardGO.getX(), scoreBoardGO.getY());
+            }
+        } else if (boardTexture) {
+            renderer.drawScaledBitmap(boardTexture,
+                                      0, 0,
+                                      al_get_bitmap_width(boardTexture), al_get_bitmap_height(boardTexture),
+                                      scoreBoardGO.getX(), scoreBoardGO.getY(),
+                                      scoreBoardGO.getWidth(), scoreBoardGO.getHeight(),
+                                      0);
+        }
+    }
+}
+
+/**
+ * @brief Desenha o painel escalado e, sobre ele, a medalha, o selo "NEW" e as pontuações.
+ * @details Chamado uma vez por partida para compor o cache (em 0, 0), ou a cada quadro com o cache desligado.
+ * @param boardX Borda esquerda do placar.
+ * @param boardY Borda superior do placar.
+ */
+void GameOverScreen::drawBoard(float boardX, float boardY) const {
+    Renderer& renderer = Renderer::current();
+
+    // Desenha o painel do placar, escalado.
+    if (boardTexture) {
+        renderer.drawScaledBitmap(boardTexture,
                                   0, 0, // Coordenadas de origem na textura
                                   al_get_bitmap_width(boardTexture), al_get_bitmap_height(boardTexture),
-                                  scoreBoardGO.getX(), scoreBoardGO.getY(), // Posição de destino
+                                  boardX, boardY, // Posição de destino
                                   scoreBoardGO.getWidth(), scoreBoardGO.getHeight(), // Tamanho de destino (escalado)
                                   0);
-        }
-
-        // 2b. O conteúdo do placar (medalha, scores) só aparece quando a animação termina.
-        if (currentState == AnimationState::FINISHED) {
-            // Deslocamentos (offsets) relativos ao canto superior esquerdo do placar escalado.
-            const float medalOffsetX = 13 * SCOREBOARD_SCALE, medalOffsetY = 21 * SCOREBOARD_SCALE;
-            const float scoreOffsetX = 101 * SCOREBOARD_SCALE, scoreOffsetY = 17 * SCOREBOARD_SCALE;
-            const float bestOffsetY = 38 * SCOREBOARD_SCALE;
-            const float numberScale = 0.5f; // Escala para os números da pontuação.
-
-            // Desenha a medalha, se houver.
-            if (currentMedal) {
-                al_draw_scaled_bitmap(currentMedal,
-                                      0, 0,
-                                      al_get_bitmap_width(currentMedal), al_get_bitmap_height(currentMedal),
-                                      scoreBoardGO.getX() + medalOffsetX, scoreBoardGO.getY() + medalOffsetY,
-                                      al_get_bitmap_width(currentMedal) * SCOREBOARD_SCALE, al_get_bitmap_height(currentMedal) * SCOREBOARD_SCALE,
-                                      0);
-            }
+    }
 
-            // Se for um novo recorde, desenha o selo "NEW".
-            if(newBestScore) {
-                const float NEW_SCALE = 1.5f;
-                const float scaledNewTextureWidth = al_get_bitmap_width(newTexture) * NEW_SCALE;
-                const float scaledNewTextureHeight = al_get_bitmap_height(newTexture) * NEW_SCALE;
-
-                // Lógica para posicionar o selo "NEW" à esquerda dos números do recorde.
-                // 1. Encontra a borda direita da área dos números.
-                const float bestScoreRightX = scoreBoardGO.getX() + scoreOffsetX;
-                // 2. Calcula a largura total dos números do recorde para encontrar a borda esquerda.
-                const float bestScoreLeftX = bestScoreRightX - scoreManagerRef.getNumberWidth(bestScore, numberScale);
-                // 3. Posiciona o selo "NEW" à esquerda dos números, com um pequeno espaçamento.
-                const float newBitmapX = bestScoreLeftX - scaledNewTextureWidth - 10.0f;
-
-                // Lógica para centralizar verticalmente o selo "NEW" com os números.
-                const float digitHeight = al_get_bitmap_height(ResourceManager::getInstance().getBitmap("0")) * numberScale;
-                const float bestScoreTopY = scoreBoardGO.getY() + bestOffsetY;
-                const float newBitmapY = bestScoreTopY + (digitHeight / 2.0f) - (scaledNewTextureHeight / 2.0f);
-
-                al_draw_scaled_bitmap(newTexture,
-                                      0, 0,
-                                      al_get_bitmap_width(newTexture), al_get_bitmap_height(newTexture),
-                                      newBitmapX, newBitmapY,
-                                      scaledNewTextureWidth, scaledNewTextureHeight,
-                                      0);
-            }
+    // Deslocamentos (offsets) relativos ao canto superior esquerdo do placar escalado.
+    const float medalOffsetX = 13 * SCOREBOARD_SCALE, medalOffsetY = 21 * SCOREBOARD_SCALE;
+    const float scoreOffsetX = 101 * SCOREBOARD_SCALE, scoreOffsetY = 17 * SCOREBOARD_SCALE;
+    const float bestOffsetY = 38 * SCOREBOARD_SCALE;
+    const float numberScale = 0.5f; // Escala para os números da pontuação.
+
+    // Desenha a medalha, se houver.
+    if (currentMedal) {
+        renderer.drawScaledBitmap(currentMedal,
+                                  0, 0,
+                                  al_get_bitmap_width(currentMedal), al_get_bitmap_height(currentMedal),
+                                  boardX + medalOffsetX, boardY + medalOffsetY,
+                                  al_get_bitmap_width(currentMedal) * SCOREBOARD_SCALE, al_get_bitmap_height(currentMedal) * SCOREBOARD_SCALE,
+                                  0);
+    }
 
-            // Desenha a pontuação final e a melhor pontuação, alinhadas à direita.
-            scoreManagerRef.drawNumberSprites(finalScore, scoreBoardGO.getX() + scoreOffsetX, scoreBoardGO.getY() + scoreOffsetY, numberScale, TextAlign::RIGHT);
-            scoreManagerRef.drawNumberSprites(bestScore, scoreBoardGO.getX() + scoreOffsetX, scoreBoardGO.getY() + bestOffsetY, numberScale, TextAlign::RIGHT);
-        }
+    // Se for um novo recorde, desenha o selo "NEW".
+    if(newBestScore) {
+        const float NEW_SCALE = 1.5f;
+        const float scaledNewTextureWidth = al_get_bitmap_width(newTexture) * NEW_SCALE;
+        const float scaledNewTextureHeight = al_get_bitmap_height(newTexture) * NEW_SCALE;
+
+        // Lógica para posicionar o selo "NEW" à esquerda dos números do recorde.
+        // 1. Encontra a borda direita da área dos números.
+        const float bestScoreRightX = boardX + scoreOffsetX;
+        // 2. Calcula a largura total dos números do recorde para encontrar a borda esquerda.
+        const float bestScoreLeftX = bestScoreRightX - scoreManagerRef.getNumberWidth(bestScore, numberScale);
+        // 3. Posiciona o selo "NEW" à esquerda dos números, com um pequeno espaçamento.
+        const float newBitmapX = bestScoreLeftX - scaledNewTextureWidth - 10.0f;
+
+        // Lógica para centralizar verticalmente o selo "NEW" com os números.
+        const float digitHeight = al_get_bitmap_height(ResourceManager::getInstance().getBitmap("0")) * numberScale;
+        const float bestScoreTopY = boardY + bestOffsetY;
+        const float newBitmapY = bestScoreTopY + (digitHeight / 2.0f) - (scaledNewTextureHeight / 2.0f);
+
+        renderer.drawScaledBitmap(newTexture,
+                                  0, 0,
+                                  al_get_bitmap_width(newTexture), al_get_bitmap_height(newTexture),
+                                  newBitmapX, newBitmapY,
+                                  scaledNewTextureWidth, scaledNewTextureHeight,
+                                  0);
     }
-}
\ No newline at end of file
+
+    // Desenha a pontuação final e a melhor pontuação, alinhadas à direita.
+    scoreManagerRef.drawNumberSprites(finalScore, boardX + scoreOffsetX, boardY + scoreOffsetY, numberScale, TextAlign::RIGHT);
+    scoreManagerRef.drawNumberSprites(bestScore, boardX + scoreOffsetX, boardY + bestOffsetY, numberScale, TextAlign::RIGHT);
+}
@@ -5,6 +5,7 @@
 #include "actors/ui/GetReadyUI.hpp"
 #include "managers/ResourceManager.hpp"
 #include "Constants.hpp"
+#include "render/Renderer.hpp"
 #include <cmath>
 
 GetReadyUI::GetReadyUI() : isVisible(false), tapAlpha(1.0f), pulseTime(0.0f) {
@@ -44,7 +45,7 @@ void GetReadyUI::update(float deltaTime) {
 void GetReadyUI::draw() const {
     if (!isVisible) return;
 
-    al_draw_tinted_scaled_bitmap(tapInstructionsTexture,
+    Renderer::current().drawTintedScaledBitmap(tapInstructionsTexture,
         al_map_rgba_f(1, 1, 1, tapAlpha), // Cor com alfa variável
         0, 0, al_get_bitmap_width(tapInstructionsTexture), al_get_bitmap_height(tapInstructionsTexture),
         tapX, tapY,
@@ -5,6 +5,7 @@
 #include "actors/ui/ScoreBoard.hpp"
 #include "managers/ResourceManager.hpp"
 #include "Constants.hpp"
+#include "render/Renderer.hpp"
 #include <cmath>
 
 ScoreBoard::ScoreBoard(float finalY, float duration, const ScoreManager& scManager, float initialScale)
@@ -78,24 +79,24 @@ void ScoreBoard::draw() const {
 
     // 1. Desenha o painel de fundo
     if (boardTexture) {
-        al_draw_scaled_bitmap(boardTexture, 
-                              0, 0,
-                              al_get_bitmap_width(boardTexture), al_get_bitmap_height(boardTexture),
-                              x, y, // Destination X, Y
-                              width * currentScale, height * currentScale, // Destination W, H (aplicando escala)
-                              0); // Flags
+        Renderer::current().drawScaledBitmap(boardTexture, 
+                                             0, 0,
+                                             al_get_bitmap_width(boardTexture), al_get_bitmap_height(boardTexture),
+                                             x, y, // Destination X, Y
+                                             width * currentScale, height * currentScale, // Destination W, H (aplicando escala)
+                                             0); // Flags
     }
 
     // 2. Desenha a medalha (se houver) dentro do painel
     if (currentMedal) {
         const float medalOffsetX = 13;
         const float medalOffsetY = 21;
-        al_draw_scaled_bitmap(currentMedal,
-                              0, 0, // Source X, Y
-                              al_get_bitmap_width(currentMedal), al_get_bitmap_height(currentMedal), // Source W, H
-                              x + (medalOffsetX * currentScale), y + (medalOffsetY * currentScale), // Destination X, Y (offsets escalados)
-                              al_get_bitmap_width(currentMedal) * currentScale, al_get_bitmap_height(currentMedal) * currentScale, // Destination W, H (aplicando escala)
-                              0); // Flags
+        Renderer::current().drawScaledBitmap(currentMedal,
+                                             0, 0, // Source X, Y
+                                             al_get_bitmap_width(currentMedal), al_get_bitmap_height(currentMedal), // Source W, H
+                                             x + (medalOffsetX * currentScale), y + (medalOffsetY * currentScale), // Destination X, Y (offsets escalados)
+                                             al_get_bitmap_width(currentMedal) * currentScale, al_get_bitmap_height(currentMedal) * currentScale, // Destination W, H (aplicando escala)
+                                             0); // Flags
     }
  
 }
@@ -8,6 +8,11 @@
 #include "managers/ResourceManager.hpp"
 #include "Constants.hpp"
 #include "scenes/StartMenu.hpp"
+#include "scenes/VersusScene.hpp"
+#include "scenes/SpectatorScene.hpp"
+#include "net/SpectatorBroadcast.hpp"
+#include "managers/BotManager.hpp"
+#include "render/Renderer.hpp"
 #include <allegro5/allegro_primitives.h>
 #include <allegro5/allegro_font.h>
 #include <allegro5/allegro_image.h>
@@ -16,6 +21,7 @@
 #include <iostream>
 #include <chrono>
 #include <algorithm>
+#include <stdexcept>
 
 namespace {
     /// @brief Função utilitária para verificar se uma inicialização do Allegro foi bem-sucedida.
@@ -26,7 +32,8 @@ namespace {
     }
 }
 
-Game::Game() : display(nullptr), timer(nullptr), queue(nullptr), isRunning(false) {
+Game::Game(const LaunchOptions& options)
+    : display(nullptr), timer(nullptr), queue(nullptr), isRunning(false), options(options) {
     initialize();
 }
 
@@ -52,9 +59,36 @@ void Game::initialize() {
     queue = al_create_event_queue();
     must_init(queue, "event queue");
 
+    // A janela abre no tamanho do quadro, mas pode ser redimensionada: o quadro é ampliado em escala inteira.
+    al_set_new_display_flags(ALLEGRO_WINDOWED | ALLEGRO_RESIZABLE);
     display = al_create_display(BUFFER_W, BUFFER_H);
     must_init(display, "display");
 
+    // Com --software, o quadro e os sprites carregados a seguir ficam em memória, como sem GPU.
+    if (options.software) {
+        al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+    }
+    try {
+        screen = std::make_unique<ScreenTarget>(BUFFER_W, BUFFER_H);
+    } catch (const std::runtime_error& e) {
+        must_init(false, e.what());
+    }
+    screen->resize(al_get_display_width(display), al_get_display_height(display));
+    // Sem GPU o Allegro cria o quadro em memória: aí o desenho usa os atalhos em software.
+    if (al_get_bitmap_flags(screen->getBitmap()) & ALLEGRO_MEMORY_BITMAP) {
+        softwareRenderer = std::make_unique<SoftwareRenderer>();
+        Renderer::setCurrent(softwareRenderer.get());
+        std::cout << "Quadro em memória: desenho em software." << std::endl;
+    }
+    if (!options.capture.empty()) {
+        try {
+            capture = std::make_unique<FrameCapture>(options.capture, BUFFER_W, BUFFER_H, static_cast<int>(FPS));
+            std::cout << "Gravando a sessão em " << options.capture << std::endl;
+        } catch (const std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+
     // --- Registro das fontes de eventos ---
     al_register_event_source(queue, al_get_display_event_source(display));
     al_register_event_source(queue, al_get_timer_event_source(timer));
@@ -106,14 +140,31 @@ void Game::initialize() {
     // 4. Define a posição da janela com as coordenadas calculadas.
     al_set_window_position(display, window_x, window_y);
     
-    al_set_new_display_flags(ALLEGRO_WINDOWED);
     al_set_window_title(display, "Flappy Bird | Clone - PDSII");
     al_set_display_icon(display, ResourceManager::getInstance().getBitmap("icon"));
 
     // --- Setup da Cena Inicial ---
-    // O jogo começa no menu principal.
+    // --- Bot que joga no lugar do jogador ---
+    if (!options.bot.path.empty()) {
+        BotManager::getInstance().load(options.bot.path);
+        std::cout << "Bot carregado: " << BotManager::getInstance().getController()->name << std::endl;
+    }
+
+    // --- Transmissão para espectadores ---
+    if (!options.broadcast.empty()) {
+        SpectatorBroadcast::getInstance().start(options.broadcast);
+        std::cout << "Transmitindo em " << options.broadcast << std::endl;
+    }
+
+    // O jogo começa no menu principal, ou direto na partida versus (--versus) ou na transmissão (--spectate).
     sceneManager.setEventQueue(queue);
-    sceneManager.setCurrentScene(std::make_unique<StartMenu>(&sceneManager));
+    if (!options.spectate.empty()) {
+        sceneManager.setCurrentScene(std::make_unique<SpectatorScene>(&sceneManager, options.spectate));
+    } else if (options.versus.enabled) {
+        sceneManager.setCurrentScene(std::make_unique<VersusScene>(&sceneManager, options.versus));
+    } else {
+        sceneManager.setCurrentScene(std::make_unique<StartMenu>(&sceneManager));
+    }
 
     isRunning = true;
 }
@@ -165,30 +216,83 @@ void Game::processEvent(const ALLEGRO_EVENT& event) {
 
     if (event.type == ALLEGRO_EVENT_DISPLAY_RESIZE) {
         al_acknowledge_resize(display);
+        screen->resize(al_get_display_width(display), al_get_display_height(display));
+    }
+
+    if (event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == ALLEGRO_KEY_F11) {
+        toggleFullscreen();
     }
 
+    // As cenas só conhecem o quadro de BUFFER_W x BUFFER_H: o mouse é convertido da janela para o quadro.
+    switch (event.type) {
+        case ALLEGRO_EVENT_MOUSE_AXES:
+        case ALLEGRO_EVENT_MOUSE_BUTTON_DOWN:
+        case ALLEGRO_EVENT_MOUSE_BUTTON_UP:
+        case ALLEGRO_EVENT_MOUSE_ENTER_DISPLAY:
+        case ALLEGRO_EVENT_MOUSE_LEAVE_DISPLAY:
+        case ALLEGRO_EVENT_MOUSE_WARPED: {
+            ALLEGRO_EVENT scaled = event;
+            screen->toFrame(scaled.mouse.x, scaled.mouse.y);
+            sceneManager.processEvent(scaled);
+            return;
+        }
+        default:
+            break;
+    }
 
     // Delega o processamento de eventos para a cena ativa.
     sceneManager.processEvent(event);
 }
 
+void Game::toggleFullscreen() {
+    bool fullscreen = al_get_display_flags(display) & ALLEGRO_FULLSCREEN_WINDOW;
+    al_set_display_flag(display, ALLEGRO_FULLSCREEN_WINDOW, !fullscreen);
+    // Nem toda plataforma envia DISPLAY_RESIZE ao trocar o modo; o encaixe é refeito aqui também.
+    screen->resize(al_get_display_width(display), al_get_display_height(display));
+}
+
 void Game::update(float deltaTime) {
     // Delega a atualização da lógica para a cena ativa.
     sceneManager.update(deltaTime);
+    // Envia aos espectadores os passos publicados pela cena (não faz nada sem --broadcast).
+    SpectatorBroadcast::getInstance().poll();
     if (!sceneManager.isRunning()) {
         isRunning = false;
     }
 }
 
 void Game::draw() {
-    al_clear_to_color(al_map_rgb(0, 0, 0));
+    // As cenas desenham sempre em BUFFER_W x BUFFER_H, seja qual for o tamanho da janela.
+    screen->begin();
+    Renderer::current().clear(al_map_rgb(0, 0, 0));
     // Delega a renderização para a cena ativa.
     sceneManager.draw();
+    // A gravação copia o quadro antes da escala, e a thread escritora cuida do resto.
+    if (capture) {
+        capture->capture(screen->getBitmap());
+    }
+    // Uma única cópia escalada leva o quadro para a janela.
+    screen->present(display);
     al_flip_display();
 }
 
 void Game::shutdown() {
+    SpectatorBroadcast::getInstance().stop();
+
+    if (capture) {
+        capture->stop();
+        const CaptureStats stats = capture->getStats();
+        std::cout << "Gravação: " << stats.written << " quadros gravados, " << stats.dropped << " descartados, fila máxima "
+                  << stats.maxQueueDepth << ", até " << stats.maxCaptureMs << " ms por quadro no jogo." << std::endl;
+        capture.reset();
+    }
+
     // Destrói os recursos do Allegro na ordem inversa da criação.
+    if (softwareRenderer) {
+        Renderer::setCurrent(nullptr);
+        softwareRenderer.reset();
+    }
+    screen.reset();
     if (display) {
         al_destroy_display(display);
     }
@@ -21,6 +21,9 @@ GameSound::GameSound()
  * @param music_name Caminho para a trilha de fundo.
  */
 void GameSound::init(const std::string& music_name) {
+    // Sem o addon de áudio (quadros de referência, sem display nem som), os sons ficam nulos e o jogo segue mudo.
+    if (!al_is_audio_installed()) return;
+
     ResourceManager& rm = ResourceManager::getInstance();
 
     // Carrega a música de fundo do tema como ALLEGRO_AUDIO_STREAM
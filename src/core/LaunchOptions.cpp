@@ -0,0 +1,147 @@
+/**
+ * @file LaunchOptions.cpp
+ * @brief Interpretação da linha de comando.
+ */
+#include "core/LaunchOptions.hpp"
+#include <stdexcept>
+
+namespace {
+    /// Lê um número inteiro em [min, max].
+    long long parseInteger(const std::string& text, long long min, long long max, const std::string& what)
+    {
+        size_t used = 0;
+        long long value = 0;
+        try {
+            value = std::stoll(text, &used, 0);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used != text.size() || value < min || value > max) {
+            throw std::invalid_argument("Valor inválido para " + what + ": " + text);
+        }
+        return value;
+    }
+
+    /// Lê um número real não negativo.
+    float parseAmount(const std::string& text, const std::string& what)
+    {
+        size_t used = 0;
+        float value = -1.0f;
+        try {
+            value = std::stof(text, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used != text.size() || !(value >= 0.0f)) {
+            throw std::invalid_argument("Valor inválido para " + what + ": " + text);
+        }
+        return value;
+    }
+
+    /// Separa "host:porta".
+    void parseAddress(const std::string& text, std::string& host, uint16_t& port)
+    {
+        size_t colon = text.rfind(':');
+        if (colon == std::string::npos || colon == 0) {
+            throw std::invalid_argument("Endereço deve ser host:porta: " + text);
+        }
+        host = text.substr(0, colon);
+        port = static_cast<uint16_t>(parseInteger(text.substr(colon + 1), 1, 65535, "porta"));
+    }
+}
+
+LaunchOptions LaunchOptions::parse(int argc, const char* const* argv)
+{
+    LaunchOptions options;
+    auto next = [&](int& i, const std::string& flag) -> std::string {
+        if (i + 1 >= argc) throw std::invalid_argument("Faltam argumentos para " + flag);
+        return argv[++i];
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--versus") {
+            VersusOptions& versus = options.versus;
+            versus.enabled = true;
+            versus.player = static_cast<int>(parseInteger(next(i, arg), 0, 1, "jogador"));
+            versus.localPort = static_cast<uint16_t>(parseInteger(next(i, arg), 1, 65535, "porta local"));
+            parseAddress(next(i, arg), versus.remoteHost, versus.remotePort);
+        } else if (arg == "--broadcast") {
+            options.broadcast = next(i, arg);
+        } else if (arg == "--spectate") {
+            options.spectate = next(i, arg);
+        } else if (arg == "--capture") {
+            options.capture = next(i, arg);
+        } else if (arg == "--software") {
+            options.software = true;
+        } else if (arg == "--bot") {
+            options.bot.path = next(i, arg);
+        } else if (arg == "--headless") {
+            options.bot.headlessGames = static_cast<size_t>(parseInteger(next(i, arg), 1, INT32_MAX, "partidas"));
+        } else if (arg == "--threads") {
+            options.bot.threads = static_cast<unsigned>(parseInteger(next(i, arg), 0, 1024, "threads"));
+        } else if (arg == "--sweep") {
+            options.sweep.gridPath = next(i, arg);
+        } else if (arg == "--sweep-games") {
+            options.sweep.games = static_cast<size_t>(parseInteger(next(i, arg), 1, INT32_MAX, "partidas"));
+        } else if (arg == "--sweep-seconds") {
+            options.sweep.seconds = parseAmount(next(i, arg), arg);
+            if (options.sweep.seconds <= 0.0f) throw std::invalid_argument("--sweep-seconds deve ser positivo");
+        } else if (arg == "--sweep-out") {
+            options.sweep.outputPath = next(i, arg);
+        } else if (arg == "--verify") {
+            options.verify.push_back(next(i, arg));
+        } else if (arg == "--seed") {
+            options.versus.seed = static_cast<uint64_t>(parseInteger(next(i, arg), 0, INT64_MAX, "semente"));
+        } else if (arg == "--latency") {
+            options.versus.latencyMs = parseAmount(next(i, arg), arg);
+        } else if (arg == "--jitter") {
+            options.versus.jitterMs = parseAmount(next(i, arg), arg);
+        } else if (arg == "--loss") {
+            options.versus.lossPercent = parseAmount(next(i, arg), arg);
+            if (options.versus.lossPercent > 100.0f) throw std::invalid_argument("--loss deve estar entre 0 e 100");
+        } else {
+            throw std::invalid_argument("Argumento desconhecido: " + arg);
+        }
+    }
+    if (options.versus.enabled && !options.spectate.empty()) {
+        throw std::invalid_argument("--versus e --spectate não podem ser usados juntos");
+    }
+    if (!options.bot.path.empty() && (options.versus.enabled || !options.spectate.empty())) {
+        throw std::invalid_argument("--bot só pode ser usado na partida normal ou com --headless");
+    }
+    if (options.bot.headlessGames > 0 && options.bot.path.empty()) {
+        throw std::invalid_argument("--headless precisa de --bot");
+    }
+    if (!options.verify.empty() && (options.versus.enabled || !options.spectate.empty() ||
+                                    !options.bot.path.empty() || !options.sweep.gridPath.empty())) {
+        throw std::invalid_argument("--verify não pode ser usado com outros modos");
+    }
+    if (!options.sweep.gridPath.empty() && (options.versus.enabled || !options.spectate.empty() ||
+                                            options.bot.headlessGames > 0)) {
+        throw std::invalid_argument("--sweep não pode ser usado com --versus, --spectate ou --headless");
+    }
+    return options;
+}
+
+const char* LaunchOptions::usage()
+{
+    return "Uso: flappy_bird [opções]\n"
+           "  --versus <jogador 0|1> <porta local> <host:porta>  partida versus em rede (UDP)\n"
+           "  --seed <n>          semente do percurso do versus (a mesma nos dois lados) e da primeira partida de --headless e --sweep\n"
+           "  --latency <ms>      atraso artificial dos pacotes enviados\n"
+           "  --jitter <ms>       variação artificial do atraso\n"
+           "  --loss <%>          porcentagem artificial de pacotes perdidos\n"
+           "  --broadcast <porta|unix:caminho>     transmite a partida para espectadores\n"
+           "  --spectate <host:porta|unix:caminho> assiste a uma transmissão (com --broadcast, retransmite)\n"
+           "  --capture <arquivo> grava a sessão em vídeo (.y4m; outra extensão grava RGBA cru)\n"
+           "  --software          desenha em bitmaps de memória, sem GPU (como nas máquinas de teste)\n"
+           "  --bot <bot.so>      um bot (ABI flappy_controller_v1) joga no lugar do jogador\n"
+           "  --headless <n>      joga n partidas do bot sem janela e mostra as pontuações\n"
+           "  --threads <n>       threads das partidas sem janela e da conferência (0 = todos os núcleos)\n"
+           "  --sweep <grade>     varre os parâmetros de dificuldade da grade sem janela (com --bot, o bot joga)\n"
+           "  --sweep-games <n>   partidas por combinação da varredura (padrão 64, sementes a partir de --seed)\n"
+           "  --sweep-seconds <s> limite de tempo de jogo por partida da varredura (padrão 60)\n"
+           "  --sweep-out <csv>   arquivo com o resumo de cada combinação (padrão sweep.csv)\n"
+           "  --verify <replay|pasta>  confere replays re-simulando as partidas (pode repetir)\n";
+}
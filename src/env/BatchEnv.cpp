@@ -0,0 +1,89 @@
+/**
+ * @file BatchEnv.cpp
+ * @brief Implementação do lote de ambientes.
+ */
+#include "env/BatchEnv.hpp"
+#include "Constants.hpp"
+
+BatchEnv::BatchEnv(size_t size, unsigned threads)
+    : simulations(size), seeds(size), runner(threads)
+{
+    reset(0, nullptr);
+}
+
+void BatchEnv::startEpisode(size_t i, uint64_t seed)
+{
+    seeds[i] = seed;
+    simulations[i].reset(seed);
+    simulations[i].step(true);
+}
+
+void BatchEnv::reset(uint64_t seed, float* observations)
+{
+    runner.run(size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            startEpisode(i, seed + i);
+            if (observations) observe(simulations[i].getState(), observations + i * OBS_SIZE);
+        }
+    });
+}
+
+void BatchEnv::step(const uint8_t* actions, float* observations, float* rewards, uint8_t* dones)
+{
+    runner.run(size(), [&](size_t begin, size_t end) {
+        stepRange(begin, end, actions, observations, rewards, dones);
+    });
+}
+
+void BatchEnv::render(const PixelRenderer& renderer, PixelFormat format, uint8_t* frames)
+{
+    const size_t bytes = PixelRenderer::frameBytes(format);
+    runner.run(size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            renderer.render(simulations[i].getState(), format, frames + i * bytes);
+        }
+    });
+}
+
+void BatchEnv::stepRange(size_t begin, size_t end, const uint8_t* actions,
+                         float* observations, float* rewards, uint8_t* dones)
+{
+    for (size_t i = begin; i < end; ++i) {
+        GameSimulation& sim = simulations[i];
+        const uint8_t events = sim.step(actions && actions[i]);
+
+        float reward = REWARD_ALIVE;
+        if (events & SIM_EVENT_SCORE) reward += REWARD_PIPE;
+        const bool done = (events & SIM_EVENT_DEATH) != 0;
+        if (done) {
+            reward = REWARD_DEATH;
+            startEpisode(i, seeds[i] + size());
+        }
+
+        if (observations) observe(sim.getState(), observations + i * OBS_SIZE);
+        if (rewards) rewards[i] = reward;
+        if (dones) dones[i] = done;
+    }
+}
+
+void BatchEnv::observe(const SimState& state, float* out)
+{
+    const PipeCourse& course = state.course;
+    out[OBS_BIRD_Y] = state.birdY / BUFFER_H;
+    out[OBS_BIRD_VEL_Y] = state.birdVelY / TERMINAL_VELOCITY;
+
+    // Os dois primeiros canos que ainda não ficaram totalmente para trás do pássaro.
+    int p = course.firstAhead(BIRD_START_X);
+    for (int k = 0; k < 2; ++k, ++p) {
+        float* pipe = out + OBS_PIPE_DISTANCE + k * (OBS_NEXT_DISTANCE - OBS_PIPE_DISTANCE);
+        if (p < course.getCount()) {
+            pipe[0] = (course.getX(p) + PIPE_WIDTH - BIRD_START_X) / BUFFER_W;
+            pipe[1] = course.getGapTop(p) / BUFFER_H;
+            pipe[2] = course.getGapBottom(p) / BUFFER_H;
+        } else {
+            pipe[0] = 1.0f;
+            pipe[1] = 0.0f;
+            pipe[2] = static_cast<float>(PLAYABLE_AREA_HEIGHT) / BUFFER_H;
+        }
+    }
+}
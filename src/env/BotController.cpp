@@ -0,0 +1,96 @@
+/**
+ * @file BotController.cpp
+ * @brief Implementação do carregamento e da execução de bots.
+ */
+#include "env/BotController.hpp"
+#include "Constants.hpp"
+#include <dlfcn.h>
+#include <stdexcept>
+
+BotLibrary::BotLibrary(const std::string& path)
+    : path(path), handle(nullptr), controller(nullptr)
+{
+    handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!handle) {
+        throw std::runtime_error("Não foi possível abrir o bot " + path + ": " + dlerror());
+    }
+
+    auto entry = reinterpret_cast<flappy_controller_v1_entry_fn>(dlsym(handle, FLAPPY_CONTROLLER_V1_ENTRY_NAME));
+    try {
+        if (!entry) {
+            throw std::runtime_error("O bot " + path + " não exporta " FLAPPY_CONTROLLER_V1_ENTRY_NAME);
+        }
+        controller = entry();
+        validate(controller);
+    } catch (...) {
+        dlclose(handle);
+        throw;
+    }
+}
+
+BotLibrary::~BotLibrary()
+{
+    dlclose(handle);
+}
+
+void BotLibrary::validate(const flappy_controller_v1* controller)
+{
+    if (!controller) {
+        throw std::runtime_error("O bot não retornou uma tabela de funções");
+    }
+    if (controller->abi_version != FLAPPY_CONTROLLER_ABI_VERSION) {
+        throw std::runtime_error("O bot usa a ABI versão " + std::to_string(controller->abi_version) +
+                                 "; esperada " + std::to_string(FLAPPY_CONTROLLER_ABI_VERSION));
+    }
+    if (controller->struct_size < sizeof(flappy_controller_v1) || !controller->decide) {
+        throw std::runtime_error("Tabela do bot incompleta");
+    }
+}
+
+BotController::BotController(const flappy_controller_v1* controller, uint64_t seed)
+    : controller(controller), instance(nullptr), observation()
+{
+    if (controller->create) instance = controller->create(seed);
+}
+
+BotController::~BotController()
+{
+    if (controller->destroy) controller->destroy(instance);
+}
+
+template <typename Scalar>
+bool BotController::decide(const BasicSimState<Scalar>& state)
+{
+    observe(state, observation);
+    return controller->decide(instance, &observation) != 0;
+}
+
+template <typename Scalar>
+void BotController::observe(const BasicSimState<Scalar>& state, flappy_observation_v1& out)
+{
+    out.tick = state.tick;
+    out.phase = state.phase == SimPhase::READY ? 0 : 1;
+    out.score = state.score;
+    out.bird_x = BIRD_START_X;
+    out.bird_y = toFloat(state.birdY);
+    out.bird_vel_y = toFloat(state.birdVelY);
+    out.bird_width = BIRD_WIDTH;
+    out.bird_height = BIRD_HEIGHT;
+    out.pipe_width = PIPE_WIDTH;
+    out.floor_y = PLAYABLE_AREA_HEIGHT;
+
+    const BasicPipeCourse<Scalar>& course = state.course;
+    int p = course.firstAhead(Scalar(BIRD_START_X));
+    uint32_t count = 0;
+    for (; p < course.getCount() && count < FLAPPY_OBSERVATION_PIPES; ++p, ++count) {
+        out.pipes[count].x = toFloat(course.getX(p));
+        out.pipes[count].gap_top = toFloat(course.getGapTop(p));
+        out.pipes[count].gap_bottom = toFloat(course.getGapBottom(p));
+    }
+    out.pipe_count = count;
+}
+
+template bool BotController::decide(const SimState& state);
+template bool BotController::decide(const FixedSimState& state);
+template void BotController::observe(const SimState& state, flappy_observation_v1& out);
+template void BotController::observe(const FixedSimState& state, flappy_observation_v1& out);
@@ -0,0 +1,39 @@
+/**
+ * @file BotRunner.cpp
+ * @brief Implementação das partidas de bot sem janela.
+ */
+#include "env/BotRunner.hpp"
+#include "env/BotController.hpp"
+#include "sim/GameSimulation.hpp"
+
+BotRunner::BotRunner(const flappy_controller_v1* controller, unsigned threads)
+    : controller(controller), runner(threads)
+{
+}
+
+std::vector<BotGameResult> BotRunner::run(uint64_t firstSeed, size_t games, uint32_t maxTicks)
+{
+    std::vector<BotGameResult> results(games);
+    runner.run(games, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            results[i] = play(controller, firstSeed + i, maxTicks);
+        }
+    });
+    return results;
+}
+
+BotGameResult BotRunner::play(const flappy_controller_v1* controller, uint64_t seed, uint32_t maxTicks)
+{
+    GameSimulation sim;
+    sim.reset(seed);
+    BotController bot(controller, seed);
+
+    // Na fase READY o passo só conta depois do primeiro pulo; um bot que nunca
+    // pula também fica limitado por maxTicks.
+    uint32_t waited = 0;
+    while (sim.getPhase() != SimPhase::DEAD && sim.getTick() < maxTicks && waited < maxTicks) {
+        if (sim.getPhase() == SimPhase::READY) ++waited;
+        sim.step(bot.decide(sim.getState()));
+    }
+    return BotGameResult{seed, sim.getScore(), sim.getTick(), sim.getPhase() == SimPhase::DEAD};
+}
@@ -0,0 +1,302 @@
+/**
+ * @file DifficultySweep.cpp
+ * @brief Implementação da varredura de parâmetros de dificuldade.
+ */
+#include "env/DifficultySweep.hpp"
+#include "env/BotController.hpp"
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+    /// Um campo de SimParams que pode variar, com o intervalo aceito (min, max].
+    struct ParameterInfo {
+        const char* name;
+        float SimParams::* field;
+        float min;
+        float max;
+    };
+
+    const ParameterInfo PARAMETERS[SweepGrid::PARAMETER_COUNT] = {
+        {"gravity", &SimParams::gravity, 0.0f, 100000.0f},
+        {"jump_velocity", &SimParams::jumpVelocity, -10000.0f, -1.0f},
+        {"terminal_velocity", &SimParams::terminalVelocity, 0.0f, 10000.0f},
+        {"pipe_speed", &SimParams::pipeSpeed, 0.0f, 10000.0f},
+        {"pipe_gap", &SimParams::pipeGap, static_cast<float>(BIRD_HEIGHT), PLAYABLE_AREA_HEIGHT - PIPE_MIN_HEIGHT - 1.0f},
+        {"pipe_interval", &SimParams::pipeInterval, 0.0f, 60.0f},
+    };
+
+    /// Partidas guardadas de uma vez: as combinações são jogadas em blocos deste tamanho.
+    constexpr size_t GAMES_PER_BLOCK = 1 << 16;
+
+    /**
+     * @brief Garante que o percurso nunca tenha mais canos na tela do que PipeCourse::CAPACITY.
+     * @throw std::runtime_error se os canos ficarem próximos demais.
+     */
+    void checkPipeSpacing(const SimParams& params)
+    {
+        const float spacing = params.pipeSpeed * params.pipeInterval;
+        const float minSpacing = (BUFFER_W + PIPE_WIDTH) / (PipeCourse::CAPACITY - 1);
+        if (spacing < minSpacing) {
+            std::ostringstream message;
+            message << "Canos próximos demais (pipe_speed " << params.pipeSpeed << " x pipe_interval "
+                    << params.pipeInterval << " < " << minSpacing << " pixels)";
+            throw std::runtime_error(message.str());
+        }
+    }
+}
+
+SweepGrid SweepGrid::parse(const std::string& text)
+{
+    SweepGrid grid;
+    std::istringstream lines(text);
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(lines, line)) {
+        ++lineNumber;
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name)) continue;
+
+        std::vector<float> numbers;
+        float number;
+        while (fields >> number) numbers.push_back(number);
+        if (!fields.eof() || (numbers.size() != 1 && numbers.size() != 3)) {
+            throw std::runtime_error("Linha " + std::to_string(lineNumber) +
+                                     " da grade: use \"nome valor\" ou \"nome início fim pontos\"");
+        }
+
+        std::vector<float> values;
+        if (numbers.size() == 1) {
+            values.push_back(numbers[0]);
+        } else {
+            const int points = static_cast<int>(numbers[2]);
+            if (points < 1 || static_cast<float>(points) != numbers[2]) {
+                throw std::runtime_error("Linha " + std::to_string(lineNumber) + " da grade: número de pontos inválido");
+            }
+            for (int i = 0; i < points; ++i) {
+                const float t = points == 1 ? 0.0f : static_cast<float>(i) / (points - 1);
+                values.push_back(numbers[0] + (numbers[1] - numbers[0]) * t);
+            }
+        }
+        for (const Axis& axis : grid.axes) {
+            if (name == PARAMETERS[axis.parameter].name) {
+                throw std::runtime_error("Linha " + std::to_string(lineNumber) + " da grade: " + name + " repetido");
+            }
+        }
+        grid.setAxis(name, values);
+    }
+    return grid;
+}
+
+SweepGrid SweepGrid::load(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Não foi possível abrir a grade: " + path);
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    return parse(text.str());
+}
+
+void SweepGrid::setAxis(const std::string& name, const std::vector<float>& values)
+{
+    int parameter = 0;
+    while (parameter < PARAMETER_COUNT && name != PARAMETERS[parameter].name) ++parameter;
+    if (parameter == PARAMETER_COUNT) {
+        throw std::runtime_error("Parâmetro desconhecido na grade: " + name);
+    }
+    if (values.empty()) {
+        throw std::runtime_error("Parâmetro sem valores na grade: " + name);
+    }
+    const ParameterInfo& info = PARAMETERS[parameter];
+    for (float value : values) {
+        if (!(value > info.min && value <= info.max)) {
+            throw std::runtime_error("Valor fora do intervalo para " + name + ": " + std::to_string(value));
+        }
+    }
+
+    for (Axis& axis : axes) {
+        if (axis.parameter == parameter) {
+            axis.values = values;
+            return;
+        }
+    }
+    axes.push_back(Axis{parameter, values});
+}
+
+size_t SweepGrid::size() const
+{
+    size_t total = 1;
+    for (const Axis& axis : axes) total *= axis.values.size();
+    return total;
+}
+
+SimParams SweepGrid::at(size_t index) const
+{
+    SimParams params;
+    for (size_t a = axes.size(); a-- > 0;) {
+        const Axis& axis = axes[a];
+        params.*PARAMETERS[axis.parameter].field = axis.values[index % axis.values.size()];
+        index /= axis.values.size();
+    }
+    return params;
+}
+
+const char* SweepGrid::parameterName(int i)
+{
+    return PARAMETERS[i].name;
+}
+
+float SweepGrid::parameterValue(const SimParams& params, int i)
+{
+    return params.*PARAMETERS[i].field;
+}
+
+int SweepResult::bucketOf(int32_t score)
+{
+    int bucket = 0;
+    while (score > 0 && bucket < SCORE_BUCKETS - 1) {
+        score >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+DifficultySweep::DifficultySweep(const flappy_controller_v1* controller, unsigned threads)
+    : controller(controller), runner(threads)
+{
+}
+
+std::vector<SweepResult> DifficultySweep::run(const SweepGrid& grid, uint64_t firstSeed, size_t games, uint32_t maxTicks)
+{
+    const size_t configs = grid.size();
+    for (size_t c = 0; c < configs; ++c) checkPipeSpacing(grid.at(c));
+
+    std::vector<SweepResult> results;
+    results.reserve(configs);
+    if (games == 0) return results;
+
+    // Cada bloco joga todas as partidas de algumas combinações; as partidas
+    // (combinação, semente) formam um único laço dividido entre as threads.
+    // O laço percorre as sementes por fora e as combinações por dentro, para que
+    // cada fatia tenha combinações fáceis e difíceis na mesma proporção.
+    const size_t configsPerBlock = std::max<size_t>(1, GAMES_PER_BLOCK / games);
+    std::vector<SimParams> blockParams(configsPerBlock);
+    std::vector<BotGameResult> blockGames(configsPerBlock * games);
+    for (size_t first = 0; first < configs; first += configsPerBlock) {
+        const size_t count = std::min(configsPerBlock, configs - first);
+        for (size_t c = 0; c < count; ++c) blockParams[c] = grid.at(first + c);
+
+        runner.run(count * games, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const size_t config = i % count;
+                const size_t game = i / count;
+                blockGames[config * games + game] = play(controller, blockParams[config], firstSeed + game, maxTicks);
+            }
+        });
+        for (size_t c = 0; c < count; ++c) {
+            results.push_back(summarize(blockParams[c], &blockGames[c * games], games, maxTicks));
+        }
+    }
+    return results;
+}
+
+BotGameResult DifficultySweep::play(const flappy_controller_v1* controller, const SimParams& params,
+                                    uint64_t seed, uint32_t maxTicks)
+{
+    GameSimulation sim;
+    sim.setParams(params);
+    sim.reset(seed);
+    std::unique_ptr<BotController> bot;
+    if (controller) bot = std::make_unique<BotController>(controller, seed);
+
+    // Como em BotRunner::play, um bot que nunca pula também fica limitado por maxTicks.
+    uint32_t waited = 0;
+    while (sim.getPhase() != SimPhase::DEAD && sim.getTick() < maxTicks && waited < maxTicks) {
+        if (sim.getPhase() == SimPhase::READY) ++waited;
+        sim.step(bot ? bot->decide(sim.getState()) : autopilot(sim.getState(), params));
+    }
+    return BotGameResult{seed, sim.getScore(), sim.getTick(), sim.getPhase() == SimPhase::DEAD};
+}
+
+bool DifficultySweep::autopilot(const SimState& state, const SimParams& params)
+{
+    if (state.phase == SimPhase::READY) return true;
+
+    // Mira a parte de baixo do próximo vão, com folga de uma queda e meia de um passo.
+    // O cano atual é trocado pelo próximo um pouco antes de o pássaro sair dele.
+    const float fallPerTick = params.terminalVelocity * GameSimulation::TICK;
+    const PipeCourse& course = state.course;
+    const int p = course.firstAhead(BIRD_START_X + AUTOPILOT_LEAD);
+    const float target = p < course.getCount() ? course.getGapBottom(p) - BIRD_HEIGHT - 1.5f * fallPerTick
+                                               : PLAYABLE_AREA_HEIGHT / 2.0f;
+    // Pula de novo antes do topo da subida, para conseguir subir até vãos bem mais altos.
+    return state.birdY > target && state.birdVelY > AUTOPILOT_REJUMP * params.jumpVelocity;
+}
+
+SweepResult DifficultySweep::summarize(const SimParams& params, BotGameResult* games, size_t count, uint32_t maxTicks)
+{
+    SweepResult result;
+    result.params = params;
+    result.games = static_cast<uint32_t>(count);
+    result.survival.fill(0.0f);
+    result.scoreHistogram.fill(0);
+
+    long long totalScore = 0;
+    unsigned long long totalTicks = 0;
+    for (size_t g = 0; g < count; ++g) {
+        const BotGameResult& game = games[g];
+        totalScore += game.score;
+        totalTicks += game.ticks;
+        ++result.scoreHistogram[SweepResult::bucketOf(game.score)];
+        for (int k = 0; k < SweepResult::SURVIVAL_POINTS; ++k) {
+            const uint64_t mark = static_cast<uint64_t>(maxTicks) * (k + 1) / SweepResult::SURVIVAL_POINTS;
+            if (!game.died || game.ticks > mark) result.survival[k] += 1.0f;
+        }
+    }
+    for (float& alive : result.survival) alive /= count;
+    result.meanScore = static_cast<double>(totalScore) / count;
+    result.meanSeconds = static_cast<double>(totalTicks) / count / FPS;
+
+    auto byScore = [](const BotGameResult& a, const BotGameResult& b) { return a.score < b.score; };
+    BotGameResult* end = games + count;
+    std::nth_element(games, games + count / 2, end, byScore);
+    result.medianScore = games[count / 2].score;
+    std::nth_element(games, games + count * 9 / 10, end, byScore);
+    result.p90Score = games[count * 9 / 10].score;
+    result.maxScore = std::max_element(games, end, byScore)->score;
+    return result;
+}
+
+void DifficultySweep::writeCsv(std::ostream& out, const std::vector<SweepResult>& results)
+{
+    for (int i = 0; i < SweepGrid::PARAMETER_COUNT; ++i) out << SweepGrid::parameterName(i) << ',';
+    out << "games,mean_score,median_score,p90_score,max_score,mean_seconds";
+    for (int k = 1; k <= SweepResult::SURVIVAL_POINTS; ++k) {
+        out << ",alive_" << k * 100 / SweepResult::SURVIVAL_POINTS << "pct";
+    }
+    for (int b = 0; b < SweepResult::SCORE_BUCKETS; ++b) {
+        const int low = b == 0 ? 0 : 1 << (b - 1);
+        out << ",score_" << low;
+        if (b == SweepResult::SCORE_BUCKETS - 1) {
+            out << "_plus";
+        } else if (b > 1) {
+            out << '_' << (1 << b) - 1;
+        }
+    }
+    out << '\n';
+
+    for (const SweepResult& result : results) {
+        for (int i = 0; i < SweepGrid::PARAMETER_COUNT; ++i) out << SweepGrid::parameterValue(result.params, i) << ',';
+        out << result.games << ',' << result.meanScore << ',' << result.medianScore << ','
+            << result.p90Score << ',' << result.maxScore << ',' << result.meanSeconds;
+        for (float alive : result.survival) out << ',' << alive;
+        for (uint32_t bucketGames : result.scoreHistogram) out << ',' << bucketGames;
+        out << '\n';
+    }
+}
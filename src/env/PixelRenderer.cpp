@@ -0,0 +1,339 @@
+/**
+ * @file PixelRenderer.cpp
+ * @brief Implementação do renderizador em software.
+ */
+#include "env/PixelRenderer.hpp"
+#include "Constants.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+    constexpr float BIRD_FRAME_TIME = 0.1f; ///< Mesmo intervalo entre frames das asas do Bird.
+    constexpr float FLOOR_SCROLL_SPEED = BACKGROUND_SCROLL_SPEED + 60.0f; ///< Mesma velocidade do Floor.
+
+    RgbPixel toPixel(const uint8_t* rgba, RgbPixel*) { return RgbPixel{rgba[0], rgba[1], rgba[2]}; }
+    uint8_t toPixel(const uint8_t* rgba, uint8_t*)
+    {
+        return static_cast<uint8_t>((77 * rgba[0] + 150 * rgba[1] + 29 * rgba[2]) >> 8);
+    }
+
+    inline uint8_t mix(uint8_t src, uint8_t dst, uint8_t alpha)
+    {
+        return static_cast<uint8_t>((src * alpha + dst * (255 - alpha) + 127) / 255);
+    }
+    inline void blend(RgbPixel& dst, const RgbPixel& src, uint8_t alpha)
+    {
+        dst.r = mix(src.r, dst.r, alpha);
+        dst.g = mix(src.g, dst.g, alpha);
+        dst.b = mix(src.b, dst.b, alpha);
+    }
+    inline void blend(uint8_t& dst, uint8_t src, uint8_t alpha) { dst = mix(src, dst, alpha); }
+
+    /**
+     * @brief Média de um bloco scale x scale da imagem; pixels fora dela contam como transparentes.
+     * @details A cor é ponderada pelo alfa, para as bordas não escurecerem com o preto dos transparentes.
+     */
+    template <typename SampleAt>
+    void averageBlock(SampleAt& sampleAt, int left, int top, int scale, uint8_t* rgba)
+    {
+        uint32_t sums[3] = {0, 0, 0};
+        uint32_t alpha = 0;
+        for (int y = top; y < top + scale; ++y) {
+            for (int x = left; x < left + scale; ++x) {
+                const uint8_t* sample = sampleAt(x, y);
+                if (!sample) continue;
+                for (int c = 0; c < 3; ++c) sums[c] += sample[c] * sample[3];
+                alpha += sample[3];
+            }
+        }
+        for (int c = 0; c < 3; ++c) rgba[c] = static_cast<uint8_t>(alpha ? (sums[c] + alpha / 2) / alpha : 0);
+        const uint32_t count = static_cast<uint32_t>(scale * scale);
+        rgba[3] = static_cast<uint8_t>((alpha + count / 2) / count);
+    }
+
+    /**
+     * @brief Converte uma imagem RGBA e divide cada linha em trechos visíveis.
+     * @param scale Fator de redução: cada pixel do sprite é a média de um bloco scale x scale.
+     * @param phaseX, phaseY Colunas e linhas transparentes antes da imagem (deslocamento dentro do bloco).
+     * @tparam SampleAt Função (x, y) -> ponteiro RGBA ou nullptr (fora da imagem).
+     */
+    template <typename Pixel, typename SampleAt>
+    PixelSprite<Pixel> buildSprite(int sourceWidth, int sourceHeight, int scale, int phaseX, int phaseY,
+                                   SampleAt& sampleAt)
+    {
+        const int width = (sourceWidth + phaseX + scale - 1) / scale;
+        const int height = (sourceHeight + phaseY + scale - 1) / scale;
+        PixelSprite<Pixel> sprite;
+        sprite.width = width;
+        sprite.height = height;
+        sprite.pixels.resize(static_cast<size_t>(width) * height);
+        sprite.alpha.resize(sprite.pixels.size());
+        sprite.rowSpans.push_back(0);
+        auto shifted = [&](int x, int y) -> const uint8_t* {
+            x -= phaseX;
+            y -= phaseY;
+            return x >= 0 && y >= 0 && x < sourceWidth && y < sourceHeight ? sampleAt(x, y) : nullptr;
+        };
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                uint8_t rgba[4];
+                averageBlock(shifted, x * scale, y * scale, scale, rgba);
+                const size_t i = static_cast<size_t>(y) * width + x;
+                sprite.pixels[i] = toPixel(rgba, static_cast<Pixel*>(nullptr));
+                sprite.alpha[i] = rgba[3];
+            }
+            // Trechos maximais de pixels visíveis com a mesma opacidade (total ou parcial).
+            const uint8_t* alpha = &sprite.alpha[static_cast<size_t>(y) * width];
+            for (int x = 0; x < width;) {
+                if (alpha[x] == 0) { ++x; continue; }
+                const bool opaque = alpha[x] == 255;
+                int end = x + 1;
+                while (end < width && alpha[end] != 0 && (alpha[end] == 255) == opaque) ++end;
+                sprite.spans.push_back(PixelSpan{static_cast<uint16_t>(x), static_cast<uint16_t>(end - x),
+                                                 static_cast<uint8_t>(opaque)});
+                x = end;
+            }
+            sprite.rowSpans.push_back(static_cast<uint32_t>(sprite.spans.size()));
+        }
+        return sprite;
+    }
+
+    /// Todas as scale x scale versões deslocadas de um sprite (só uma quando scale é 1).
+    template <typename Pixel, typename SampleAt>
+    PhasedSprite<Pixel> buildPhased(int sourceWidth, int sourceHeight, int scale, SampleAt sampleAt)
+    {
+        PhasedSprite<Pixel> sprite;
+        sprite.width = sourceWidth;
+        sprite.height = sourceHeight;
+        for (int phaseY = 0; phaseY < scale; ++phaseY) {
+            for (int phaseX = 0; phaseX < scale; ++phaseX) {
+                sprite.phases.push_back(buildSprite<Pixel>(sourceWidth, sourceHeight, scale, phaseX, phaseY, sampleAt));
+            }
+        }
+        return sprite;
+    }
+
+    template <typename Pixel>
+    PhasedSprite<Pixel> buildSprite(const RgbaImage& image, bool flipped, int scale)
+    {
+        return buildPhased<Pixel>(image.width, image.height, scale, [&](int x, int y) {
+            return flipped ? image.at(image.width - 1 - x, image.height - 1 - y) : image.at(x, y);
+        });
+    }
+
+    /**
+     * @brief Uma camada que rola (fundo ou chão) com a segunda cópia já colada BUFFER_W pixels depois.
+     * @details Como ParallaxBackground e Floor, a segunda cópia fica por cima onde as duas se cobrem.
+     * Num sprite só, a emenda é reduzida junto com o resto e cada linha continua um trecho opaco.
+     */
+    template <typename Pixel>
+    PhasedSprite<Pixel> buildTiledSprite(const RgbaImage& image, int scale)
+    {
+        return buildPhased<Pixel>(BUFFER_W + image.width, image.height, scale, [&](int x, int y) -> const uint8_t* {
+            const int copyX = x >= BUFFER_W ? x - BUFFER_W : x;
+            return copyX < image.width ? image.at(copyX, y) : nullptr;
+        });
+    }
+
+    /**
+     * @brief Gira o pássaro em torno do centro, como o al_draw_rotated_bitmap do Bird::draw.
+     * @details O resultado é um quadrado do tamanho da diagonal, com o centro no centro do sprite.
+     */
+    template <typename Pixel>
+    PhasedSprite<Pixel> buildRotatedSprite(const RgbaImage& image, int degrees, int scale)
+    {
+        const int side = static_cast<int>(std::ceil(std::hypot(image.width, image.height)));
+        const float radians = degrees * 3.14159265f / 180.0f;
+        const float c = std::cos(radians), s = std::sin(radians);
+        const float half = side / 2.0f;
+        return buildPhased<Pixel>(side, side, scale, [&](int x, int y) -> const uint8_t* {
+            const float dx = x + 0.5f - half, dy = y + 0.5f - half;
+            const int sx = static_cast<int>(std::floor(image.width / 2.0f + c * dx - s * dy));
+            const int sy = static_cast<int>(std::floor(image.height / 2.0f + s * dx + c * dy));
+            if (sx < 0 || sy < 0 || sx >= image.width || sy >= image.height) return nullptr;
+            return image.at(sx, sy);
+        });
+    }
+
+    template <typename Pixel>
+    void buildLayers(PixelLayers<Pixel>& layers, const SpriteAtlas& atlas, const PixelTheme& theme, int scale)
+    {
+        layers.scale = scale;
+        layers.background = buildTiledSprite<Pixel>(atlas.getSprite(theme.background), scale);
+        layers.floor = buildTiledSprite<Pixel>(atlas.getSprite(theme.floor), scale);
+        const RgbaImage pipe = atlas.getSprite(theme.pipe);
+        layers.pipe = buildSprite<Pixel>(pipe, false, scale);
+        layers.pipeFlipped = buildSprite<Pixel>(pipe, true, scale);
+        for (const std::string& frame : theme.birdFrames) {
+            const RgbaImage bird = atlas.getSprite(frame);
+            for (int a = 0; a < PixelRenderer::BIRD_ANGLES; ++a) {
+                layers.bird.push_back(buildRotatedSprite<Pixel>(bird, PixelRenderer::MIN_ANGLE + a, scale));
+            }
+        }
+    }
+
+    /// Um quadro de width x height pixels, linha a linha.
+    template <typename Pixel>
+    struct Canvas {
+        Pixel* pixels;
+        int width;
+        int height;
+    };
+
+    /**
+     * @brief Desenha um sprite com o canto superior esquerdo em (left, top), recortado ao quadro.
+     */
+    template <typename Pixel>
+    void blit(const PixelSprite<Pixel>& sprite, int left, int top, const Canvas<Pixel>& canvas)
+    {
+        const int firstRow = std::max(0, -top);
+        const int lastRow = std::min(sprite.height, canvas.height - top);
+        for (int y = firstRow; y < lastRow; ++y) {
+            Pixel* row = canvas.pixels + static_cast<size_t>(top + y) * canvas.width;
+            const Pixel* pixels = &sprite.pixels[static_cast<size_t>(y) * sprite.width];
+            const uint8_t* alpha = &sprite.alpha[static_cast<size_t>(y) * sprite.width];
+            for (uint32_t s = sprite.rowSpans[y]; s < sprite.rowSpans[y + 1]; ++s) {
+                const PixelSpan& span = sprite.spans[s];
+                const int from = std::max<int>(span.x, -left);
+                const int to = std::min<int>(span.x + span.length, canvas.width - left);
+                if (from >= to) continue;
+                if (span.opaque) {
+                    std::memcpy(row + left + from, pixels + from, (to - from) * sizeof(Pixel));
+                } else {
+                    for (int x = from; x < to; ++x) blend(row[left + x], pixels[x], alpha[x]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Desenha um sprite com o canto superior esquerdo em (left, top) da imagem cheia.
+     * @details Escolhe a versão deslocada que cai no quadro reduzido na mesma posição.
+     */
+    template <typename Pixel>
+    void blit(const PhasedSprite<Pixel>& sprite, int left, int top, int scale, const Canvas<Pixel>& canvas)
+    {
+        // Divisão arredondada para baixo: o fundo e o chão rolam para posições negativas.
+        const int x = (left >= 0 ? left : left - scale + 1) / scale;
+        const int y = (top >= 0 ? top : top - scale + 1) / scale;
+        blit(sprite.phases[(top - y * scale) * scale + (left - x * scale)], x, y, canvas);
+    }
+
+    /// Posição de rolagem de uma camada que anda speed px/s e volta a 0 a cada BUFFER_W pixels.
+    int scrollOffset(uint32_t tick, float speed)
+    {
+        const float distance = std::fmod(tick * GameSimulation::TICK * speed, static_cast<float>(BUFFER_W));
+        return -static_cast<int>(distance);
+    }
+
+    /**
+     * @brief Pesos do intervalo [start, end) da imagem cheia sobre os pixels do quadro reduzido.
+     * @param size Pixels do quadro reduzido nessa direção; os taps nunca passam dele.
+     */
+    template <int TAPS>
+    void fillTaps(int start, int end, int scale, int size, int& first, int (&weight)[TAPS])
+    {
+        first = std::min(start / scale, size - TAPS);
+        for (int t = 0; t < TAPS; ++t) {
+            const int from = (first + t) * scale;
+            weight[t] = std::max(0, std::min(from + scale, end) - std::max(from, start));
+        }
+    }
+
+    /// Mesma ordem de GameScene::draw: fundo, canos, chão e pássaro.
+    template <typename Pixel>
+    void drawScene(const PixelLayers<Pixel>& layers, const SimState& state, Pixel* pixels)
+    {
+        // As posições são todas da imagem cheia; blit() as leva ao quadro reduzido por scale.
+        const int scale = layers.scale;
+        const Canvas<Pixel> canvas{pixels, BUFFER_W / scale, BUFFER_H / scale};
+        blit(layers.background, scrollOffset(state.tick, BACKGROUND_SCROLL_SPEED), 0, scale, canvas);
+
+        const PipeCourse& course = state.course;
+        for (int p = 0; p < course.getCount(); ++p) {
+            const int x = static_cast<int>(std::lround(course.getX(p)));
+            const int gapTop = static_cast<int>(std::lround(course.getGapTop(p)));
+            const int gapBottom = static_cast<int>(std::lround(course.getGapBottom(p)));
+            blit(layers.pipeFlipped, x, gapTop - layers.pipeFlipped.height, scale, canvas);
+            blit(layers.pipe, x, gapBottom, scale, canvas);
+        }
+
+        blit(layers.floor, scrollOffset(state.tick, FLOOR_SCROLL_SPEED), PLAYABLE_AREA_HEIGHT, scale, canvas);
+
+        const int frameCount = static_cast<int>(layers.bird.size()) / PixelRenderer::BIRD_ANGLES;
+        const int frame = static_cast<int>(state.tick * GameSimulation::TICK / BIRD_FRAME_TIME) % frameCount;
+        const int angle = std::min(std::max(static_cast<int>(std::lround(state.birdAngle)), PixelRenderer::MIN_ANGLE),
+                                   PixelRenderer::MIN_ANGLE + PixelRenderer::BIRD_ANGLES - 1);
+        const PhasedSprite<Pixel>& bird = layers.bird[frame * PixelRenderer::BIRD_ANGLES + angle - PixelRenderer::MIN_ANGLE];
+        const float centerX = BIRD_START_X + BIRD_WIDTH / 2.0f;
+        const float centerY = state.birdY + BIRD_HEIGHT / 2.0f;
+        blit(bird, static_cast<int>(std::lround(centerX - bird.width / 2.0f)),
+             static_cast<int>(std::lround(centerY - bird.height / 2.0f)), scale, canvas);
+    }
+}
+
+PixelRenderer::PixelRenderer(const SpriteAtlas& atlas, const PixelTheme& theme)
+{
+    buildLayers(rgb, atlas, theme, 1);
+    buildLayers(gray, atlas, theme, GRAY_SCALE);
+    for (int i = 0; i < GRAY_SIZE; ++i) {
+        const int top = i * BUFFER_H / GRAY_SIZE, bottom = (i + 1) * BUFFER_H / GRAY_SIZE;
+        int weight[ROW_TAPS];
+        fillTaps(top, bottom, GRAY_SCALE, GRAY_CANVAS_H, rowFirst[i], weight);
+        for (int t = 0; t < ROW_TAPS; ++t) rowWeight[i][t] = static_cast<uint8_t>(weight[t]);
+        blockRows[i] = static_cast<uint8_t>(bottom - top);
+    }
+    // O 1/área de cada bloco (16.16) já vai multiplicado no peso das colunas, para as duas alturas de bloco possíveis.
+    for (int gx = 0; gx < GRAY_SIZE; ++gx) {
+        const int left = gx * BUFFER_W / GRAY_SIZE, right = (gx + 1) * BUFFER_W / GRAY_SIZE;
+        int weight[COLUMN_TAPS];
+        fillTaps(left, right, GRAY_SCALE, GRAY_CANVAS_W, columnFirst[gx], weight);
+        for (int rows = MIN_BLOCK_ROWS; rows <= MIN_BLOCK_ROWS + 1; ++rows) {
+            const uint32_t area = rows * (right - left);
+            const uint32_t reciprocal = (65536u + area / 2) / area;
+            for (int t = 0; t < COLUMN_TAPS; ++t) columnWeight[rows - MIN_BLOCK_ROWS][t][gx] = weight[t] * reciprocal;
+        }
+    }
+}
+
+size_t PixelRenderer::frameBytes(PixelFormat format)
+{
+    return format == PixelFormat::RGB ? static_cast<size_t>(BUFFER_W) * BUFFER_H * sizeof(RgbPixel)
+                                      : static_cast<size_t>(GRAY_SIZE) * GRAY_SIZE;
+}
+
+void PixelRenderer::render(const SimState& state, PixelFormat format, uint8_t* out) const
+{
+    if (format == PixelFormat::RGB) {
+        drawScene(rgb, state, reinterpret_cast<RgbPixel*>(out));
+        return;
+    }
+
+    // Quadro reduzido em cinza (um por thread, reaproveitado entre quadros) e depois médias de blocos.
+    thread_local std::vector<uint8_t> canvas(static_cast<size_t>(GRAY_CANVAS_W) * GRAY_CANVAS_H);
+    const uint8_t* pixels = canvas.data();
+    drawScene(gray, state, canvas.data());
+
+    // Médias dos mesmos blocos da imagem cheia, com os pesos pré-calculados no construtor. Primeiro
+    // as linhas do bloco são somadas coluna a coluna (laço contínuo, vetorizável); depois cada bloco
+    // soma só os seus COLUMN_TAPS pixels, já ponderados por 1/área.
+    uint16_t rowSums[GRAY_CANVAS_W];
+    for (int gy = 0; gy < GRAY_SIZE; ++gy) {
+        const uint8_t* weight = rowWeight[gy];
+        const uint8_t* first = pixels + static_cast<size_t>(rowFirst[gy]) * GRAY_CANVAS_W;
+        for (int x = 0; x < GRAY_CANVAS_W; ++x) {
+            uint16_t sum = 0;
+            for (int t = 0; t < ROW_TAPS; ++t) sum = static_cast<uint16_t>(sum + weight[t] * first[t * GRAY_CANVAS_W + x]);
+            rowSums[x] = sum;
+        }
+        const uint32_t (&columns)[COLUMN_TAPS][GRAY_SIZE] = columnWeight[blockRows[gy] - MIN_BLOCK_ROWS];
+        uint8_t* row = out + gy * GRAY_SIZE;
+        for (int gx = 0; gx < GRAY_SIZE; ++gx) {
+            const uint16_t* sums = rowSums + columnFirst[gx];
+            uint32_t sum = 1u << 15;
+            for (int t = 0; t < COLUMN_TAPS; ++t) sum += columns[t][gx] * sums[t];
+            row[gx] = static_cast<uint8_t>(sum >> 16);
+        }
+    }
+}
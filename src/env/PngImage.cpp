@@ -0,0 +1,268 @@
+/**
+ * @file PngImage.cpp
+ * @brief Implementação do decodificador de PNG e do inflate.
+ */
+#include "env/PngImage.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+    /// Leitor de bits na ordem do DEFLATE (bit menos significativo primeiro).
+    struct BitReader {
+        const uint8_t* data;
+        size_t size;
+        size_t pos = 0;
+        uint32_t bitBuffer = 0;
+        int bitCount = 0;
+
+        uint32_t bits(int count)
+        {
+            while (bitCount < count) {
+                if (pos >= size) throw std::runtime_error("PNG: dados compactados truncados");
+                bitBuffer |= static_cast<uint32_t>(data[pos++]) << bitCount;
+                bitCount += 8;
+            }
+            uint32_t value = bitBuffer & ((1u << count) - 1);
+            bitBuffer >>= count;
+            bitCount -= count;
+            return value;
+        }
+
+        void alignToByte()
+        {
+            bitBuffer = 0;
+            bitCount = 0;
+        }
+    };
+
+    /// Código de Huffman canônico: contagem por comprimento e símbolos ordenados.
+    struct Huffman {
+        uint16_t counts[16];
+        uint16_t symbols[288];
+
+        void build(const uint8_t* lengths, int n)
+        {
+            for (uint16_t& c : counts) c = 0;
+            for (int i = 0; i < n; ++i) ++counts[lengths[i]];
+            counts[0] = 0;
+            uint16_t offsets[16];
+            offsets[1] = 0;
+            for (int len = 1; len < 15; ++len) offsets[len + 1] = offsets[len] + counts[len];
+            for (int i = 0; i < n; ++i) {
+                if (lengths[i]) symbols[offsets[lengths[i]]++] = static_cast<uint16_t>(i);
+            }
+        }
+
+        int decode(BitReader& in) const
+        {
+            int code = 0, first = 0, index = 0;
+            for (int len = 1; len < 16; ++len) {
+                code |= static_cast<int>(in.bits(1));
+                const int count = counts[len];
+                if (code - count < first) return symbols[index + (code - first)];
+                index += count;
+                first = (first + count) << 1;
+                code <<= 1;
+            }
+            throw std::runtime_error("PNG: código de Huffman inválido");
+        }
+    };
+
+    const uint16_t LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                      35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    const uint8_t LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                      3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+    const uint16_t DIST_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+    const uint8_t DIST_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+    void inflateBlock(BitReader& in, const Huffman& lengths, const Huffman& distances, std::vector<uint8_t>& out)
+    {
+        for (;;) {
+            int symbol = lengths.decode(in);
+            if (symbol < 256) {
+                out.push_back(static_cast<uint8_t>(symbol));
+            } else if (symbol == 256) {
+                return;
+            } else {
+                symbol -= 257;
+                if (symbol >= 29) throw std::runtime_error("PNG: comprimento inválido");
+                const size_t length = LENGTH_BASE[symbol] + in.bits(LENGTH_EXTRA[symbol]);
+                const int d = distances.decode(in);
+                if (d >= 30) throw std::runtime_error("PNG: distância inválida");
+                const size_t distance = DIST_BASE[d] + in.bits(DIST_EXTRA[d]);
+                if (distance > out.size()) throw std::runtime_error("PNG: distância além do início");
+                size_t from = out.size() - distance;
+                for (size_t i = 0; i < length; ++i) out.push_back(out[from + i]);
+            }
+        }
+    }
+
+    /// Descompacta um fluxo zlib (cabeçalho de 2 bytes + DEFLATE).
+    std::vector<uint8_t> inflateZlib(const std::vector<uint8_t>& data, size_t expected)
+    {
+        if (data.size() < 2 || (data[0] & 0x0F) != 8) throw std::runtime_error("PNG: fluxo zlib inválido");
+        BitReader in{data.data() + 2, data.size() - 2};
+        std::vector<uint8_t> out;
+        out.reserve(expected);
+
+        bool last = false;
+        while (!last) {
+            last = in.bits(1) != 0;
+            const uint32_t type = in.bits(2);
+            if (type == 0) {
+                in.alignToByte();
+                if (in.pos + 4 > in.size) throw std::runtime_error("PNG: bloco truncado");
+                const size_t length = in.data[in.pos] | (in.data[in.pos + 1] << 8);
+                in.pos += 4;
+                if (in.pos + length > in.size) throw std::runtime_error("PNG: bloco truncado");
+                out.insert(out.end(), in.data + in.pos, in.data + in.pos + length);
+                in.pos += length;
+            } else if (type == 1) {
+                static Huffman fixedLengths, fixedDistances;
+                static bool built = false;
+                if (!built) {
+                    uint8_t lengths[288];
+                    for (int i = 0; i < 288; ++i) lengths[i] = i < 144 ? 8 : i < 256 ? 9 : i < 280 ? 7 : 8;
+                    fixedLengths.build(lengths, 288);
+                    for (int i = 0; i < 30; ++i) lengths[i] = 5;
+                    fixedDistances.build(lengths, 30);
+                    built = true;
+                }
+                inflateBlock(in, fixedLengths, fixedDistances, out);
+            } else if (type == 2) {
+                const int literalCount = static_cast<int>(in.bits(5)) + 257;
+                const int distanceCount = static_cast<int>(in.bits(5)) + 1;
+                const int codeCount = static_cast<int>(in.bits(4)) + 4;
+                static const uint8_t ORDER[19] = {16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
+                uint8_t codeLengths[19] = {0};
+                for (int i = 0; i < codeCount; ++i) codeLengths[ORDER[i]] = static_cast<uint8_t>(in.bits(3));
+                Huffman codes;
+                codes.build(codeLengths, 19);
+
+                uint8_t lengths[320] = {0};
+                int n = 0;
+                while (n < literalCount + distanceCount) {
+                    const int symbol = codes.decode(in);
+                    int repeat = 1;
+                    uint8_t value = 0;
+                    if (symbol < 16) {
+                        value = static_cast<uint8_t>(symbol);
+                    } else if (symbol == 16) {
+                        if (n == 0) throw std::runtime_error("PNG: repetição sem comprimento anterior");
+                        value = lengths[n - 1];
+                        repeat = 3 + static_cast<int>(in.bits(2));
+                    } else if (symbol == 17) {
+                        repeat = 3 + static_cast<int>(in.bits(3));
+                    } else {
+                        repeat = 11 + static_cast<int>(in.bits(7));
+                    }
+                    if (n + repeat > literalCount + distanceCount) throw std::runtime_error("PNG: comprimentos inválidos");
+                    while (repeat--) lengths[n++] = value;
+                }
+                Huffman literals, distances;
+                literals.build(lengths, literalCount);
+                distances.build(lengths + literalCount, distanceCount);
+                inflateBlock(in, literals, distances, out);
+            } else {
+                throw std::runtime_error("PNG: tipo de bloco inválido");
+            }
+        }
+        return out;
+    }
+
+    uint32_t readBigEndian(const uint8_t* p)
+    {
+        return (static_cast<uint32_t>(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+    }
+
+    int paeth(int a, int b, int c)
+    {
+        const int p = a + b - c;
+        const int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+        if (pa <= pb && pa <= pc) return a;
+        return pb <= pc ? b : c;
+    }
+}
+
+RgbaImage decodePng(const std::vector<uint8_t>& data)
+{
+    static const uint8_t SIGNATURE[8] = {137, 'P', 'N', 'G', 13, 10, 26, 10};
+    if (data.size() < 8 || !std::equal(SIGNATURE, SIGNATURE + 8, data.begin())) {
+        throw std::runtime_error("PNG: assinatura inválida");
+    }
+
+    RgbaImage image;
+    int channels = 0;
+    std::vector<uint8_t> compressed;
+    for (size_t pos = 8; pos + 12 <= data.size();) {
+        const uint32_t length = readBigEndian(&data[pos]);
+        const std::string type(reinterpret_cast<const char*>(&data[pos + 4]), 4);
+        if (pos + 12 + length > data.size()) throw std::runtime_error("PNG: chunk truncado");
+        const uint8_t* body = &data[pos + 8];
+
+        if (type == "IHDR") {
+            image.width = static_cast<int>(readBigEndian(body));
+            image.height = static_cast<int>(readBigEndian(body + 4));
+            const uint8_t depth = body[8], colorType = body[9], interlace = body[12];
+            if (depth != 8 || (colorType != 2 && colorType != 6) || interlace != 0) {
+                throw std::runtime_error("PNG: só são suportadas imagens RGB/RGBA de 8 bits sem entrelaçamento");
+            }
+            channels = colorType == 6 ? 4 : 3;
+        } else if (type == "IDAT") {
+            compressed.insert(compressed.end(), body, body + length);
+        } else if (type == "IEND") {
+            break;
+        }
+        pos += 12 + length;
+    }
+    if (channels == 0 || image.width <= 0 || image.height <= 0) throw std::runtime_error("PNG: sem cabeçalho IHDR");
+
+    // Cada linha começa com o tipo de filtro, seguido dos pixels.
+    const size_t stride = static_cast<size_t>(image.width) * channels;
+    const std::vector<uint8_t> raw = inflateZlib(compressed, (stride + 1) * image.height);
+    if (raw.size() < (stride + 1) * image.height) throw std::runtime_error("PNG: dados da imagem incompletos");
+
+    std::vector<uint8_t> current(stride), previous(stride, 0);
+    image.pixels.resize(static_cast<size_t>(image.width) * image.height * 4);
+    for (int y = 0; y < image.height; ++y) {
+        const uint8_t* line = &raw[y * (stride + 1)];
+        const uint8_t filter = line[0];
+        for (size_t i = 0; i < stride; ++i) {
+            const int a = i >= static_cast<size_t>(channels) ? current[i - channels] : 0;
+            const int b = previous[i];
+            const int c = i >= static_cast<size_t>(channels) ? previous[i - channels] : 0;
+            int predictor;
+            switch (filter) {
+                case 0: predictor = 0; break;
+                case 1: predictor = a; break;
+                case 2: predictor = b; break;
+                case 3: predictor = (a + b) / 2; break;
+                case 4: predictor = paeth(a, b, c); break;
+                default: throw std::runtime_error("PNG: filtro de linha inválido");
+            }
+            current[i] = static_cast<uint8_t>(line[1 + i] + predictor);
+        }
+
+        uint8_t* out = &image.pixels[static_cast<size_t>(y) * image.width * 4];
+        for (int x = 0; x < image.width; ++x) {
+            out[x * 4 + 0] = current[x * channels + 0];
+            out[x * 4 + 1] = current[x * channels + 1];
+            out[x * 4 + 2] = current[x * channels + 2];
+            out[x * 4 + 3] = channels == 4 ? current[x * channels + 3] : 255;
+        }
+        previous.swap(current);
+    }
+    return image;
+}
+
+RgbaImage loadPng(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("Não foi possível abrir a imagem: " + path);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return decodePng(data);
+}
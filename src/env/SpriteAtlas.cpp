@@ -0,0 +1,50 @@
+/**
+ * @file SpriteAtlas.cpp
+ * @brief Implementação do carregamento do atlas sem Allegro.
+ */
+#include "env/SpriteAtlas.hpp"
+#include "util/json.hpp"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+SpriteAtlas::SpriteAtlas(const std::string& imagePath, const std::string& jsonPath)
+    : image(loadPng(imagePath))
+{
+    std::ifstream file(jsonPath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Falha ao abrir o arquivo JSON do atlas: " + jsonPath);
+    }
+
+    nlohmann::json json;
+    try {
+        file >> json;
+        for (const auto& entry : json.at("sprites")) {
+            rects[entry.at("fileName").get<std::string>()] = Rect{
+                entry.at("x").get<int>(), entry.at("y").get<int>(),
+                entry.at("width").get<int>(), entry.at("height").get<int>()};
+        }
+    } catch (const nlohmann::json::exception& e) {
+        throw std::runtime_error("Erro ao analisar o JSON do atlas: " + std::string(e.what()));
+    }
+}
+
+RgbaImage SpriteAtlas::getSprite(const std::string& name) const
+{
+    auto it = rects.find(name);
+    if (it == rects.end()) throw std::runtime_error("Sprite não encontrado no atlas: " + name);
+    const Rect& r = it->second;
+    if (r.x < 0 || r.y < 0 || r.width <= 0 || r.height <= 0 ||
+        r.x + r.width > image.width || r.y + r.height > image.height) {
+        throw std::runtime_error("Sprite fora do atlas: " + name);
+    }
+
+    RgbaImage sprite;
+    sprite.width = r.width;
+    sprite.height = r.height;
+    sprite.pixels.resize(static_cast<size_t>(r.width) * r.height * 4);
+    for (int y = 0; y < r.height; ++y) {
+        std::memcpy(&sprite.pixels[static_cast<size_t>(y) * r.width * 4], image.at(r.x, r.y + y), r.width * 4);
+    }
+    return sprite;
+}
@@ -4,7 +4,115 @@
  */
 
 #include "core/Game.hpp"
+#include "core/LaunchOptions.hpp"
+#include "env/BotController.hpp"
+#include "env/BotRunner.hpp"
+#include "env/DifficultySweep.hpp"
+#include "sim/ReplayVerifier.hpp"
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Joga as partidas de --headless com o bot de --bot, sem abrir janela nem áudio.
+     * @details Mostra a pontuação média, a máxima e quantas partidas chegaram ao limite de passos.
+     */
+    void runHeadless(const LaunchOptions& options)
+    {
+        BotLibrary library(options.bot.path);
+        BotRunner runner(library.getController(), options.bot.threads);
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<BotGameResult> results = runner.run(options.versus.seed, options.bot.headlessGames);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        long long total = 0;
+        int32_t best = 0;
+        size_t capped = 0;
+        for (const BotGameResult& result : results) {
+            total += result.score;
+            best = std::max(best, result.score);
+            capped += !result.died;
+        }
+        std::cout << library.getController()->name << ": " << results.size() << " partidas em "
+                  << elapsed << " s (" << runner.getThreadCount() << " threads)\n"
+                  << "  pontuação média: " << static_cast<double>(total) / results.size() << "\n"
+                  << "  pontuação máxima: " << best << "\n"
+                  << "  partidas no limite de passos: " << capped << std::endl;
+    }
+
+    /**
+     * @brief Joga a varredura de --sweep e grava o CSV, sem abrir janela nem áudio.
+     * @details Sem --bot, quem joga é o autopilot embutido do DifficultySweep.
+     */
+    void runSweep(const LaunchOptions& options)
+    {
+        SweepGrid grid = SweepGrid::load(options.sweep.gridPath);
+        std::unique_ptr<BotLibrary> library;
+        if (!options.bot.path.empty()) library = std::make_unique<BotLibrary>(options.bot.path);
+        DifficultySweep sweep(library ? library->getController() : nullptr, options.bot.threads);
+        const uint32_t maxTicks = static_cast<uint32_t>(options.sweep.seconds * FPS);
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<SweepResult> results = sweep.run(grid, options.versus.seed, options.sweep.games, maxTicks);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::ofstream out(options.sweep.outputPath);
+        DifficultySweep::writeCsv(out, results);
+        if (!out) {
+            throw std::runtime_error("Não foi possível gravar " + options.sweep.outputPath);
+        }
+        std::cout << (library ? library->getController()->name : "autopilot") << ": "
+                  << results.size() << " combinações x " << options.sweep.games << " partidas em "
+                  << elapsed << " s (" << sweep.getThreadCount() << " threads)\n"
+                  << "  resultados em " << options.sweep.outputPath << std::endl;
+    }
+
+    /**
+     * @brief Confere os replays de --verify re-simulando as partidas, sem abrir janela.
+     * @details Pastas são percorridas em busca de arquivos .replay. Mostra cada
+     * replay inválido e o total.
+     * @return true se todos os replays forem válidos.
+     */
+    bool runVerify(const LaunchOptions& options)
+    {
+        std::vector<std::string> paths;
+        for (const std::string& path : options.verify) {
+            if (!std::filesystem::is_directory(path)) {
+                paths.push_back(path);
+                continue;
+            }
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path)) {
+                if (entry.is_regular_file() && entry.path().extension() == ".replay") {
+                    paths.push_back(entry.path().string());
+                }
+            }
+        }
+
+        ReplayVerifier verifier(options.bot.threads);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<ReplayCheck> checks = verifier.verifyFiles(paths);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        size_t invalid = 0;
+        for (size_t i = 0; i < checks.size(); ++i) {
+            if (checks[i].valid()) continue;
+            ++invalid;
+            std::cout << paths[i] << ": " << ReplayVerifier::describe(checks[i].status);
+            if (checks[i].tick >= 0) std::cout << " (passo " << checks[i].tick << ")";
+            std::cout << "\n";
+        }
+        std::cout << checks.size() << " replays conferidos em " << elapsed << " s ("
+                  << verifier.getThreadCount() << " threads): " << checks.size() - invalid
+                  << " válidos, " << invalid << " inválidos" << std::endl;
+        return invalid == 0;
+    }
+}
 
 /**
  * @brief Função principal da aplicação.
@@ -12,14 +120,36 @@
  * Cria uma instância do jogo e executa o loop principal. 
  * Utiliza blocos try-catch para capturar exceções durante a execução.
  * 
+ * @param argc Número de argumentos.
+ * @param argv Argumentos da linha de comando (ver LaunchOptions::usage()).
  * @return int Código de retorno da aplicação (0 para sucesso, 1 para erro).
  */
-int main() {
+int main(int argc, char** argv) {
     try {
-        /// Instancia e inicia o jogo.
-        Game game;
+        LaunchOptions options = LaunchOptions::parse(argc, argv);
+        if (!options.verify.empty()) {
+            /// Conferência de replays sem janela; o código de saída indica se todos são válidos.
+            return runVerify(options) ? 0 : 1;
+        }
+        if (!options.sweep.gridPath.empty()) {
+            /// Varredura de dificuldade sem janela: não inicializa o Allegro.
+            runSweep(options);
+            return 0;
+        }
+        if (options.bot.headlessGames > 0) {
+            /// Partidas do bot sem janela: não inicializa o Allegro.
+            runHeadless(options);
+            return 0;
+        }
+        /// Instancia e inicia o jogo com as opções da linha de comando.
+        Game game(options);
         game.run();
     }
+    catch (const std::invalid_argument& e) {
+        /// Argumentos inválidos: mostra a mensagem e a sintaxe aceita.
+        std::cerr << e.what() << std::endl << LaunchOptions::usage();
+        return 1;
+    }
     catch (const std::exception& e) {
         /// Captura exceções padrão e imprime a mensagem de erro.
         std::cerr << "Uma exceção ocorreu: " << e.what() << std::endl;
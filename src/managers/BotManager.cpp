@@ -0,0 +1,16 @@
+/**
+ * @file BotManager.cpp
+ * @brief Implementação do gerenciador do bot.
+ */
+#include "managers/BotManager.hpp"
+
+BotManager& BotManager::getInstance()
+{
+    static BotManager instance;
+    return instance;
+}
+
+void BotManager::load(const std::string& path)
+{
+    library = std::make_unique<BotLibrary>(path);
+}
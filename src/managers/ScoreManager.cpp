@@ -2,13 +2,14 @@
 #include <iostream>
 #include "managers/ResourceManager.hpp"
 #include "Constants.hpp"
+#include "render/Renderer.hpp"
 
 /**
  * @brief Construtor do ScoreManager.
  * @details Pega as imagens dos dígitos (0 a 9) que já foram carregadas no ResourceManager.
  * Assim, ele fica pronto para desenhar os números na tela quando for preciso.
  */
-ScoreManager::ScoreManager() {
+ScoreManager::ScoreManager() : currentScore(0) {
     for (int i = 0; i < 10; ++i) {
         std::string digitId = std::to_string(i);
         // Pega o bitmap correspondente ao dígito e guarda no nosso array.
@@ -19,6 +20,49 @@ ScoreManager::ScoreManager() {
             throw std::runtime_error("Houve um erro ao carregar um sprite para o score");
         }
     }
+    layoutNumber(currentScore, scoreLayout);
+}
+
+/**
+ * @brief Define a pontuação atual.
+ * @details As cenas chamam isto a cada passo com o valor da simulação; o layout
+ * dos dígitos só é refeito quando a pontuação de fato muda.
+ * @param score A nova pontuação.
+ */
+void ScoreManager::setScore(int score) {
+    if (score == currentScore) return;
+    currentScore = score;
+    layoutNumber(currentScore, scoreLayout);
+}
+
+/**
+ * @brief Separa os dígitos sem std::to_string e guarda onde cada sprite começa.
+ * @param number O número (negativos são tratados como 0).
+ * @param layout Recebe os sprites e as posições, em escala 1.
+ */
+void ScoreManager::layoutNumber(int number, NumberLayout& layout) const {
+    if (number < 0) number = 0;
+
+    // Os dígitos saem do menos para o mais significativo; são guardados de trás para a frente.
+    int digits[NumberLayout::MAX_DIGITS];
+    int count = 0;
+    do {
+        digits[count++] = number % 10;
+        number /= 10;
+    } while (number > 0);
+
+    layout.count = 0;
+    layout.totalWidth = 0.0f;
+    for (int i = count - 1; i >= 0; --i) {
+        ALLEGRO_BITMAP* sprite = digitSprites[digits[i]];
+        if (!sprite) continue;
+        const int n = layout.count++;
+        layout.sprites[n] = sprite;
+        layout.x[n] = layout.totalWidth;
+        layout.width[n] = al_get_bitmap_width(sprite);
+        layout.height[n] = al_get_bitmap_height(sprite);
+        layout.totalWidth += layout.width[n];
+    }
 }
 
 /**
@@ -26,7 +70,7 @@ ScoreManager::ScoreManager() {
  */
 void ScoreManager::draw() const {
     // É um atalho para a função mais completa, usando valores padrão.
-    drawNumberSprites(currentScore, BUFFER_W / 2.0f, 10.0f, 0.75f, TextAlign::CENTER);
+    drawLayout(scoreLayout, BUFFER_W / 2.0f, 10.0f, 0.75f, TextAlign::CENTER);
 }
 
 /**
@@ -37,23 +81,15 @@ void ScoreManager::draw() const {
  * @return A largura total em pixels.
  */
 float ScoreManager::getNumberWidth(int number, float scale) const {
-    if (number < 0) number = 0;
-
-    std::string s = std::to_string(number);
-    float totalScaledWidth = 0;
-    
-    // Passa por cada dígito do número, somando a largura de cada imagem.
-    for (char c : s) {
-        int digit = c - '0';
-        if (digit >= 0 && digit <= 9 && digitSprites[digit]) {
-            totalScaledWidth += al_get_bitmap_width(digitSprites[digit]) * scale;
-        }
-    }
-    return totalScaledWidth;
+    if (number == currentScore) return scoreLayout.totalWidth * scale;
+    NumberLayout layout;
+    layoutNumber(number, layout);
+    return layout.totalWidth * scale;
 }
 
 /**
  * @brief A função principal que desenha um número na tela usando sprites.
+ * @details A pontuação atual usa o layout guardado; outros números são dispostos na hora, na pilha.
  * @param number O número a ser desenhado.
  * @param x A coordenada X de referência para o alinhamento.
  * @param y A coordenada Y onde o número será desenhado.
@@ -62,14 +98,29 @@ float ScoreManager::getNumberWidth(int number, float scale) const {
  */
 void ScoreManager::drawNumberSprites(int number, float x, float y, float scale, TextAlign align) const {
     if (number < 0) number = 0;
+    if (number == currentScore) {
+        drawLayout(scoreLayout, x, y, scale, align);
+        return;
+    }
+    NumberLayout layout;
+    layoutNumber(number, layout);
+    drawLayout(layout, x, y, scale, align);
+}
 
-    std::string s = std::to_string(number);
-    // Primeiro, calcula a largura total que o número vai ocupar.
-    float totalScaledWidth = getNumberWidth(number, scale);
+/**
+ * @brief Desenha os dígitos de um layout, um sprite escalado por dígito.
+ * @param layout Os dígitos já posicionados.
+ * @param x A coordenada X de referência para o alinhamento.
+ * @param y A coordenada Y onde o número será desenhado.
+ * @param scale A escala do desenho.
+ * @param align O tipo de alinhamento.
+ */
+void ScoreManager::drawLayout(const NumberLayout& layout, float x, float y, float scale, TextAlign align) const {
+    const float totalScaledWidth = layout.totalWidth * scale;
 
-    // Agora, calcula a posição X onde o desenho do primeiro dígito deve começar,
+    // Calcula a posição X onde o desenho do primeiro dígito deve começar,
     // com base no alinhamento que a gente quer.
-    float startX = 0;
+    float startX = x;
     switch (align) {
         case TextAlign::LEFT:
             // Alinhado à esquerda: começa exatamente no X que foi passado.
@@ -85,23 +136,10 @@ void ScoreManager::drawNumberSprites(int number, float x, float y, float scale,
             break;
     }
 
-    // Com o startX calculado, agora é só desenhar cada dígito, um depois do outro.
-    float currentDigitX = startX;
-
-    for (char c : s) {
-        int digit = c - '0';
-        if (digit >= 0 && digit <= 9 && digitSprites[digit]) {
-            ALLEGRO_BITMAP* digitSprite = digitSprites[digit];
-            float original_w = al_get_bitmap_width(digitSprite);
-            float original_h = al_get_bitmap_height(digitSprite);
-            float scaled_w = original_w * scale;
-            float scaled_h = original_h * scale;
-            
-            // Desenha o sprite do dígito atual.
-            al_draw_scaled_bitmap(digitSprite, 0, 0, original_w, original_h, currentDigitX, y, scaled_w, scaled_h, 0);
-            
-            // E avança a posição X para o próximo dígito.
-            currentDigitX += scaled_w;
-        }
+    // Com o startX calculado, agora é só desenhar cada dígito na posição guardada no layout.
+    Renderer& renderer = Renderer::current();
+    for (int i = 0; i < layout.count; ++i) {
+        renderer.drawScaledBitmap(layout.sprites[i], 0, 0, layout.width[i], layout.height[i],
+                                  startX + layout.x[i] * scale, y, layout.width[i] * scale, layout.height[i] * scale, 0);
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,52 @@
+/**
+ * @file LatencyInjector.cpp
+ * @brief Implementação da rede artificial com atraso, jitter e perda.
+ */
+#include "net/LatencyInjector.hpp"
+#include <cstring>
+
+LatencyInjector::LatencyInjector(float latencyMs, float jitterMs, float lossPercent, uint64_t seed)
+    : inFlight(0), dropped(0),
+      latency(latencyMs / 1000.0f), jitter(jitterMs / 1000.0f), loss(lossPercent / 100.0f)
+{
+    for (Slot& slot : slots) slot.size = 0;
+    random.seed(seed);
+}
+
+bool LatencyInjector::push(const uint8_t* data, size_t size, double now)
+{
+    if (size == 0 || size > MAX_PACKET || inFlight == CAPACITY || random.nextFloat() < loss) {
+        ++dropped;
+        return false;
+    }
+
+    float delay = latency + jitter * (2.0f * random.nextFloat() - 1.0f);
+    if (delay < 0.0f) delay = 0.0f;
+    for (Slot& slot : slots) {
+        if (slot.size != 0) continue;
+        slot.deliverAt = now + delay;
+        slot.size = static_cast<uint8_t>(size);
+        std::memcpy(slot.data, data, size);
+        ++inFlight;
+        break;
+    }
+    return true;
+}
+
+size_t LatencyInjector::pop(double now, uint8_t* out)
+{
+    if (inFlight == 0) return 0;
+
+    // Entrega o pacote pronto mais antigo; a fila é pequena e a busca linear basta.
+    Slot* ready = nullptr;
+    for (Slot& slot : slots) {
+        if (slot.size != 0 && slot.deliverAt <= now && (!ready || slot.deliverAt < ready->deliverAt)) ready = &slot;
+    }
+    if (!ready) return 0;
+
+    const size_t size = ready->size;
+    std::memcpy(out, ready->data, size);
+    ready->size = 0;
+    --inFlight;
+    return size;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file SpectatorBroadcast.cpp
+ * @brief Implementação da transmissão para espectadores.
+ */
+#include "net/SpectatorBroadcast.hpp"
+
+SpectatorBroadcast& SpectatorBroadcast::getInstance()
+{
+    static SpectatorBroadcast instance;
+    return instance;
+}
+
+void SpectatorBroadcast::start(const std::string& address)
+{
+    server = std::make_unique<StreamServer>(address);
+    encoder.reset();
+    pending.clear();
+    framesSinceFlush = 0;
+}
+
+void SpectatorBroadcast::stop()
+{
+    server.reset();
+    encoder.reset();
+    pending.clear();
+}
+
+void SpectatorBroadcast::publish(const SpectatorState& state)
+{
+    if (!server) return;
+    encoder.encode(state, pending);
+}
+
+void SpectatorBroadcast::poll()
+{
+    if (!server || ++framesSinceFlush < FLUSH_FRAMES) return;
+    framesSinceFlush = 0;
+
+    // Os registros pendentes só valem para quem já estava conectado; quem entra
+    // agora recebe um quadro-chave do estado em que esses registros terminam.
+    server->sendToAll(pending.data(), pending.size());
+    pending.clear();
+
+    const size_t before = server->getClientCount();
+    if (server->acceptClients() == 0 || !encoder.hasState()) return;
+    keyframe.clear();
+    encoder.encodeKeyframe(keyframe);
+    for (size_t c = before; c < server->getClientCount(); ++c) server->sendTo(c, keyframe.data(), keyframe.size());
+}
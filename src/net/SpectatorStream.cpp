@@ -0,0 +1,270 @@
+/**
+ * @file SpectatorStream.cpp
+ * @brief Codificação e decodificação do fluxo dos espectadores.
+ */
+#include "net/SpectatorStream.hpp"
+#include "sim/PipePhysics.hpp"
+#include "Constants.hpp"
+#include <cmath>
+#include <cstring>
+
+namespace {
+    constexpr uint8_t RECORD_KEYFRAME = 0x01;
+    constexpr uint8_t RECORD_DELTA = 0x80;   ///< Os bits baixos são as flags abaixo.
+    constexpr uint8_t DELTA_SCORE = 0x01;
+    constexpr uint8_t DELTA_PHASE = 0x02;
+    constexpr uint8_t DELTA_SPAWN = 0x04;
+
+    void writeVarint(std::vector<uint8_t>& out, uint32_t v)
+    {
+        while (v >= 0x80) {
+            out.push_back(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(v));
+    }
+
+    void writeSigned(std::vector<uint8_t>& out, int32_t value)
+    {
+        writeVarint(out, (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31));
+    }
+
+    void writeFixed(std::vector<uint8_t>& out, Fixed value)
+    {
+        const uint32_t bits = static_cast<uint32_t>(value.raw);
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+
+    /// Leitura com verificação de limites; 'ok' fica falso se os bytes acabarem.
+    struct Reader {
+        const uint8_t* data;
+        size_t size;
+        size_t pos;
+        bool ok;
+
+        uint8_t byte()
+        {
+            if (pos >= size) { ok = false; return 0; }
+            return data[pos++];
+        }
+
+        uint32_t varint()
+        {
+            uint32_t v = 0;
+            for (int shift = 0; shift < 35; shift += 7) {
+                uint8_t b = byte();
+                v |= static_cast<uint32_t>(b & 0x7F) << shift;
+                if (!(b & 0x80)) return v;
+            }
+            return v;
+        }
+
+        int32_t signedVarint()
+        {
+            uint32_t v = varint();
+            return static_cast<int32_t>((v >> 1) ^ (~(v & 1) + 1));
+        }
+
+        Fixed fixedBits()
+        {
+            uint32_t bits = 0;
+            for (int i = 0; i < 4; ++i) bits |= static_cast<uint32_t>(byte()) << (8 * i);
+            return Fixed::fromRaw(static_cast<int32_t>(bits));
+        }
+    };
+
+    /**
+     * @brief Decodifica um registro sobre 'state'.
+     * @return Bytes consumidos, 0 se o registro estiver incompleto ou -1 se for inválido.
+     */
+    long decodeRecord(const uint8_t* data, size_t size, SpectatorState& state, bool hasState)
+    {
+        Reader in{data, size, 0, true};
+        const uint8_t type = in.byte();
+        if (!in.ok) return 0;
+
+        SpectatorState next = state;
+        if (type == RECORD_KEYFRAME) {
+            next.tick = in.varint();
+            next.phase = static_cast<SimPhase>(in.byte());
+            next.score = in.signedVarint();
+            next.birdY = in.signedVarint();
+            next.birdAngle = in.signedVarint();
+            next.pipeCount = in.byte();
+            if (next.pipeCount > SpectatorState::MAX_PIPES) return -1;
+            for (int i = 0; i < next.pipeCount; ++i) {
+                next.pipeX[i] = in.fixedBits();
+                next.gapTop[i] = in.fixedBits();
+                next.gapBottom[i] = next.gapTop[i] + Fixed(PIPE_GAP);
+            }
+        } else if ((type & 0xF8) == RECORD_DELTA && hasState) {
+            // Um passo da simulação: os canos andam antes de um novo surgir.
+            next.tick += 1;
+            next.advancePipes();
+            if (type & DELTA_SCORE) next.score += in.signedVarint();
+            if (type & DELTA_PHASE) next.phase = static_cast<SimPhase>(in.byte());
+            if (type & DELTA_SPAWN) {
+                const int spawned = in.byte();
+                if (next.pipeCount + spawned > SpectatorState::MAX_PIPES) return -1;
+                for (int i = 0; i < spawned; ++i) next.spawnPipe(in.fixedBits());
+            }
+            next.birdY += in.signedVarint();
+            next.birdAngle += in.signedVarint();
+        } else {
+            return -1;
+        }
+
+        if (!in.ok) return 0;
+        state = next;
+        return static_cast<long>(in.pos);
+    }
+}
+
+// --- SpectatorState ---
+
+SpectatorState SpectatorState::from(const FixedSimState& state)
+{
+    SpectatorState view;
+    std::memset(&view, 0, sizeof(view));
+    view.tick = state.tick;
+    view.phase = state.phase;
+    view.score = state.score;
+    view.birdY = static_cast<int32_t>(std::lround(toFloat(state.birdY) * Y_SCALE));
+    view.birdAngle = static_cast<int32_t>(std::lround(toFloat(state.birdAngle)));
+    view.pipeCount = state.course.getCount();
+    for (int i = 0; i < view.pipeCount; ++i) {
+        view.pipeX[i] = state.course.getX(i);
+        view.gapTop[i] = state.course.getGapTop(i);
+        view.gapBottom[i] = state.course.getGapBottom(i);
+    }
+    return view;
+}
+
+void SpectatorState::advancePipes()
+{
+    for (int i = 0; i < pipeCount; ++i) advancePipe(pipeX[i], Fixed(PIPE_SPEED), FixedGameSimulation::SCALAR_TICK);
+
+    int removed = 0;
+    while (removed < pipeCount && pipeOffScreen(pipeX[removed], Fixed(PIPE_WIDTH))) ++removed;
+    for (int i = removed; i < pipeCount; ++i) {
+        pipeX[i - removed] = pipeX[i];
+        gapTop[i - removed] = gapTop[i];
+        gapBottom[i - removed] = gapBottom[i];
+    }
+    pipeCount -= removed;
+}
+
+void SpectatorState::spawnPipe(Fixed top)
+{
+    if (pipeCount == MAX_PIPES) return;
+    pipeX[pipeCount] = Fixed(BUFFER_W);
+    gapTop[pipeCount] = top;
+    gapBottom[pipeCount] = top + Fixed(PIPE_GAP);
+    ++pipeCount;
+}
+
+bool SpectatorState::operator==(const SpectatorState& other) const
+{
+    if (tick != other.tick || phase != other.phase || score != other.score || birdY != other.birdY ||
+        birdAngle != other.birdAngle || pipeCount != other.pipeCount) {
+        return false;
+    }
+    const size_t bytes = static_cast<size_t>(pipeCount) * sizeof(float);
+    return std::memcmp(pipeX, other.pipeX, bytes) == 0 && std::memcmp(gapTop, other.gapTop, bytes) == 0 &&
+           std::memcmp(gapBottom, other.gapBottom, bytes) == 0;
+}
+
+// --- SpectatorEncoder ---
+
+size_t SpectatorEncoder::encode(const SpectatorState& state, std::vector<uint8_t>& out)
+{
+    if (valid && state == mirror) return 0;
+
+    const size_t start = out.size();
+    if (valid && state.tick == mirror.tick + 1) {
+        // Os canos que sobram depois de andar um passo; os seguintes surgiram agora.
+        SpectatorState moved = mirror;
+        moved.advancePipes();
+        uint8_t flags = 0;
+        if (state.score != mirror.score) flags |= DELTA_SCORE;
+        if (state.phase != mirror.phase) flags |= DELTA_PHASE;
+        const int spawned = state.pipeCount - moved.pipeCount;
+        if (spawned > 0) flags |= DELTA_SPAWN;
+
+        out.push_back(RECORD_DELTA | flags);
+        if (flags & DELTA_SCORE) writeSigned(out, state.score - mirror.score);
+        if (flags & DELTA_PHASE) out.push_back(static_cast<uint8_t>(state.phase));
+        if (flags & DELTA_SPAWN) {
+            out.push_back(static_cast<uint8_t>(spawned));
+            for (int i = moved.pipeCount; i < state.pipeCount; ++i) writeFixed(out, state.gapTop[i]);
+        }
+        writeSigned(out, state.birdY - mirror.birdY);
+        writeSigned(out, state.birdAngle - mirror.birdAngle);
+
+        // Confere a diferença exatamente como um espectador a decodificaria.
+        SpectatorState check = mirror;
+        if (decodeRecord(out.data() + start, out.size() - start, check, true) > 0 && check == state) {
+            mirror = state;
+            return out.size() - start;
+        }
+        out.resize(start);
+    }
+
+    mirror = state;
+    valid = true;
+    encodeKeyframe(out);
+    return out.size() - start;
+}
+
+void SpectatorEncoder::encodeKeyframe(std::vector<uint8_t>& out) const
+{
+    if (!valid) return;
+    out.push_back(RECORD_KEYFRAME);
+    writeVarint(out, mirror.tick);
+    out.push_back(static_cast<uint8_t>(mirror.phase));
+    writeSigned(out, mirror.score);
+    writeSigned(out, mirror.birdY);
+    writeSigned(out, mirror.birdAngle);
+    out.push_back(static_cast<uint8_t>(mirror.pipeCount));
+    for (int i = 0; i < mirror.pipeCount; ++i) {
+        writeFixed(out, mirror.pipeX[i]);
+        writeFixed(out, mirror.gapTop[i]);
+    }
+}
+
+// --- SpectatorDecoder ---
+
+bool SpectatorDecoder::feed(const uint8_t* data, size_t size)
+{
+    if (corrupt) return false;
+    buffer.insert(buffer.end(), data, data + size);
+
+    size_t pos = 0;
+    while (pos < buffer.size()) {
+        long used = decodeRecord(buffer.data() + pos, buffer.size() - pos, current, valid);
+        if (used < 0) {
+            corrupt = true;
+            buffer.clear();
+            return false;
+        }
+        if (used == 0) break;
+        pos += static_cast<size_t>(used);
+        valid = true;
+        queue.push_back(current);
+    }
+    buffer.erase(buffer.begin(), buffer.begin() + pos);
+    return true;
+}
+
+bool SpectatorDecoder::pop(SpectatorState& state)
+{
+    if (queue.empty()) return false;
+    state = queue.front();
+    queue.pop_front();
+    return true;
+}
+
+void SpectatorDecoder::trim(size_t keep)
+{
+    while (queue.size() > keep) queue.pop_front();
+}
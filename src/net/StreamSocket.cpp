@@ -0,0 +1,207 @@
+/**
+ * @file StreamSocket.cpp
+ * @brief Implementação do servidor e do cliente de fluxo.
+ */
+#include "net/StreamSocket.hpp"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    const std::string UNIX_PREFIX = "unix:";
+
+    bool isUnixAddress(const std::string& address)
+    {
+        return address.compare(0, UNIX_PREFIX.size(), UNIX_PREFIX) == 0;
+    }
+
+    sockaddr_un unixAddress(const std::string& address)
+    {
+        const std::string path = address.substr(UNIX_PREFIX.size());
+        sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+            throw std::runtime_error("Caminho de socket inválido: " + path);
+        }
+        std::memcpy(addr.sun_path, path.c_str(), path.size());
+        return addr;
+    }
+
+    void setNonBlocking(int fd)
+    {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+
+    uint16_t parsePort(const std::string& text)
+    {
+        char* end = nullptr;
+        long port = std::strtol(text.c_str(), &end, 10);
+        if (text.empty() || *end != '\0' || port < 1 || port > 65535) {
+            throw std::runtime_error("Porta inválida: " + text);
+        }
+        return static_cast<uint16_t>(port);
+    }
+}
+
+// --- StreamServer ---
+
+StreamServer::StreamServer(const std::string& address) : listenFd(-1), bytesSent(0)
+{
+    int result;
+    if (isUnixAddress(address)) {
+        sockaddr_un addr = unixAddress(address);
+        unixPath = addr.sun_path;
+        unlink(addr.sun_path); // Um arquivo antigo de uma execução anterior.
+        listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        result = listenFd < 0 ? -1 : bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    } else {
+        sockaddr_in addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(parsePort(address));
+        listenFd = socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        if (listenFd >= 0) setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+        result = listenFd < 0 ? -1 : bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    }
+    if (result != 0 || listen(listenFd, SOMAXCONN) != 0) {
+        if (listenFd >= 0) close(listenFd);
+        throw std::runtime_error("Não foi possível escutar em " + address + ": " + std::strerror(errno));
+    }
+    setNonBlocking(listenFd);
+}
+
+StreamServer::~StreamServer()
+{
+    for (Client& client : clients) close(client.fd);
+    close(listenFd);
+    if (!unixPath.empty()) unlink(unixPath.c_str());
+}
+
+size_t StreamServer::acceptClients()
+{
+    size_t accepted = 0;
+    while (true) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) break;
+        setNonBlocking(fd);
+        int noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay)); // Ignorado em sockets Unix.
+        clients.push_back(Client{fd, {}, false});
+        ++accepted;
+    }
+    return accepted;
+}
+
+void StreamServer::sendTo(size_t client, const uint8_t* data, size_t size)
+{
+    write(clients[client], data, size);
+}
+
+void StreamServer::sendToAll(const uint8_t* data, size_t size)
+{
+    for (Client& client : clients) write(client, data, size);
+    removeClosed();
+}
+
+void StreamServer::write(Client& client, const uint8_t* data, size_t size)
+{
+    if (client.closed || size == 0) return;
+
+    // Primeiro o que ficou pendente, para não embaralhar o fluxo.
+    if (!client.backlog.empty()) {
+        client.backlog.insert(client.backlog.end(), data, data + size);
+        data = client.backlog.data();
+        size = client.backlog.size();
+    }
+
+    size_t written = 0;
+    while (written < size) {
+        ssize_t n = ::send(client.fd, data + written, size - written, MSG_NOSIGNAL);
+        if (n > 0) {
+            written += static_cast<size_t>(n);
+            continue;
+        }
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        client.closed = true;
+        return;
+    }
+    bytesSent += written;
+
+    std::vector<uint8_t> rest(data + written, data + size);
+    if (rest.size() > MAX_BACKLOG) {
+        client.closed = true; // Espectador lento demais: desconecta em vez de acumular.
+        return;
+    }
+    client.backlog.swap(rest);
+}
+
+void StreamServer::removeClosed()
+{
+    for (size_t i = 0; i < clients.size();) {
+        if (clients[i].closed) {
+            close(clients[i].fd);
+            clients[i] = std::move(clients.back());
+            clients.pop_back();
+        } else {
+            ++i;
+        }
+    }
+}
+
+// --- StreamClient ---
+
+StreamClient::StreamClient(const std::string& address) : fd(-1), closed(false)
+{
+    int result;
+    if (isUnixAddress(address)) {
+        sockaddr_un addr = unixAddress(address);
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        result = fd < 0 ? -1 : connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    } else {
+        size_t colon = address.rfind(':');
+        if (colon == std::string::npos) throw std::runtime_error("Endereço deve ser host:porta: " + address);
+        addrinfo hints;
+        std::memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* info = nullptr;
+        const std::string host = address.substr(0, colon);
+        const std::string port = std::to_string(parsePort(address.substr(colon + 1)));
+        if (getaddrinfo(host.c_str(), port.c_str(), &hints, &info) != 0 || !info) {
+            throw std::runtime_error("Endereço inválido: " + address);
+        }
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        result = fd < 0 ? -1 : connect(fd, info->ai_addr, info->ai_addrlen);
+        freeaddrinfo(info);
+    }
+    if (result != 0) {
+        if (fd >= 0) close(fd);
+        throw std::runtime_error("Não foi possível conectar a " + address + ": " + std::strerror(errno));
+    }
+    setNonBlocking(fd);
+}
+
+StreamClient::~StreamClient()
+{
+    close(fd);
+}
+
+size_t StreamClient::receive(uint8_t* out, size_t capacity)
+{
+    if (closed) return 0;
+    ssize_t n = recv(fd, out, capacity, 0);
+    if (n > 0) return static_cast<size_t>(n);
+    if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) closed = true;
+    return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file UdpSocket.cpp
+ * @brief Implementação do socket UDP não bloqueante.
+ */
+#include "net/UdpSocket.hpp"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstring>
+#include <stdexcept>
+
+static_assert(sizeof(sockaddr_in) <= 16, "sockaddr_in não cabe em remoteAddress");
+
+UdpSocket::UdpSocket(uint16_t localPort, const std::string& remoteHost, uint16_t remotePort)
+{
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    addrinfo* result = nullptr;
+    if (getaddrinfo(remoteHost.c_str(), nullptr, &hints, &result) != 0 || !result) {
+        throw std::runtime_error("Endereço inválido: " + remoteHost);
+    }
+    sockaddr_in remote;
+    std::memcpy(&remote, result->ai_addr, sizeof(remote));
+    freeaddrinfo(result);
+    remote.sin_port = htons(remotePort);
+    std::memcpy(remoteAddress, &remote, sizeof(remote));
+
+    fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0) throw std::runtime_error("Não foi possível criar o socket UDP");
+
+    sockaddr_in local;
+    std::memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(localPort);
+    if (bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0 ||
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK) != 0) {
+        close(fd);
+        throw std::runtime_error("Não foi possível usar a porta UDP " + std::to_string(localPort));
+    }
+}
+
+UdpSocket::~UdpSocket()
+{
+    close(fd);
+}
+
+void UdpSocket::send(const uint8_t* data, size_t size)
+{
+    sendto(fd, data, size, 0, reinterpret_cast<const sockaddr*>(remoteAddress), sizeof(sockaddr_in));
+}
+
+size_t UdpSocket::receive(uint8_t* out, size_t capacity)
+{
+    sockaddr_in remote;
+    std::memcpy(&remote, remoteAddress, sizeof(remote));
+    while (true) {
+        sockaddr_in from;
+        socklen_t fromSize = sizeof(from);
+        ssize_t size = recvfrom(fd, out, capacity, 0, reinterpret_cast<sockaddr*>(&from), &fromSize);
+        if (size < 0) return 0;
+
+        // Só aceita datagramas do outro jogador; os demais são descartados.
+        if (from.sin_addr.s_addr == remote.sin_addr.s_addr && from.sin_port == remote.sin_port) {
+            return static_cast<size_t>(size);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/**
+ * @file VersusPacket.cpp
+ * @brief Codificação dos pacotes do modo versus.
+ */
+#include "net/VersusPacket.hpp"
+
+namespace {
+    void writeU32(uint8_t* out, uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i) out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+
+    uint32_t readU32(const uint8_t* in)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) value |= static_cast<uint32_t>(in[i]) << (8 * i);
+        return value;
+    }
+}
+
+void VersusPacket::encode(uint8_t* out) const
+{
+    writeU32(out, MAGIC);
+    writeU32(out + 4, firstTick);
+    writeU32(out + 8, ack);
+    writeU32(out + 12, jumps);
+    out[16] = count;
+}
+
+bool VersusPacket::decode(const uint8_t* data, size_t size, VersusPacket& packet)
+{
+    if (size != SIZE || readU32(data) != MAGIC) return false;
+    packet.firstTick = readU32(data + 4);
+    packet.ack = readU32(data + 8);
+    packet.jumps = readU32(data + 12);
+    packet.count = data[16];
+    return packet.count <= MAX_INPUTS;
+}
+
+VersusPacket buildInputPacket(const RollbackSession& session, uint32_t peerAck)
+{
+    const uint32_t tick = session.getTick();
+    VersusPacket packet;
+    // As entradas mais antigas que o anel ainda guarda; o outro jogador nunca fica
+    // tão para trás, porque cada lado só avança MAX_PREDICTION passos sem confirmação.
+    const uint32_t oldest = tick > RollbackSession::INPUT_WINDOW ? tick - RollbackSession::INPUT_WINDOW : 0;
+    packet.firstTick = peerAck > oldest ? peerAck : oldest;
+    if (packet.firstTick > tick) packet.firstTick = tick;
+    packet.ack = session.getRemoteConfirmed();
+    packet.jumps = 0;
+    packet.count = 0;
+    for (uint32_t t = packet.firstTick; t < tick && packet.count < VersusPacket::MAX_INPUTS; ++t) {
+        if (session.getLocalInput(t)) packet.jumps |= 1u << packet.count;
+        ++packet.count;
+    }
+    return packet;
+}
+
+uint32_t applyInputPacket(RollbackSession& session, const VersusPacket& packet)
+{
+    for (int i = 0; i < packet.count; ++i) {
+        session.addRemoteInput(packet.firstTick + i, (packet.jumps >> i) & 1u);
+    }
+    return packet.ack;
+}
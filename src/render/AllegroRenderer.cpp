@@ -0,0 +1,73 @@
+/**
+ * @file AllegroRenderer.cpp
+ * @brief Implementação do backend que desenha com o Allegro.
+ */
+#include "render/AllegroRenderer.hpp"
+#include <allegro5/allegro_primitives.h>
+#include "widgetz/widgetz.h"
+
+void AllegroRenderer::drawBitmap(ALLEGRO_BITMAP* bitmap, float x, float y, int flags)
+{
+    al_draw_bitmap(bitmap, x, y, flags);
+}
+
+void AllegroRenderer::copyBitmap(ALLEGRO_BITMAP* bitmap, float x, float y)
+{
+    // Trocar o blender com o desenho segurado é indefinido no Allegro: solta, copia e segura de novo.
+    const bool held = al_is_bitmap_drawing_held();
+    if (held) al_hold_bitmap_drawing(false);
+    int op, src, dst;
+    al_get_blender(&op, &src, &dst);
+    al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_ZERO);
+    al_draw_bitmap(bitmap, x, y, 0);
+    al_set_blender(op, src, dst);
+    if (held) al_hold_bitmap_drawing(true);
+}
+
+void AllegroRenderer::drawScaledBitmap(ALLEGRO_BITMAP* bitmap, float sx, float sy, float sw, float sh,
+                                       float dx, float dy, float dw, float dh, int flags)
+{
+    al_draw_scaled_bitmap(bitmap, sx, sy, sw, sh, dx, dy, dw, dh, flags);
+}
+
+void AllegroRenderer::drawTintedScaledBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float sx, float sy, float sw, float sh,
+                                             float dx, float dy, float dw, float dh, int flags)
+{
+    al_draw_tinted_scaled_bitmap(bitmap, tint, sx, sy, sw, sh, dx, dy, dw, dh, flags);
+}
+
+void AllegroRenderer::drawTintedScaledRotatedBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float cx, float cy,
+                                                    float dx, float dy, float xscale, float yscale, float angle, int flags)
+{
+    al_draw_tinted_scaled_rotated_bitmap(bitmap, tint, cx, cy, dx, dy, xscale, yscale, angle, flags);
+}
+
+void AllegroRenderer::drawText(const ALLEGRO_FONT* font, ALLEGRO_COLOR color, float x, float y, int flags, const char* text)
+{
+    al_draw_text(font, color, x, y, flags, text);
+}
+
+void AllegroRenderer::drawRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color, float thickness)
+{
+    al_draw_rectangle(x1, y1, x2, y2, color, thickness);
+}
+
+void AllegroRenderer::drawFilledRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color)
+{
+    al_draw_filled_rectangle(x1, y1, x2, y2, color);
+}
+
+void AllegroRenderer::clear(ALLEGRO_COLOR color)
+{
+    al_clear_to_color(color);
+}
+
+void AllegroRenderer::holdDrawing(bool hold)
+{
+    al_hold_bitmap_drawing(hold);
+}
+
+void AllegroRenderer::drawGui(WZ_WIDGET* gui)
+{
+    wz_draw(gui);
+}
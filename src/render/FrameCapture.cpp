@@ -0,0 +1,235 @@
+/**
+ * @file FrameCapture.cpp
+ * @brief Implementação da gravação de quadros com pool fixo e thread escritora.
+ */
+#include "render/FrameCapture.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+    /// Pixel (x, y) de um quadro de 32 bits.
+    inline uint32_t pixelAt(const uint8_t* pixels, int pitch, int x, int y)
+    {
+        return reinterpret_cast<const uint32_t*>(pixels + static_cast<ptrdiff_t>(y) * pitch)[x];
+    }
+
+    inline int channel(uint32_t pixel, int shift) { return static_cast<int>((pixel >> shift) & 0xFF); }
+
+    inline uint8_t clampByte(int value) { return static_cast<uint8_t>(std::min(value, 255)); }
+
+    size_t frameBytes(CaptureFormat format, int width, int height)
+    {
+        if (format == CaptureFormat::RGBA) return static_cast<size_t>(width) * height * 4;
+        return static_cast<size_t>(width) * height + 2 * static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+    }
+}
+
+FrameCapture::FrameCapture(const std::string& path, int width, int height, int fps)
+    : format(formatFor(path)), width(width), height(height), out(path, std::ios::binary),
+      converted(frameBytes(format, width, height)), freeCount(POOL_SIZE), queueHead(0), queueCount(0),
+      stopping(false)
+{
+    if (!out) {
+        throw std::runtime_error("Não foi possível criar o arquivo de captura: " + path);
+    }
+    if (format == CaptureFormat::Y4M) {
+        out << "YUV4MPEG2 W" << width << " H" << height << " F" << fps << ":1 Ip A1:1 C420jpeg\n";
+    }
+    for (size_t i = 0; i < POOL_SIZE; ++i) {
+        slots[i].pixels.resize(static_cast<size_t>(width) * height * 4);
+        freeSlots[i] = i;
+    }
+    writer = std::thread(&FrameCapture::writerLoop, this);
+}
+
+FrameCapture::~FrameCapture()
+{
+    stop();
+}
+
+CaptureFormat FrameCapture::formatFor(const std::string& path)
+{
+    const std::string extension = ".y4m";
+    const bool y4m = path.size() >= extension.size() &&
+                     path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+    return y4m ? CaptureFormat::Y4M : CaptureFormat::RGBA;
+}
+
+bool FrameCapture::acquire(size_t& slot)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (stopping || freeCount == 0) {
+        ++stats.dropped;
+        return false;
+    }
+    slot = freeSlots[--freeCount];
+    return true;
+}
+
+void FrameCapture::release(size_t slot)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    freeSlots[freeCount++] = slot;
+    ++stats.dropped;
+}
+
+void FrameCapture::publish(size_t slot, double captureMs)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue[(queueHead + queueCount) % POOL_SIZE] = slot;
+        ++queueCount;
+        ++stats.captured;
+        stats.maxQueueDepth = std::max(stats.maxQueueDepth, static_cast<unsigned>(queueCount));
+        stats.lastCaptureMs = captureMs;
+        stats.maxCaptureMs = std::max(stats.maxCaptureMs, captureMs);
+    }
+    ready.notify_one();
+}
+
+bool FrameCapture::submit(const uint8_t* pixels, int pitch, const PixelLayout& layout)
+{
+    const auto start = std::chrono::steady_clock::now();
+    size_t slot;
+    if (!acquire(slot)) return false;
+    Slot& target = slots[slot];
+    const size_t rowBytes = static_cast<size_t>(width) * 4;
+    for (int y = 0; y < height; ++y) {
+        std::memcpy(&target.pixels[y * rowBytes], pixels + static_cast<ptrdiff_t>(y) * pitch, rowBytes);
+    }
+    target.layout = layout;
+    publish(slot, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    return true;
+}
+
+bool FrameCapture::capture(ALLEGRO_BITMAP* frame)
+{
+    const auto start = std::chrono::steady_clock::now();
+    if (!frame || al_get_bitmap_width(frame) != width || al_get_bitmap_height(frame) != height) {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++stats.dropped;
+        return false;
+    }
+    size_t slot;
+    if (!acquire(slot)) return false;
+
+    // Trava no formato do próprio bitmap (sem conversão na thread do jogo); a escritora converte depois.
+    PixelLayout layout;
+    ALLEGRO_LOCKED_REGION* region = al_lock_bitmap(frame, ALLEGRO_PIXEL_FORMAT_ANY, ALLEGRO_LOCK_READONLY);
+    if (region && !PixelLayout::of(region->format, layout)) {
+        al_unlock_bitmap(frame);
+        region = al_lock_bitmap(frame, ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE, ALLEGRO_LOCK_READONLY);
+        PixelLayout::of(ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE, layout);
+    }
+    if (!region) {
+        release(slot);
+        return false;
+    }
+
+    Slot& target = slots[slot];
+    const size_t rowBytes = static_cast<size_t>(width) * 4;
+    const uint8_t* data = static_cast<const uint8_t*>(region->data);
+    for (int y = 0; y < height; ++y) {
+        std::memcpy(&target.pixels[y * rowBytes], data + static_cast<ptrdiff_t>(y) * region->pitch, rowBytes);
+    }
+    al_unlock_bitmap(frame);
+    target.layout = layout;
+    publish(slot, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    return true;
+}
+
+void FrameCapture::writerLoop()
+{
+    const int pitch = width * 4;
+    for (;;) {
+        size_t slot;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ready.wait(lock, [this] { return stopping || queueCount > 0; });
+            // Em stop(), a fila é esvaziada antes de sair.
+            if (queueCount == 0) return;
+            slot = queue[queueHead];
+            queueHead = (queueHead + 1) % POOL_SIZE;
+            --queueCount;
+        }
+
+        const Slot& frame = slots[slot];
+        if (format == CaptureFormat::Y4M) {
+            toYuv420(frame.pixels.data(), pitch, frame.layout, width, height, converted.data());
+            out << "FRAME\n";
+        } else {
+            toRgba(frame.pixels.data(), pitch, frame.layout, width, height, converted.data());
+        }
+        out.write(reinterpret_cast<const char*>(converted.data()), static_cast<std::streamsize>(converted.size()));
+
+        std::lock_guard<std::mutex> lock(mutex);
+        freeSlots[freeCount++] = slot;
+        ++stats.written;
+    }
+}
+
+void FrameCapture::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    ready.notify_one();
+    if (writer.joinable()) writer.join();
+    if (out.is_open()) out.close();
+}
+
+CaptureStats FrameCapture::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    CaptureStats current = stats;
+    current.queueDepth = static_cast<unsigned>(queueCount);
+    return current;
+}
+
+void FrameCapture::toRgba(const uint8_t* pixels, int pitch, const PixelLayout& layout, int width, int height, uint8_t* out)
+{
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const uint32_t pixel = pixelAt(pixels, pitch, x, y);
+            for (int c = 0; c < 4; ++c) *out++ = static_cast<uint8_t>(channel(pixel, layout.shift[c]));
+        }
+    }
+}
+
+void FrameCapture::toYuv420(const uint8_t* pixels, int pitch, const PixelLayout& layout, int width, int height, uint8_t* out)
+{
+    const int r = layout.shift[0], g = layout.shift[1], b = layout.shift[2];
+    uint8_t* luma = out;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const uint32_t pixel = pixelAt(pixels, pitch, x, y);
+            *luma++ = static_cast<uint8_t>((77 * channel(pixel, r) + 150 * channel(pixel, g) + 29 * channel(pixel, b) + 128) >> 8);
+        }
+    }
+
+    // Crominância pela média de cada bloco 2x2 (blocos da borda podem ter menos pixels).
+    const int chromaW = (width + 1) / 2, chromaH = (height + 1) / 2;
+    uint8_t* u = out + static_cast<size_t>(width) * height;
+    uint8_t* v = u + static_cast<size_t>(chromaW) * chromaH;
+    for (int cy = 0; cy < chromaH; ++cy) {
+        for (int cx = 0; cx < chromaW; ++cx) {
+            int sumR = 0, sumG = 0, sumB = 0, count = 0;
+            for (int y = 2 * cy; y < std::min(2 * cy + 2, height); ++y) {
+                for (int x = 2 * cx; x < std::min(2 * cx + 2, width); ++x) {
+                    const uint32_t pixel = pixelAt(pixels, pitch, x, y);
+                    sumR += channel(pixel, r);
+                    sumG += channel(pixel, g);
+                    sumB += channel(pixel, b);
+                    ++count;
+                }
+            }
+            const int mr = sumR / count, mg = sumG / count, mb = sumB / count;
+            // Os termos somam 128 * 256 para que o deslocamento nunca seja de um número negativo.
+            *u++ = clampByte((-43 * mr - 85 * mg + 128 * mb + 32896) >> 8);
+            *v++ = clampByte((128 * mr - 107 * mg - 21 * mb + 32896) >> 8);
+        }
+    }
+}
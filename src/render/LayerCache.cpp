@@ -0,0 +1,40 @@
+/**
+ * @file LayerCache.cpp
+ * @brief Implementação do cache de camadas estáticas.
+ */
+#include "render/LayerCache.hpp"
+#include "render/Renderer.hpp"
+
+bool LayerCache::enabled = true;
+uint32_t LayerCache::generation = 0;
+
+LayerCache::LayerCache(int width, int height)
+    : width(width), height(height), currentKey(nullptr), valid(false), compositions(0),
+      composedGeneration(0), previousTarget(nullptr)
+{
+}
+
+bool LayerCache::beginCompose()
+{
+    if (!bitmap) {
+        // Criado com as flags atuais, então segue o alvo: de vídeo no jogo, de memória nos benchmarks.
+        bitmap.reset(al_create_bitmap(width, height));
+        if (!bitmap) return false;
+    }
+    previousTarget = al_get_target_bitmap();
+    al_set_target_bitmap(bitmap.get());
+    Renderer::current().clear(al_map_rgba(0, 0, 0, 0));
+    return true;
+}
+
+void LayerCache::endCompose(const void* key)
+{
+    if (previousTarget) al_set_target_bitmap(previousTarget);
+    previousTarget = nullptr;
+    // O bitmap pode ter sido desenhado antes com outro conteúdo (ou ser novo num endereço reaproveitado).
+    Renderer::current().bitmapChanged(bitmap.get());
+    currentKey = key;
+    valid = true;
+    composedGeneration = generation;
+    ++compositions;
+}
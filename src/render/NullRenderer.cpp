@@ -0,0 +1,97 @@
+/**
+ * @file NullRenderer.cpp
+ * @brief Implementação do backend que só conta as chamadas de desenho.
+ */
+#include "render/NullRenderer.hpp"
+#include <cstring>
+
+NullRenderer::NullRenderer(size_t capacity)
+    : checksum(0.0), recording(false)
+{
+    calls.reserve(capacity);
+    counts.fill(0);
+}
+
+void NullRenderer::reset()
+{
+    counts.fill(0);
+    calls.clear();
+    checksum = 0.0;
+}
+
+uint64_t NullRenderer::getDrawCalls() const
+{
+    uint64_t total = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        if (i != static_cast<size_t>(RenderCall::HOLD)) total += counts[i];
+    }
+    return total;
+}
+
+void NullRenderer::record(RenderCall call, ALLEGRO_BITMAP* bitmap, float x, float y, float w, float h)
+{
+    ++counts[static_cast<size_t>(call)];
+    checksum += x + y + w + h;
+    if (recording) {
+        calls.push_back(RecordedCall{call, bitmap, x, y, w, h});
+    }
+}
+
+void NullRenderer::drawBitmap(ALLEGRO_BITMAP* bitmap, float x, float y, int)
+{
+    record(RenderCall::BITMAP, bitmap, x, y, 0.0f, 0.0f);
+}
+
+void NullRenderer::copyBitmap(ALLEGRO_BITMAP* bitmap, float x, float y)
+{
+    record(RenderCall::COPY, bitmap, x, y, 0.0f, 0.0f);
+}
+
+void NullRenderer::drawScaledBitmap(ALLEGRO_BITMAP* bitmap, float, float, float, float,
+                                    float dx, float dy, float dw, float dh, int)
+{
+    record(RenderCall::SCALED_BITMAP, bitmap, dx, dy, dw, dh);
+}
+
+void NullRenderer::drawTintedScaledBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR, float, float, float, float,
+                                          float dx, float dy, float dw, float dh, int)
+{
+    record(RenderCall::TINTED_SCALED_BITMAP, bitmap, dx, dy, dw, dh);
+}
+
+void NullRenderer::drawTintedScaledRotatedBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR, float, float,
+                                                 float dx, float dy, float xscale, float yscale, float, int)
+{
+    record(RenderCall::ROTATED_BITMAP, bitmap, dx, dy, xscale, yscale);
+}
+
+void NullRenderer::drawText(const ALLEGRO_FONT*, ALLEGRO_COLOR, float x, float y, int, const char* text)
+{
+    // O tamanho do texto entra no checksum, para que a formatação não possa ser descartada.
+    record(RenderCall::TEXT, nullptr, x, y, text ? static_cast<float>(std::strlen(text)) : 0.0f, 0.0f);
+}
+
+void NullRenderer::drawRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR, float)
+{
+    record(RenderCall::RECTANGLE, nullptr, x1, y1, x2 - x1, y2 - y1);
+}
+
+void NullRenderer::drawFilledRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR)
+{
+    record(RenderCall::FILLED_RECTANGLE, nullptr, x1, y1, x2 - x1, y2 - y1);
+}
+
+void NullRenderer::clear(ALLEGRO_COLOR)
+{
+    record(RenderCall::CLEAR, nullptr, 0.0f, 0.0f, 0.0f, 0.0f);
+}
+
+void NullRenderer::holdDrawing(bool)
+{
+    ++counts[static_cast<size_t>(RenderCall::HOLD)];
+}
+
+void NullRenderer::drawGui(WZ_WIDGET*)
+{
+    record(RenderCall::GUI, nullptr, 0.0f, 0.0f, 0.0f, 0.0f);
+}
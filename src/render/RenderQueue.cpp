@@ -0,0 +1,167 @@
+/**
+ * @file RenderQueue.cpp
+ * @brief Implementação da fila de comandos de desenho.
+ */
+#include "render/RenderQueue.hpp"
+#include "render/Renderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace {
+
+/// A textura que o Allegro realmente usa: sub-bitmaps de um atlas compartilham a do pai.
+ALLEGRO_BITMAP* sheetOf(ALLEGRO_BITMAP* bitmap)
+{
+    ALLEGRO_BITMAP* parent = al_get_parent_bitmap(bitmap);
+    return parent ? parent : bitmap;
+}
+
+bool isPlain(const RenderCommand& command)
+{
+    return command.angle == 0.0f && command.scaleX == 1.0f && command.scaleY == 1.0f &&
+           command.tint.r == 1.0f && command.tint.g == 1.0f && command.tint.b == 1.0f && command.tint.a == 1.0f;
+}
+
+} // namespace
+
+RenderQueue::RenderQueue(float width, float height, size_t capacity)
+    : viewWidth(width), viewHeight(height), nextSequence(0)
+{
+    commands.reserve(capacity);
+}
+
+void RenderQueue::clear()
+{
+    commands.clear();
+    nextSequence = 0;
+    stats = RenderStats();
+}
+
+bool RenderQueue::submit(const RenderCommand& command)
+{
+    ++stats.submitted;
+    if (!isVisible(command, viewWidth, viewHeight)) {
+        ++stats.culled;
+        return false;
+    }
+    commands.push_back(command);
+    commands.back().sequence = nextSequence++;
+    return true;
+}
+
+bool RenderQueue::draw(RenderLayer layer, ALLEGRO_BITMAP* bitmap, float x, float y, int flags)
+{
+    if (!bitmap) return false;
+    RenderCommand command = makeCommand(layer, bitmap, sheetOf(bitmap), al_get_bitmap_width(bitmap),
+                                        al_get_bitmap_height(bitmap), x, y);
+    command.flags = flags;
+    return submit(command);
+}
+
+bool RenderQueue::copy(RenderLayer layer, ALLEGRO_BITMAP* bitmap, float x, float y)
+{
+    if (!bitmap) return false;
+    RenderCommand command = makeCommand(layer, bitmap, sheetOf(bitmap), al_get_bitmap_width(bitmap),
+                                        al_get_bitmap_height(bitmap), x, y);
+    command.opaque = true;
+    return submit(command);
+}
+
+bool RenderQueue::drawRotated(RenderLayer layer, ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint,
+                              float pivotX, float pivotY, float x, float y, float angle, int flags)
+{
+    if (!bitmap) return false;
+    RenderCommand command = makeCommand(layer, bitmap, sheetOf(bitmap), al_get_bitmap_width(bitmap),
+                                        al_get_bitmap_height(bitmap), x, y);
+    command.pivotX = pivotX;
+    command.pivotY = pivotY;
+    command.angle = angle;
+    command.tint = tint;
+    command.flags = flags;
+    return submit(command);
+}
+
+void RenderQueue::sort()
+{
+    std::sort(commands.begin(), commands.end(), [](const RenderCommand& a, const RenderCommand& b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        if (a.sheet != b.sheet) return std::less<ALLEGRO_BITMAP*>()(a.sheet, b.sheet);
+        return a.sequence < b.sequence;
+    });
+}
+
+void RenderQueue::flush()
+{
+    sort();
+
+    Renderer& renderer = Renderer::current();
+    ALLEGRO_BITMAP* currentSheet = nullptr;
+    renderer.holdDrawing(true);
+    for (const RenderCommand& command : commands) {
+        if (command.sheet != currentSheet) {
+            currentSheet = command.sheet;
+            ++stats.textureSwitches;
+        }
+        if (command.opaque) {
+            renderer.copyBitmap(command.bitmap, command.x, command.y);
+        } else if (isPlain(command)) {
+            renderer.drawBitmap(command.bitmap, command.x - command.pivotX, command.y - command.pivotY, command.flags);
+        } else {
+            renderer.drawTintedScaledRotatedBitmap(command.bitmap, command.tint, command.pivotX, command.pivotY,
+                                                   command.x, command.y, command.scaleX, command.scaleY,
+                                                   command.angle, command.flags);
+        }
+        ++stats.drawCalls;
+    }
+    renderer.holdDrawing(false);
+}
+
+bool RenderQueue::isVisible(const RenderCommand& command, float width, float height)
+{
+    float left, right, top, bottom;
+    if (command.angle == 0.0f) {
+        // Sem rotação, a caixa é exata (a escala pode ser negativa).
+        const float x0 = command.x - command.pivotX * command.scaleX;
+        const float x1 = command.x + (command.width - command.pivotX) * command.scaleX;
+        const float y0 = command.y - command.pivotY * command.scaleY;
+        const float y1 = command.y + (command.height - command.pivotY) * command.scaleY;
+        left = std::min(x0, x1);
+        right = std::max(x0, x1);
+        top = std::min(y0, y1);
+        bottom = std::max(y0, y1);
+    } else {
+        // Girado, usa o círculo em volta do pivô que contém o sprite em qualquer ângulo.
+        const float dx = std::max(command.pivotX, command.width - command.pivotX) * std::fabs(command.scaleX);
+        const float dy = std::max(command.pivotY, command.height - command.pivotY) * std::fabs(command.scaleY);
+        const float radius = std::sqrt(dx * dx + dy * dy);
+        left = command.x - radius;
+        right = command.x + radius;
+        top = command.y - radius;
+        bottom = command.y + radius;
+    }
+    return right > 0.0f && left < width && bottom > 0.0f && top < height;
+}
+
+RenderCommand RenderQueue::makeCommand(RenderLayer layer, ALLEGRO_BITMAP* bitmap, ALLEGRO_BITMAP* sheet,
+                                       float width, float height, float x, float y)
+{
+    RenderCommand command;
+    command.bitmap = bitmap;
+    command.sheet = sheet;
+    command.width = width;
+    command.height = height;
+    command.pivotX = 0.0f;
+    command.pivotY = 0.0f;
+    command.x = x;
+    command.y = y;
+    command.scaleX = 1.0f;
+    command.scaleY = 1.0f;
+    command.angle = 0.0f;
+    command.tint = ALLEGRO_COLOR{1.0f, 1.0f, 1.0f, 1.0f};
+    command.flags = 0;
+    command.opaque = false;
+    command.layer = layer;
+    command.sequence = 0;
+    return command;
+}
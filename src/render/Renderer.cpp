@@ -0,0 +1,35 @@
+/**
+ * @file Renderer.cpp
+ * @brief Implementação do acesso ao backend de desenho em uso.
+ */
+#include "render/Renderer.hpp"
+#include "render/AllegroRenderer.hpp"
+#include <cstdarg>
+#include <cstdio>
+
+namespace {
+
+AllegroRenderer defaultRenderer;
+Renderer* currentRenderer = &defaultRenderer;
+
+} // namespace
+
+Renderer& Renderer::current()
+{
+    return *currentRenderer;
+}
+
+void Renderer::setCurrent(Renderer* renderer)
+{
+    currentRenderer = renderer ? renderer : &defaultRenderer;
+}
+
+void Renderer::drawTextf(const ALLEGRO_FONT* font, ALLEGRO_COLOR color, float x, float y, int flags, const char* format, ...)
+{
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    std::vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    drawText(font, color, x, y, flags, text);
+}
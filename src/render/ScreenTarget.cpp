@@ -0,0 +1,56 @@
+/**
+ * @file ScreenTarget.cpp
+ * @brief Implementação do quadro fora da tela e do encaixe em escala inteira.
+ */
+#include "render/ScreenTarget.hpp"
+#include "render/Renderer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+Letterbox Letterbox::fit(int windowW, int windowH, int frameW, int frameH)
+{
+    Letterbox box;
+    const float fitScale = std::min(static_cast<float>(windowW) / frameW, static_cast<float>(windowH) / frameH);
+    // Escala inteira sempre que possível; abaixo de 1, o quadro é reduzido só o bastante para caber.
+    box.scale = fitScale >= 1.0f ? std::floor(fitScale) : std::max(fitScale, 1e-3f);
+    box.width = static_cast<int>(frameW * box.scale);
+    box.height = static_cast<int>(frameH * box.scale);
+    box.x = (windowW - box.width) / 2;
+    box.y = (windowH - box.height) / 2;
+    return box;
+}
+
+void Letterbox::toFrame(int& px, int& py) const
+{
+    px = static_cast<int>(std::floor((px - x) / scale));
+    py = static_cast<int>(std::floor((py - y) / scale));
+}
+
+ScreenTarget::ScreenTarget(int width, int height)
+    : frame(al_create_bitmap(width, height)), width(width), height(height),
+      letterbox(Letterbox::fit(width, height, width, height))
+{
+    if (!frame) {
+        throw std::runtime_error("Falha ao criar o quadro fora da tela.");
+    }
+}
+
+void ScreenTarget::resize(int windowW, int windowH)
+{
+    letterbox = Letterbox::fit(windowW, windowH, width, height);
+}
+
+void ScreenTarget::begin()
+{
+    al_set_target_bitmap(frame.get());
+}
+
+void ScreenTarget::present(ALLEGRO_DISPLAY* display)
+{
+    al_set_target_backbuffer(display);
+    Renderer& renderer = Renderer::current();
+    renderer.clear(al_map_rgb(0, 0, 0));
+    renderer.drawScaledBitmap(frame.get(), 0, 0, width, height,
+                              letterbox.x, letterbox.y, letterbox.width, letterbox.height, 0);
+}
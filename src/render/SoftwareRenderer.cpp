@@ -0,0 +1,331 @@
+/**
+ * @file SoftwareRenderer.cpp
+ * @brief Implementação dos atalhos de desenho para bitmaps de memória.
+ */
+#include "render/SoftwareRenderer.hpp"
+#include "managers/ResourceManager.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+namespace {
+    constexpr float RADIANS_PER_STEP = SoftwareRenderer::ANGLE_STEP * static_cast<float>(ALLEGRO_PI) / 180.0f;
+    constexpr int FLIP_BOTH = ALLEGRO_FLIP_HORIZONTAL | ALLEGRO_FLIP_VERTICAL;
+
+    bool isWhite(const ALLEGRO_COLOR& tint)
+    {
+        return tint.r == 1.0f && tint.g == 1.0f && tint.b == 1.0f && tint.a == 1.0f;
+    }
+
+    /// Se o ângulo está a menos de um milésimo de radiano do passo (para sprites grandes, sem arredondar).
+    bool isExactStep(float angle, int step)
+    {
+        const float twoPi = 2.0f * static_cast<float>(ALLEGRO_PI);
+        const float error = std::remainder(angle - step * RADIANS_PER_STEP, twoPi);
+        return std::fabs(error) < 1e-3f;
+    }
+
+    /**
+     * @brief O alvo atual, se os atalhos valem para ele: bitmap de memória de 32 bits com alfa,
+     * blender padrão (ONE, INVERSE_ALPHA) e transformação identidade.
+     */
+    ALLEGRO_BITMAP* softwareTarget(PixelLayout& layout)
+    {
+        ALLEGRO_BITMAP* target = al_get_target_bitmap();
+        if (!target || !(al_get_bitmap_flags(target) & ALLEGRO_MEMORY_BITMAP)) return nullptr;
+        if (!PixelLayout::of(al_get_bitmap_format(target), layout)) return nullptr;
+
+        int op, src, dst, alphaOp, alphaSrc, alphaDst;
+        al_get_separate_blender(&op, &src, &dst, &alphaOp, &alphaSrc, &alphaDst);
+        if (op != ALLEGRO_ADD || src != ALLEGRO_ONE || dst != ALLEGRO_INVERSE_ALPHA ||
+            alphaOp != ALLEGRO_ADD || alphaSrc != ALLEGRO_ONE || alphaDst != ALLEGRO_INVERSE_ALPHA) {
+            return nullptr;
+        }
+
+        const ALLEGRO_TRANSFORM* transform = al_get_current_transform();
+        if (transform) {
+            for (int i = 0; i < 4; ++i) {
+                for (int j = 0; j < 4; ++j) {
+                    if (transform->m[i][j] != (i == j ? 1.0f : 0.0f)) return nullptr;
+                }
+            }
+        }
+        return target;
+    }
+
+    /// O retângulo de clip do alvo, limitado ao bitmap.
+    void clipRect(ALLEGRO_BITMAP* target, int& x, int& y, int& w, int& h)
+    {
+        al_get_clipping_rectangle(&x, &y, &w, &h);
+        const int right = std::min(x + w, al_get_bitmap_width(target));
+        const int bottom = std::min(y + h, al_get_bitmap_height(target));
+        x = std::max(x, 0);
+        y = std::max(y, 0);
+        w = std::max(right - x, 0);
+        h = std::max(bottom - y, 0);
+    }
+
+    /**
+     * @brief Desenha o sprite espelhado e/ou girado num bitmap de memória novo, com o Allegro, uma única vez.
+     * @details Girado, o resultado é um quadrado com o pivô no centro e espaço para o sprite em qualquer ângulo.
+     */
+    ALLEGRO_BITMAP* renderTransformed(ALLEGRO_BITMAP* bitmap, int flags, int step, float pivotX, float pivotY)
+    {
+        const int width = al_get_bitmap_width(bitmap);
+        const int height = al_get_bitmap_height(bitmap);
+        int outW = width, outH = height;
+        if (step != 0) {
+            const float dx = std::max(pivotX, width - pivotX);
+            const float dy = std::max(pivotY, height - pivotY);
+            outW = outH = 2 * static_cast<int>(std::ceil(std::hypot(dx, dy))) + 2;
+        }
+
+        // Trocar de alvo com o desenho segurado é indefinido no Allegro: solta e segura de novo no fim.
+        const bool held = al_is_bitmap_drawing_held();
+        if (held) al_hold_bitmap_drawing(false);
+        ALLEGRO_STATE state;
+        al_store_state(&state, ALLEGRO_STATE_TARGET_BITMAP | ALLEGRO_STATE_BLENDER | ALLEGRO_STATE_NEW_BITMAP_PARAMETERS);
+        al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+        ALLEGRO_BITMAP* result = al_create_bitmap(outW, outH);
+        if (result) {
+            al_set_target_bitmap(result);
+            al_set_blender(ALLEGRO_ADD, ALLEGRO_ONE, ALLEGRO_INVERSE_ALPHA);
+            al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+            if (step == 0) {
+                al_draw_bitmap(bitmap, 0, 0, flags);
+            } else {
+                al_draw_rotated_bitmap(bitmap, pivotX, pivotY, outW / 2, outH / 2, step * RADIANS_PER_STEP, flags);
+            }
+        }
+        al_restore_state(&state);
+        if (held) al_hold_bitmap_drawing(true);
+        return result;
+    }
+}
+
+bool PixelLayout::of(int format, PixelLayout& layout)
+{
+    // Pixels lidos como uint32_t numa máquina little-endian.
+    switch (format) {
+    case ALLEGRO_PIXEL_FORMAT_ARGB_8888:
+        layout = PixelLayout{{16, 8, 0, 24}};
+        return true;
+    case ALLEGRO_PIXEL_FORMAT_RGBA_8888:
+        layout = PixelLayout{{24, 16, 8, 0}};
+        return true;
+    case ALLEGRO_PIXEL_FORMAT_ABGR_8888:
+    case ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE:
+        layout = PixelLayout{{0, 8, 16, 24}};
+        return true;
+    default:
+        return false;
+    }
+}
+
+BlendTable BlendTable::forColor(ALLEGRO_COLOR color, const PixelLayout& layout)
+{
+    BlendTable table;
+    const float source[4] = {color.r, color.g, color.b, color.a};
+    const float keep = 1.0f - color.a;
+    for (int channel = 0; channel < 4; ++channel) {
+        uint8_t* bytes = table.bytes[layout.shift[channel] / 8];
+        for (int value = 0; value < 256; ++value) {
+            const float mixed = source[channel] * 255.0f + value * keep;
+            bytes[value] = static_cast<uint8_t>(std::min(255.0f, std::max(0.0f, mixed)) + 0.5f);
+        }
+    }
+    return table;
+}
+
+const BlendTable& SoftwareRenderer::blendTable(ALLEGRO_COLOR color, const PixelLayout& layout)
+{
+    // Um fade usa a mesma cor em todos os retângulos do quadro e repete o alfa
+    // enquanto está parado, então quase sempre basta consultar a última tabela.
+    const bool sameColor = color.r == fillColor.r && color.g == fillColor.g &&
+                           color.b == fillColor.b && color.a == fillColor.a;
+    if (!sameColor || !std::equal(layout.shift, layout.shift + 4, fillLayout.shift)) {
+        fillTable = BlendTable::forColor(color, layout);
+        fillColor = color;
+        fillLayout = layout;
+        ++stats.tableBuilds;
+    }
+    return fillTable;
+}
+
+int SoftwareRenderer::quantizeAngle(float angle)
+{
+    const int step = static_cast<int>(std::lround(angle / RADIANS_PER_STEP)) % ANGLE_COUNT;
+    return step < 0 ? step + ANGLE_COUNT : step;
+}
+
+bool SoftwareRenderer::buildSprite(const uint8_t* data, int pitch, int width, int height, int alphaShift,
+                                   PixelSprite<uint32_t>& sprite)
+{
+    if (width > UINT16_MAX) return false;
+    sprite.width = width;
+    sprite.height = height;
+    sprite.pixels.resize(static_cast<size_t>(width) * height);
+    sprite.alpha.resize(sprite.pixels.size());
+    sprite.spans.clear();
+    sprite.rowSpans.assign(1, 0);
+    for (int y = 0; y < height; ++y) {
+        const uint32_t* row = reinterpret_cast<const uint32_t*>(data + static_cast<ptrdiff_t>(y) * pitch);
+        uint32_t* pixels = &sprite.pixels[static_cast<size_t>(y) * width];
+        uint8_t* alpha = &sprite.alpha[static_cast<size_t>(y) * width];
+        std::memcpy(pixels, row, width * sizeof(uint32_t));
+        for (int x = 0; x < width; ++x) {
+            alpha[x] = static_cast<uint8_t>(row[x] >> alphaShift);
+            // Com alfa parcial, copiar não é o mesmo que misturar.
+            if (alpha[x] != 0 && alpha[x] != 255) return false;
+        }
+        for (int x = 0; x < width;) {
+            if (alpha[x] == 0) { ++x; continue; }
+            int end = x + 1;
+            while (end < width && alpha[end] == 255) ++end;
+            sprite.spans.push_back(PixelSpan{static_cast<uint16_t>(x), static_cast<uint16_t>(end - x), 1});
+            x = end;
+        }
+        sprite.rowSpans.push_back(static_cast<uint32_t>(sprite.spans.size()));
+    }
+    return true;
+}
+
+void SoftwareRenderer::blitSprite(const PixelSprite<uint32_t>& sprite, uint8_t* target, int pitch,
+                                  int clipX, int clipY, int clipW, int clipH, int left, int top)
+{
+    const int firstRow = std::max(0, clipY - top);
+    const int lastRow = std::min(sprite.height, clipY + clipH - top);
+    for (int y = firstRow; y < lastRow; ++y) {
+        uint32_t* row = reinterpret_cast<uint32_t*>(target + static_cast<ptrdiff_t>(top + y) * pitch);
+        const uint32_t* pixels = &sprite.pixels[static_cast<size_t>(y) * sprite.width];
+        for (uint32_t s = sprite.rowSpans[y]; s < sprite.rowSpans[y + 1]; ++s) {
+            const PixelSpan& span = sprite.spans[s];
+            const int from = std::max<int>(span.x, clipX - left);
+            const int to = std::min<int>(span.x + span.length, clipX + clipW - left);
+            if (from >= to) continue;
+            std::memcpy(row + left + from, pixels + from, (to - from) * sizeof(uint32_t));
+        }
+    }
+}
+
+void SoftwareRenderer::bitmapChanged(ALLEGRO_BITMAP* bitmap)
+{
+    for (auto it = sprites.begin(); it != sprites.end();) {
+        it = it->first.bitmap == bitmap ? sprites.erase(it) : std::next(it);
+    }
+}
+
+const PixelSprite<uint32_t>* SoftwareRenderer::prepare(const Key& key)
+{
+    auto found = sprites.find(key);
+    if (found != sprites.end()) return found->second.usable ? &found->second.sprite : nullptr;
+
+    Prepared& prepared = sprites[key];
+    PixelLayout layout;
+    if (!PixelLayout::of(key.format, layout)) return nullptr;
+    ALLEGRO_BITMAP* source = key.bitmap;
+    BitmapPtr transformed;
+    if (key.flags != 0 || key.angle != 0) {
+        transformed.reset(renderTransformed(key.bitmap, key.flags, key.angle, key.pivotX, key.pivotY));
+        if (!transformed) return nullptr;
+        source = transformed.get();
+    }
+    // O Allegro converte para o formato do alvo, então os pixels já podem ser copiados direto.
+    ALLEGRO_LOCKED_REGION* region = al_lock_bitmap(source, key.format, ALLEGRO_LOCK_READONLY);
+    if (!region) return nullptr;
+    prepared.usable = buildSprite(static_cast<const uint8_t*>(region->data), region->pitch, al_get_bitmap_width(source),
+                                  al_get_bitmap_height(source), layout.shift[3], prepared.sprite);
+    al_unlock_bitmap(source);
+    if (!prepared.usable) prepared.sprite = PixelSprite<uint32_t>();
+    return prepared.usable ? &prepared.sprite : nullptr;
+}
+
+bool SoftwareRenderer::blit(Key key, float x, float y, bool centered)
+{
+    PixelLayout layout;
+    ALLEGRO_BITMAP* target = softwareTarget(layout);
+    if (!target) return false;
+    key.format = al_get_bitmap_format(target);
+    const PixelSprite<uint32_t>* sprite = prepare(key);
+    if (!sprite) return false;
+
+    if (centered) {
+        x -= sprite->width / 2;
+        y -= sprite->height / 2;
+    }
+    int clipX, clipY, clipW, clipH;
+    clipRect(target, clipX, clipY, clipW, clipH);
+    ALLEGRO_LOCKED_REGION* region = al_lock_bitmap(target, ALLEGRO_PIXEL_FORMAT_ANY, ALLEGRO_LOCK_READWRITE);
+    if (!region) return false;
+    // Arredonda como o blit de memória do Allegro (para o mais próximo, empates para o par).
+    blitSprite(*sprite, static_cast<uint8_t*>(region->data), region->pitch, clipX, clipY, clipW, clipH,
+               static_cast<int>(std::nearbyint(x)), static_cast<int>(std::nearbyint(y)));
+    al_unlock_bitmap(target);
+    ++stats.spanBlits;
+    return true;
+}
+
+void SoftwareRenderer::drawBitmap(ALLEGRO_BITMAP* bitmap, float x, float y, int flags)
+{
+    if (blit(Key{bitmap, flags & FLIP_BOTH, 0, 0.0f, 0.0f, 0}, x, y, false)) return;
+    ++stats.fallbacks;
+    AllegroRenderer::drawBitmap(bitmap, x, y, flags);
+}
+
+void SoftwareRenderer::drawTintedScaledRotatedBitmap(ALLEGRO_BITMAP* bitmap, ALLEGRO_COLOR tint, float cx, float cy,
+                                                     float dx, float dy, float xscale, float yscale, float angle, int flags)
+{
+    if (isWhite(tint) && xscale == 1.0f && yscale == 1.0f) {
+        const int step = quantizeAngle(angle);
+        const int width = al_get_bitmap_width(bitmap);
+        const int height = al_get_bitmap_height(bitmap);
+        // Sprites grandes não ganham cópias giradas: só os ângulos de 0 e π exatos usam atalho.
+        const bool small = std::max(width, height) <= MAX_ROTATED_SIZE;
+        const bool exact = small || isExactStep(angle, step);
+        const int flips = flags & FLIP_BOTH;
+        if (step == 0 && exact) {
+            if (blit(Key{bitmap, flips, 0, 0.0f, 0.0f, 0}, dx - cx, dy - cy, false)) return;
+        } else if (step == ANGLE_COUNT / 2 && exact) {
+            // Girar π em torno do pivô é espelhar nos dois eixos.
+            if (blit(Key{bitmap, flips ^ FLIP_BOTH, 0, 0.0f, 0.0f, 0}, dx - (width - cx), dy - (height - cy), false)) return;
+        } else if (small) {
+            if (blit(Key{bitmap, flips, step, cx, cy, 0}, dx, dy, true)) return;
+        }
+    }
+    ++stats.fallbacks;
+    AllegroRenderer::drawTintedScaledRotatedBitmap(bitmap, tint, cx, cy, dx, dy, xscale, yscale, angle, flags);
+}
+
+void SoftwareRenderer::drawFilledRectangle(float x1, float y1, float x2, float y2, ALLEGRO_COLOR color)
+{
+    PixelLayout layout;
+    ALLEGRO_BITMAP* target = nullptr;
+    // Só retângulos de cantos inteiros: aí a cobertura de pixels é a mesma do rasterizador do Allegro.
+    if (x1 == std::floor(x1) && y1 == std::floor(y1) && x2 == std::floor(x2) && y2 == std::floor(y2)) {
+        target = softwareTarget(layout);
+    }
+    ALLEGRO_LOCKED_REGION* region = target ? al_lock_bitmap(target, ALLEGRO_PIXEL_FORMAT_ANY, ALLEGRO_LOCK_READWRITE) : nullptr;
+    if (!region) {
+        ++stats.fallbacks;
+        AllegroRenderer::drawFilledRectangle(x1, y1, x2, y2, color);
+        return;
+    }
+
+    int clipX, clipY, clipW, clipH;
+    clipRect(target, clipX, clipY, clipW, clipH);
+    const int left = std::max(static_cast<int>(std::min(x1, x2)), clipX);
+    const int right = std::min(static_cast<int>(std::max(x1, x2)), clipX + clipW);
+    const int top = std::max(static_cast<int>(std::min(y1, y2)), clipY);
+    const int bottom = std::min(static_cast<int>(std::max(y1, y2)), clipY + clipH);
+    if (left < right) {
+        const BlendTable& table = blendTable(color, layout);
+        uint8_t* data = static_cast<uint8_t*>(region->data);
+        for (int y = top; y < bottom; ++y) {
+            uint32_t* row = reinterpret_cast<uint32_t*>(data + static_cast<ptrdiff_t>(y) * region->pitch);
+            table.applyRow(row + left, right - left);
+        }
+    }
+    al_unlock_bitmap(target);
+    ++stats.tableFills;
+}
@@ -8,11 +8,11 @@
 #include "managers/SceneManager.hpp"
 #include "managers/ResourceManager.hpp"
 #include "Constants.hpp"
-#include <allegro5/allegro_primitives.h>
+#include "render/Renderer.hpp"
 #include <iostream>
 
 CharacterSelectionScene::CharacterSelectionScene(SceneManager *sceneManager)
-    : Scene(sceneManager), selectedIndex(0)
+    : Scene(sceneManager), selectedIndex(0), staticLayer(BUFFER_W, BUFFER_H)
 {
     buildThemes();
     font = al_create_builtin_font();
@@ -31,42 +31,7 @@ void CharacterSelectionScene::buildThemes()
 {
     ResourceManager &rm = ResourceManager::getInstance();
 
-    // Adiciona os dados de cada tema, incluindo o caminho da música
-    themes.push_back({
-        "Amarelo",
-        {rm.getBitmap("yellowbird-downflap"), rm.getBitmap("yellowbird-midflap"), rm.getBitmap("yellowbird-upflap")},
-        rm.getBitmap("background-day"),
-        rm.getBitmap("base"),
-        rm.getBitmap("pipe-green"),
-        "8bitMusicTheme"
-    });
-
-    themes.push_back({
-        "Nerd",
-        {rm.getBitmap("nerd_0"), rm.getBitmap("nerd_1"), rm.getBitmap("nerd_2")},
-        rm.getBitmap("background-night"),
-        rm.getBitmap("nerd_base"),
-        rm.getBitmap("nerd_pipe"),
-        "starMusicTheme"
-    });
-
-    themes.push_back({
-        "Barbie",
-        {rm.getBitmap("barbielaco_0"), rm.getBitmap("barbielaco_1"), rm.getBitmap("barbielaco_2")},
-        rm.getBitmap("barbie_background"),
-        rm.getBitmap("barbie_base"),
-        rm.getBitmap("barbie_pipe"),
-        "barbie"
-    });
-
-    themes.push_back({
-        "Porco",
-        {rm.getBitmap("pig_0"), rm.getBitmap("pig_1"), rm.getBitmap("pig_2")},
-        rm.getBitmap("pig_background"),
-        rm.getBitmap("pig_base"),
-        rm.getBitmap("pig_pipe"),
-        "yoshi"
-    });
+    themes = buildDefaultThemes();
 
     preview_sprites.push_back(rm.getBitmap("yellowbird-midflap"));
     preview_sprites.push_back(rm.getBitmap("nerd_1"));
@@ -101,18 +66,30 @@ void CharacterSelectionScene::update(float deltaTime)
 {
 }
 
-void CharacterSelectionScene::draw() const
+void CharacterSelectionScene::drawStaticLayer() const
 {
-    al_draw_bitmap(themes[selectedIndex].background, 0, 0, 0);
+    Renderer& renderer = Renderer::current();
+    renderer.drawBitmap(themes[selectedIndex].background, 0, 0, 0);
 
     // Texto do tema
-    al_draw_text(font, al_map_rgb(255, 255, 255), BUFFER_W / 2, 80, ALLEGRO_ALIGN_CENTER, "Escolha seu Tema");
+    renderer.drawText(font, al_map_rgb(255, 255, 255), BUFFER_W / 2, 80, ALLEGRO_ALIGN_CENTER, "Escolha seu Tema");
 
     // Sprites dos pássaros
     for (size_t i = 0; i < preview_sprites.size(); ++i)
     {
         float yPos = (themes[i].name == "Barbie") ? 122.0f : 132.0f;
-        al_draw_bitmap(preview_sprites[i], positionsX[i], yPos, 0);
+        renderer.drawBitmap(preview_sprites[i], positionsX[i], yPos, 0);
+    }
+}
+
+void CharacterSelectionScene::draw() const
+{
+    Renderer& renderer = Renderer::current();
+    // A chave é o fundo do tema: trocar de tema refaz o cache.
+    if (ALLEGRO_BITMAP* cached = staticLayer.get(themes[selectedIndex].background, [this] { drawStaticLayer(); })) {
+        renderer.copyBitmap(cached, 0, 0);
+    } else {
+        drawStaticLayer();
     }
 
     // Seleção retangular
@@ -120,8 +97,8 @@ void CharacterSelectionScene::draw() const
     float w = al_get_bitmap_width(preview_sprites[selectedIndex]);
     float h = al_get_bitmap_height(preview_sprites[selectedIndex]);
     float y = (themes[selectedIndex].name == "Barbie") ? 120.0f : 130.0f;
-    al_draw_rectangle(x - 2, y - 2, x + w + 2, y + h + 2, selection_color, 2.0f);
+    renderer.drawRectangle(x - 2, y - 2, x + w + 2, y + h + 2, selection_color, 2.0f);
 
     // Nome do Tema
-    al_draw_text(font, al_map_rgb(255, 255, 255), BUFFER_W / 2, 220, ALLEGRO_ALIGN_CENTER, themes[selectedIndex].name.c_str());
+    renderer.drawText(font, al_map_rgb(255, 255, 255), BUFFER_W / 2, 220, ALLEGRO_ALIGN_CENTER, themes[selectedIndex].name.c_str());
 }
\ No newline at end of file
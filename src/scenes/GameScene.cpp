@@ -8,16 +8,21 @@
 #include "scenes/StartMenu.hpp"
 #include <iostream>
 #include <string>
+#include <random>
+#include <filesystem>
 #include "util/ScoreSystem.hpp"
 #include "core/PlayerData.hpp"
 #include "widgetz/widgetz.h"
+#include "net/SpectatorBroadcast.hpp"
+#include "managers/BotManager.hpp"
+#include "render/Renderer.hpp"
 
 // O construtor permanece o mesmo, mas vamos usar o ResourceManager para os botões de som.
 GameScene::GameScene(SceneManager* sceneManager, const Theme& selectedTheme)
     : Scene(sceneManager),
       pipePool(PIPE_POOL_SIZE),
-      rng(std::random_device{}()),
-      dist(0.0f, 1.0f),
+      autopilotEnabled(false),
+      renderQueue(BUFFER_W, BUFFER_H),
       selectedTheme(selectedTheme)
 {
     ResourceManager& rm = ResourceManager::getInstance();
@@ -42,7 +47,12 @@ GameScene::GameScene(SceneManager* sceneManager, const Theme& selectedTheme)
     al_set_blender(ALLEGRO_ADD, ALLEGRO_ALPHA, ALLEGRO_INVERSE_ALPHA);
     
     initGUI();
-    
+
+    loadGhosts();
+    ghostBirds = std::make_unique<GhostBirds>(ghosts, selectedTheme.bird_frames);
+
+    // A gravação é reservada uma vez; restart() só a esvazia, sem devolver a memória.
+    replay.reserve(REPLAY_RESERVE_TICKS);
     restart();
 }
 
@@ -62,20 +72,45 @@ void GameScene::processEvent(const ALLEGRO_EVENT& event) {
     if (soundButton)
         soundButton->processEvent(event);
 
+    // Save state: F5 salva a partida em andamento, F9 volta para o último checkpoint
+    // (também depois de morrer, para tentar de novo do mesmo ponto).
+    if (event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == ALLEGRO_KEY_F5) {
+        saveCheckpoint();
+        return;
+    }
+    if (event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == ALLEGRO_KEY_F9) {
+        loadCheckpoint();
+        return;
+    }
+    // Rewind: enquanto Backspace estiver pressionado, a partida volta no tempo.
+    if ((event.type == ALLEGRO_EVENT_KEY_DOWN || event.type == ALLEGRO_EVENT_KEY_UP) &&
+        event.keyboard.keycode == ALLEGRO_KEY_BACKSPACE) {
+        rewindHeld = event.type == ALLEGRO_EVENT_KEY_DOWN;
+        tickAccumulator = 0.0f;
+        return;
+    }
+
+    // Corrida de fantasmas: G liga/desliga antes do primeiro pulo (a semente muda junto).
+    if (event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == ALLEGRO_KEY_G &&
+        state == GameState::GAME_INIT && !ghosts.empty()) {
+        ghostsEnabled = !ghostsEnabled;
+        restart();
+        return;
+    }
+
+    // A liga/desliga o piloto automático (modo demonstração): a busca do BeamPlanner
+    // inicia a partida e joga sozinha; desligado no meio da partida, o jogador assume.
+    if (event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == ALLEGRO_KEY_A) {
+        autopilotEnabled = !autopilotEnabled;
+        return;
+    }
+
     if ((event.type != ALLEGRO_EVENT_KEY_DOWN || event.keyboard.keycode != ALLEGRO_KEY_SPACE) && state!=GameState::GAME_OVER) return;
 
     switch (state) {
         case GameState::GAME_INIT:
-            state = GameState::PLAYING;
-            bird->setPhysicsEnabled(true);
-            bird->setHoverEnabled(false);
-            getReadyUI->hide(); 
-            bird->jump();
-            gSound->play_fly();
-            break;
         case GameState::PLAYING:
-            bird->jump();
-            gSound->play_fly();
+            flap();
             break;
         case GameState::GAME_OVER:
             if (event.keyboard.keycode == ALLEGRO_KEY_SPACE) restart();
@@ -90,8 +125,16 @@ void GameScene::processEvent(const ALLEGRO_EVENT& event) {
 }
 
 void GameScene::update(float deltaTime) {
+    if (rewindHeld && state != GameState::GAME_INIT) {
+        updateRewind(deltaTime);
+        return;
+    }
+
     switch (state) {
         case GameState::GAME_INIT:
+            // Com --bot ou com o piloto automático, o primeiro pulo do bot inicia a partida.
+            if (botPilot && botPilot->decide(simulation.getState())) flap();
+            if (autopilotEnabled && planner.plan(simulation.getState())) flap();
             background->update(deltaTime);
             bird->update(deltaTime);
             floor->update(deltaTime);
@@ -101,9 +144,9 @@ void GameScene::update(float deltaTime) {
         case GameState::PLAYING:
             background->update(deltaTime);
             floor->update(deltaTime);
-            pipePool.update(deltaTime);
-            bird->update(deltaTime); // Pássaro executa a física normal
-            updatePlaying(deltaTime); // Lógica de jogo (canos, colisões, score)
+            updatePlaying(deltaTime); // Lógica de jogo (canos, colisões, score) em passo fixo
+            bird->update(deltaTime); // Só a animação das asas; a física vem da simulação
+            ghostBirds->update(deltaTime);
             break;
 
         case GameState::DYING:
@@ -121,7 +164,19 @@ void GameScene::update(float deltaTime) {
                 int bestScore = scoreSystem.getPlayerScore(name);
 
                 gameOverScreen->startSequence(actualScore, bestScore);
-                scoreSystem.registerOrUpdateScore(name, actualScore);
+                // O placar só aceita a pontuação que o replay da partida reproduz. O replay não
+                // mostra quem pulou nem se a partida voltou no tempo, então partidas assistidas ficam de fora.
+                replay.setFinalScore(simulation.getScore());
+                if (assisted) {
+                    std::cout << "Partida assistida (piloto automático, bot, rewind ou checkpoint): fora do placar." << std::endl;
+                } else {
+                    try {
+                        scoreSystem.registerVerifiedScore(name, actualScore, replay);
+                    } catch (const ScoreException& e) {
+                        std::cerr << "Pontuação não registrada: " << e.what() << std::endl;
+                    }
+                }
+                saveReplay(!assisted && actualScore > bestScore);
             }
             break;
         case GameState::GAME_OVER:
@@ -132,14 +187,18 @@ void GameScene::update(float deltaTime) {
 }
 
 void GameScene::draw() const {
-    // Camada 1: Fundo
-    background->draw();
-    pipePool.draw();
-    floor->draw();
+    // Camadas 1 e 2: cenário, fantasmas e personagem vão para a fila, que os
+    // ordena por camada e textura e desenha numa única passada.
+    renderQueue.clear();
+    background->submit(renderQueue);
+    pipePool.submit(renderQueue);
+    floor->submit(renderQueue);
+    if (ghostsEnabled) {
+        ghostBirds->submit(renderQueue);
+    }
+    bird->submit(renderQueue);
+    renderQueue.flush();
 
-    // Camada 2: Personagem
-    bird->draw();
-    
     // Camada 3: UI do Jogo
     if (state == GameState::PLAYING) {
         scoreManager->draw();
@@ -154,40 +213,150 @@ void GameScene::draw() const {
     flashEffect->draw();
 
     if (state == GameState::GAME_OVER) {
-        wz_draw(gui);
+        Renderer::current().drawGui(gui);
     }
 }
 
 // --- MÉTODOS DE LÓGICA INTERNA ---
 
-void GameScene::updatePlaying(float deltaTime) {
-    timeSinceLastPipe += deltaTime;
-    if (timeSinceLastPipe >= PIPE_INTERVAL) {
-        spawnPipe();
-        timeSinceLastPipe = 0.0f;
+void GameScene::flap() {
+    if (state == GameState::GAME_INIT) {
+        // A física do pássaro passa a vir da simulação; o primeiro pulo inicia a partida.
+        state = GameState::PLAYING;
+        bird->setHoverEnabled(false);
+        getReadyUI->hide();
     }
-    checkCollisions();
-    
-    for (auto& pipePair : pipePool.getPipes()) {
-        if (pipePair->isActive() && pipePair->hasPassed(*bird)) {
+    jumpQueued = true;
+    gSound->play_fly();
+}
+
+void GameScene::updatePlaying(float deltaTime) {
+    // A simulação avança em passos fixos de 1/FPS, independentemente do deltaTime
+    // do quadro, para que a mesma semente e os mesmos pulos gerem a mesma partida.
+    tickAccumulator += deltaTime;
+    while (tickAccumulator >= FixedGameSimulation::TICK && state == GameState::PLAYING) {
+        tickAccumulator -= FixedGameSimulation::TICK;
+        if (botPilot || autopilotEnabled) assisted = true;
+        if (botPilot && !jumpQueued && botPilot->decide(simulation.getState())) flap();
+        if (autopilotEnabled && !jumpQueued && planner.plan(simulation.getState())) flap();
+
+        FixedSimState previous;
+        simulation.save(previous);
+        uint8_t events = simulation.step(jumpQueued);
+        rewindBuffer.push(previous, simulation.getState());
+        replay.record(jumpQueued, simulation.hash());
+        jumpQueued = false;
+        syncActors();
+
+        if (events & SIM_EVENT_SCORE) {
             gSound->play_point();
             scoreManager->increaseScore();
         }
+        if (events & SIM_EVENT_DEATH) {
+            initiateDeathSequence();
+        }
     }
 }
 
-void GameScene::checkCollisions() {
-    if (bird->getY() + bird->getHeight() >= floor->getY() || bird->getY() <= 0) {
-        initiateDeathSequence();
-        return;
+void GameScene::syncActors() {
+    const FixedSimState& simState = simulation.getState();
+    bird->syncPhysics(toFloat(simState.birdY), toFloat(simState.birdVelY), toFloat(simState.birdAngle));
+    pipePool.syncFrom(simState.course.span(), currentPipeTexture);
+    if (ghostsEnabled) {
+        ghosts.setTick(simState.tick);
     }
-    
-    for (auto& pipePair : pipePool.getPipes()) {
-        if (pipePair->isActive() && pipePair->isColliding(*bird)) {
-            initiateDeathSequence();
-            return;
+    SpectatorBroadcast::getInstance().publish(simState);
+}
+
+void GameScene::saveReplay(bool personalBest) {
+    try {
+        std::filesystem::create_directories("replays/best");
+        replay.save("replays/last.replay");
+        // O recorde de cada jogador vira um fantasma para as próximas corridas.
+        if (personalBest) {
+            replay.save("replays/best/" + PlayerData::getName() + ".replay");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Não foi possível salvar o replay: " << e.what() << std::endl;
+    }
+}
+
+void GameScene::loadGhosts() {
+    // Os fantasmas são os recordes do placar gravados na semente do líder:
+    // só partidas no mesmo percurso podem correr lado a lado.
+    ghosts.clear();
+    ghostSeed = 0;
+    bool haveSeed = false;
+    for (const auto& entry : ScoreSystem::getInstance().getTopScores(MAX_GHOSTS)) {
+        const std::string path = "replays/best/" + entry.first + ".replay";
+        if (!std::filesystem::exists(path)) continue;
+        try {
+            Replay best = Replay::load(path);
+            if (!haveSeed) {
+                ghostSeed = best.getSeed();
+                haveSeed = true;
+            }
+            if (best.getSeed() == ghostSeed) ghosts.add(best);
+        } catch (const std::exception& e) {
+            std::cerr << "Fantasma ignorado (" << path << "): " << e.what() << std::endl;
         }
     }
+    // A corrida muda o percurso para a semente do líder, então só começa quando o jogador pede (tecla G).
+    ghostsEnabled = false;
+    if (!ghosts.empty()) {
+        std::cout << ghosts.size() << " fantasmas carregados (" << ghosts.getEncodedBytes() << " bytes)" << std::endl;
+    }
+}
+
+void GameScene::saveCheckpoint() {
+    if (state != GameState::PLAYING) return;
+    simulation.save(checkpoint);
+    hasCheckpoint = true;
+}
+
+void GameScene::loadCheckpoint() {
+    if (!hasCheckpoint) return;
+
+    simulation.restore(checkpoint);
+    assisted = true;
+    // O histórico de rewind descreve o caminho até o estado anterior, não até o checkpoint.
+    rewindBuffer.clear();
+    tickAccumulator = 0.0f;
+    resumePlaying();
+}
+
+void GameScene::updateRewind(float deltaTime) {
+    // Volta um passo de simulação a cada 1/FPS segundo, na mesma velocidade do jogo.
+    tickAccumulator += deltaTime;
+    bool rewound = false;
+    while (tickAccumulator >= FixedGameSimulation::TICK) {
+        tickAccumulator -= FixedGameSimulation::TICK;
+        FixedSimState simState;
+        simulation.save(simState);
+        if (!rewindBuffer.stepBack(simState)) break;
+        simulation.restore(simState);
+        rewound = true;
+    }
+    // Se voltar até antes do primeiro pulo, a simulação fica em READY e espera o próximo pulo.
+    if (rewound) {
+        assisted = true;
+        resumePlaying();
+    }
+}
+
+void GameScene::resumePlaying() {
+    replay.truncate(simulation.getTick());
+    jumpQueued = false;
+
+    // Desfaz a sequência de morte e os efeitos visuais, se houver.
+    bird->reset();
+    bird->setHoverEnabled(false);
+    flashEffect->reset();
+    gameOverScreen->reset();
+    getReadyUI->hide();
+    scoreManager->setScore(simulation.getScore());
+    syncActors();
+    state = GameState::PLAYING;
 }
 
 void GameScene::initiateDeathSequence() {
@@ -203,24 +372,36 @@ void GameScene::initiateDeathSequence() {
 }
 
 void GameScene::restart() {
+    // Na corrida de fantasmas o percurso é o dos replays; fora dela, uma semente nova.
+    uint64_t seed = ghostSeed;
+    if (!ghostsEnabled) {
+        std::random_device seedSource;
+        seed = (static_cast<uint64_t>(seedSource()) << 32) | seedSource();
+    }
+    restart(seed);
+}
+
+void GameScene::restart(uint64_t seed) {
     bird->reset();
     pipePool.reset();
     scoreManager->reset();
     gameOverScreen->reset();
     flashEffect->reset();
     getReadyUI->show();
-    timeSinceLastPipe = 0.0f;
     state = GameState::GAME_INIT;
-}
-
-void GameScene::spawnPipe() {
-    PipePair* newPipePair = pipePool.getPipe();
-    if (newPipePair) {
-        float playableHeight = floor->getY();
-        int maxGapStart = static_cast<int>(playableHeight - PIPE_MIN_HEIGHT - PIPE_GAP);
-        float startYGap = dist(rng) * maxGapStart;
-        newPipePair->init(BUFFER_W, startYGap, PIPE_GAP, PIPE_SPEED, selectedTheme.pipe);
+    simulation.reset(seed);
+    ghosts.setTick(0);
+    if (BotManager::getInstance().isLoaded()) {
+        botPilot = std::make_unique<BotController>(BotManager::getInstance().getController(), seed);
     }
+    SpectatorBroadcast::getInstance().publish(simulation.getState());
+    replay.clear(seed);
+    hasCheckpoint = false;
+    rewindBuffer.clear();
+    rewindHeld = false;
+    assisted = false;
+    tickAccumulator = 0.0f;
+    jumpQueued = false;
 }
 
 void GameScene::initGUI(){
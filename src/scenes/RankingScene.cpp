@@ -4,7 +4,7 @@
 #include "scenes/StartMenu.hpp"
 #include "Constants.hpp"
 #include "util/ScoreSystem.hpp"
-#include <allegro5/allegro_primitives.h>
+#include "render/Renderer.hpp"
 #include <algorithm>
 #include <iostream>
 
@@ -13,9 +13,10 @@
  * @details Assim que a cena é criada, ela já carrega as pontuações e constrói a interface.
  */
 RankingScene::RankingScene(SceneManager* sceneManager)
-    : Scene(sceneManager), currentPage(0) {
+    : Scene(sceneManager), staticLayer(BUFFER_W, BUFFER_H), currentPage(0) {
     loadDummyData(); // Puxa os scores do sistema.
     buildUI();       // Monta os botões e a aparência da tela.
+    rebuildPages();  // Um cache por página, do tamanho do placar.
 }
 
 /**
@@ -42,6 +43,29 @@ void RankingScene::loadDummyData() {
     scores = scoreSy.getTopScores(20);
 }
 
+/**
+ * @brief Substitui as pontuações exibidas e volta para a primeira página.
+ * @param newScores Pares (nome, pontuação), já ordenados.
+ */
+void RankingScene::setScores(std::vector<std::pair<std::string, int>> newScores) {
+    scores = std::move(newScores);
+    currentPage = 0;
+    rebuildPages();
+}
+
+/**
+ * @brief Descarta as páginas já compostas; cada uma é composta de novo na primeira vez em que aparecer.
+ */
+void RankingScene::rebuildPages() {
+    const int pageCount = std::max(1, (static_cast<int>(scores.size()) + scoresPerPage - 1) / scoresPerPage);
+    const int width = scoreboard_image ? al_get_bitmap_width(scoreboard_image) : 0;
+    const int height = scoreboard_image ? al_get_bitmap_height(scoreboard_image) : 0;
+    pageLayers.clear();
+    for (int page = 0; page < pageCount; ++page) {
+        pageLayers.emplace_back(width, height);
+    }
+}
+
 /**
  * @brief Constrói todos os elementos da interface gráfica (UI).
  * @details Carrega as imagens, configura a biblioteca de GUI (WidgetZ) e cria os botões.
@@ -55,6 +79,12 @@ void RankingScene::buildUI() {
     scoreboard_image = rm.getBitmap("ranking_box");
     text_font = al_create_builtin_font(); // Usa uma fonte padrão do Allegro pro texto.
 
+    // Posição do placar, usada pelo fundo composto e pelas páginas.
+    if (title_image && scoreboard_image) {
+        board_x = (BUFFER_W - al_get_bitmap_width(scoreboard_image)) / 2.0f;
+        board_y = ((BUFFER_W - al_get_bitmap_width(title_image) * 2.0f) / 2.0f)*3;
+    }
+
     // --- Configuração da biblioteca de GUI (WidgetZ) ---
     // A gente copia um tema padrão e só troca a fonte, pra não começar do zero.
     memset(&skin_theme, 0, sizeof(skin_theme));
@@ -133,46 +163,64 @@ void RankingScene::update(float deltaTime) {
  * @brief Desenha tudo da cena na tela.
  */
 void RankingScene::draw() const {
-    float title_x;
+    Renderer& renderer = Renderer::current();
+    // 1 a 3. Fundo, título e placar não mudam: vêm do cache, numa única cópia.
+    if (ALLEGRO_BITMAP* cached = staticLayer.get(background_image, [this] { drawStaticLayer(); })) {
+        renderer.copyBitmap(cached, 0, 0);
+    } else {
+        drawStaticLayer();
+    }
+
+    // 4. Desenha as pontuações DENTRO do placar: a página atual, composta uma vez, numa única cópia.
+    if (scoreboard_image) {
+        LayerCache& page = pageLayers[currentPage];
+        if (ALLEGRO_BITMAP* cached = page.get(this, [this] { drawScores(0.0f, 0.0f); })) {
+            renderer.drawBitmap(cached, board_x, board_y, 0);
+        } else {
+            drawScores(board_x, board_y);
+        }
+    }
+    
+    // 5. Deixa a biblioteca de GUI desenhar os botões.
+    if (gui) {
+        renderer.drawGui(gui);
+    }
+}
+
+/**
+ * @brief Desenha as camadas fixas da cena: fundo, título e a moldura do placar.
+ */
+void RankingScene::drawStaticLayer() const {
+    Renderer& renderer = Renderer::current();
     // 1. Desenha o fundo.
     if (background_image) {
-        al_draw_bitmap(background_image, 0, 0, 0);
+        renderer.drawBitmap(background_image, 0, 0, 0);
     }
 
     // 2. Desenha o título.
     if (title_image) {
-        title_x = (BUFFER_W - al_get_bitmap_width(title_image) * 2.0f) / 2.0f;
-        al_draw_scaled_bitmap(title_image, 0, 0, al_get_bitmap_width(title_image), al_get_bitmap_height(title_image), title_x, 50, al_get_bitmap_width(title_image) * 2.0f, al_get_bitmap_height(title_image) * 2.0f, 0);
+        float title_x = (BUFFER_W - al_get_bitmap_width(title_image) * 2.0f) / 2.0f;
+        renderer.drawScaledBitmap(title_image, 0, 0, al_get_bitmap_width(title_image), al_get_bitmap_height(title_image), title_x, 50, al_get_bitmap_width(title_image) * 2.0f, al_get_bitmap_height(title_image) * 2.0f, 0);
     }
 
     // 3. Desenha a imagem do placar.
     if (scoreboard_image) {
-        float board_x = (BUFFER_W - al_get_bitmap_width(scoreboard_image)) / 2.0f;
-        float board_y = (title_x*3);
-        al_draw_bitmap(scoreboard_image, board_x, board_y, 0);
-        
-        // 4. Desenha as pontuações DENTRO do placar.
-        drawScores();
-    }
-    
-    // 5. Deixa a biblioteca de GUI desenhar os botões.
-    if (gui) {
-        wz_draw(gui);
+        renderer.drawBitmap(scoreboard_image, board_x, board_y, 0);
     }
 }
 
 /**
  * @brief Desenha a lista de pontuações na tela.
- * @details Cuida da paginação e do alinhamento do texto.
+ * @details Cuida da paginação e do alinhamento do texto. Chamado uma vez por página
+ * para compor o cache (em 0, 0), ou a cada quadro com o cache desligado.
+ * @param originX Borda esquerda do placar.
+ * @param originY Borda superior do placar.
  */
-void RankingScene::drawScores() const {
+void RankingScene::drawScores(float originX, float originY) const {
     if (!text_font) return;
+    Renderer& renderer = Renderer::current();
     
-    // Calcula as posições com base na posição do placar, pra tudo ficar alinhado.
-    float board_x = (BUFFER_W - al_get_bitmap_width(scoreboard_image)) / 2.0f;
-    float board_y = ((BUFFER_W - al_get_bitmap_width(title_image) * 2.0f) / 2.0f)*3;
-    
-    float start_y = board_y + 13; // Posição Y da primeira linha de texto.
+    float start_y = originY + 13; // Posição Y da primeira linha de texto.
     float line_height = 20;       // Espaço entre uma linha e outra.
 
     // --- Lógica de Paginação ---
@@ -186,16 +234,16 @@ void RankingScene::drawScores() const {
         float current_y = start_y + (i - start_index) * line_height;
         
         // Define as colunas pra alinhar o texto direitinho.
-        float rank_x = board_x + 30;
-        float name_x = board_x + 60;
-        float score_x = board_x + 200;
+        float rank_x = originX + 30;
+        float name_x = originX + 60;
+        float score_x = originX + 200;
 
         // Desenha as informações na tela.
         // Posição no ranking
-        al_draw_textf(text_font, al_map_rgb(255, 255, 255), rank_x, current_y, ALLEGRO_ALIGN_LEFT, "%d.", i + 1);
+        renderer.drawTextf(text_font, al_map_rgb(255, 255, 255), rank_x, current_y, ALLEGRO_ALIGN_LEFT, "%d.", i + 1);
         // Nome do jogador
-        al_draw_text(text_font, al_map_rgb(255, 255, 255), name_x, current_y, ALLEGRO_ALIGN_LEFT, playerScore.first.c_str());
+        renderer.drawText(text_font, al_map_rgb(255, 255, 255), name_x, current_y, ALLEGRO_ALIGN_LEFT, playerScore.first.c_str());
         // Pontuação
-        al_draw_textf(text_font, al_map_rgb(255, 255, 255), score_x, current_y, ALLEGRO_ALIGN_RIGHT, "%d", playerScore.second);
+        renderer.drawTextf(text_font, al_map_rgb(255, 255, 255), score_x, current_y, ALLEGRO_ALIGN_RIGHT, "%d", playerScore.second);
     }
 }
\ No newline at end of file
@@ -0,0 +1,98 @@
+/**
+ * @file SpectatorScene.cpp
+ * @brief Implementação da cena de espectador.
+ */
+#include "scenes/SpectatorScene.hpp"
+#include "scenes/StartMenu.hpp"
+#include "managers/SceneManager.hpp"
+#include "net/SpectatorBroadcast.hpp"
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+#include "render/Renderer.hpp"
+
+SpectatorScene::SpectatorScene(SceneManager* sceneManager, const std::string& address)
+    : Scene(sceneManager),
+      client(address),
+      hasState(false),
+      tickAccumulator(0.0f),
+      pipePool(PIPE_POOL_SIZE)
+{
+    themes = buildDefaultThemes();
+    const Theme& theme = themes[0];
+    bird = std::make_unique<Bird>(BIRD_START_X, BIRD_START_Y, BIRD_WIDTH, BIRD_HEIGHT, theme.bird_frames);
+    bird->setHoverEnabled(false);
+    background = std::make_unique<ParallaxBackground>(theme.background, BACKGROUND_SCROLL_SPEED);
+    floor = std::make_unique<Floor>(theme.floor);
+    scoreManager = std::make_unique<ScoreManager>();
+    font = al_create_builtin_font();
+}
+
+SpectatorScene::~SpectatorScene()
+{
+    if (font) al_destroy_font(font);
+}
+
+void SpectatorScene::processEvent(const ALLEGRO_EVENT& event)
+{
+    if (event.type == ALLEGRO_EVENT_KEY_DOWN && event.keyboard.keycode == ALLEGRO_KEY_ESCAPE) {
+        sceneManager->setCurrentScene(std::make_unique<StartMenu>(sceneManager));
+    }
+}
+
+void SpectatorScene::update(float deltaTime)
+{
+    receive();
+    if (decoder.pending() > MAX_QUEUED) decoder.trim(SpectatorBroadcast::FLUSH_FRAMES);
+
+    // Um estado por passo de simulação, como no jogo transmitido.
+    tickAccumulator += deltaTime;
+    while (tickAccumulator >= FixedGameSimulation::TICK) {
+        tickAccumulator -= FixedGameSimulation::TICK;
+        if (!decoder.pop(shown)) {
+            tickAccumulator = 0.0f;
+            break;
+        }
+        hasState = true;
+        SpectatorBroadcast::getInstance().publish(shown);
+        syncActors();
+    }
+
+    if (hasState && shown.phase == SimPhase::PLAYING) {
+        background->update(deltaTime);
+        floor->update(deltaTime);
+    }
+    bird->update(deltaTime);
+}
+
+void SpectatorScene::receive()
+{
+    uint8_t bytes[4096];
+    while (size_t size = client.receive(bytes, sizeof(bytes))) {
+        if (!decoder.feed(bytes, size)) break;
+    }
+}
+
+void SpectatorScene::syncActors()
+{
+    bird->syncPhysics(shown.getBirdY(), 0.0f, shown.getBirdAngle());
+    pipePool.syncFrom(shown.span(), themes[0].pipe);
+    scoreManager->setScore(shown.score);
+}
+
+void SpectatorScene::draw() const
+{
+    const ALLEGRO_COLOR white = al_map_rgb(255, 255, 255);
+    background->draw();
+    pipePool.draw();
+    floor->draw();
+    if (hasState) {
+        bird->draw();
+        scoreManager->drawNumberSprites(scoreManager->getScore(), BUFFER_W / 2, 30, 1.0f, TextAlign::CENTER);
+    }
+
+    const char* status = "AO VIVO";
+    if (decoder.isCorrupt()) status = "Transmissão inválida";
+    else if (client.isClosed()) status = "Transmissão encerrada";
+    else if (!hasState) status = "Conectando...";
+    Renderer::current().drawText(font, white, 8, BUFFER_H - 20, ALLEGRO_ALIGN_LEFT, status);
+}
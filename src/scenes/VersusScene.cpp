@@ -0,0 +1,170 @@
+/**
+ * @file VersusScene.cpp
+ * @brief Implementação da cena do modo versus.
+ */
+#include "scenes/VersusScene.hpp"
+#include "scenes/StartMenu.hpp"
+#include "managers/SceneManager.hpp"
+#include "net/VersusPacket.hpp"
+#include "net/SpectatorBroadcast.hpp"
+#include "Constants.hpp"
+#include "render/Renderer.hpp"
+#include <iostream>
+
+VersusScene::VersusScene(SceneManager* sceneManager, const VersusOptions& options)
+    : Scene(sceneManager),
+      options(options),
+      socket(options.localPort, options.remoteHost, options.remotePort),
+      outgoing(options.latencyMs, options.jitterMs, options.lossPercent, options.seed + options.player),
+      session(std::make_unique<RollbackSession>()),
+      peerAck(0), connected(false), tickAccumulator(0.0f), jumpQueued(false), stalls(0),
+      pipePool(PIPE_POOL_SIZE)
+{
+    // O jogador local usa o primeiro tema; o rival, o pássaro do segundo.
+    themes = buildDefaultThemes();
+    const Theme& theme = themes[0];
+    localBird = std::make_unique<Bird>(BIRD_START_X, BIRD_START_Y, BIRD_WIDTH, BIRD_HEIGHT, theme.bird_frames);
+    remoteBird = std::make_unique<Bird>(BIRD_START_X, BIRD_START_Y, BIRD_WIDTH, BIRD_HEIGHT, themes[1].bird_frames);
+    background = std::make_unique<ParallaxBackground>(theme.background, BACKGROUND_SCROLL_SPEED);
+    floor = std::make_unique<Floor>(theme.floor);
+    scoreManager = std::make_unique<ScoreManager>();
+    gSound = std::make_unique<GameSound>();
+    gSound->init(theme.music_path);
+    font = al_create_builtin_font();
+
+    session->start(options.seed, options.player);
+    std::cout << "Versus: jogador " << options.player << ", porta " << options.localPort
+              << ", rival em " << options.remoteHost << ":" << options.remotePort << std::endl;
+}
+
+VersusScene::~VersusScene()
+{
+    gSound->mute_music();
+    if (font) al_destroy_font(font);
+}
+
+void VersusScene::processEvent(const ALLEGRO_EVENT& event)
+{
+    if (event.type != ALLEGRO_EVENT_KEY_DOWN) return;
+
+    if (event.keyboard.keycode == ALLEGRO_KEY_ESCAPE) {
+        sceneManager->setCurrentScene(std::make_unique<StartMenu>(sceneManager));
+        return;
+    }
+    const FixedGameSimulation& local = session->getSimulation().getPlayer(session->getLocalPlayer());
+    if (event.keyboard.keycode == ALLEGRO_KEY_SPACE && connected && local.getPhase() != SimPhase::DEAD) {
+        jumpQueued = true;
+        gSound->play_fly();
+    }
+}
+
+void VersusScene::update(float deltaTime)
+{
+    receivePackets();
+
+    // A partida só começa quando o rival responde, para que os dois lados comecem juntos.
+    if (connected) {
+        const int previousScore = scoreManager->getScore();
+        tickAccumulator += deltaTime;
+        while (tickAccumulator >= FixedGameSimulation::TICK) {
+            if (!session->advance(jumpQueued)) {
+                // Longe demais das entradas do rival: espera a rede em vez de prever mais.
+                ++stalls;
+                tickAccumulator = 0.0f;
+                break;
+            }
+            tickAccumulator -= FixedGameSimulation::TICK;
+            jumpQueued = false;
+        }
+        // Mostra também as correções que chegaram enquanto a sessão esperava.
+        session->rollback();
+        syncActors();
+        if (scoreManager->getScore() > previousScore) gSound->play_point();
+    }
+    sendInputs();
+
+    const VersusSimulation& sim = session->getSimulation();
+    if (!sim.isOver()) {
+        background->update(deltaTime);
+        floor->update(deltaTime);
+    }
+    localBird->update(deltaTime);
+    remoteBird->update(deltaTime);
+}
+
+void VersusScene::receivePackets()
+{
+    uint8_t bytes[LatencyInjector::MAX_PACKET];
+    while (size_t size = socket.receive(bytes, sizeof(bytes))) {
+        VersusPacket packet;
+        if (!VersusPacket::decode(bytes, size, packet)) continue;
+        if (!connected) {
+            connected = true;
+            localBird->setHoverEnabled(false);
+            remoteBird->setHoverEnabled(false);
+        }
+        uint32_t ack = applyInputPacket(*session, packet);
+        if (ack > peerAck) peerAck = ack;
+    }
+}
+
+void VersusScene::sendInputs()
+{
+    // Um pacote por quadro, com todas as entradas ainda não confirmadas pelo rival.
+    const double now = al_get_time();
+    uint8_t bytes[VersusPacket::SIZE];
+    buildInputPacket(*session, peerAck).encode(bytes);
+    outgoing.push(bytes, sizeof(bytes), now);
+
+    uint8_t ready[LatencyInjector::MAX_PACKET];
+    while (size_t size = outgoing.pop(now, ready)) socket.send(ready, size);
+}
+
+void VersusScene::syncActors()
+{
+    const VersusSimulation& sim = session->getSimulation();
+    const FixedGameSimulation& local = sim.getPlayer(session->getLocalPlayer());
+    const FixedGameSimulation& remote = sim.getPlayer(1 - session->getLocalPlayer());
+
+    const FixedSimState& localState = local.getState();
+    const FixedSimState& remoteState = remote.getState();
+    localBird->syncPhysics(toFloat(localState.birdY), toFloat(localState.birdVelY), toFloat(localState.birdAngle));
+    remoteBird->syncPhysics(toFloat(remoteState.birdY), toFloat(remoteState.birdVelY), toFloat(remoteState.birdAngle));
+
+    // Enquanto os dois voam os percursos são idênticos; depois, mostra o de quem ainda voa.
+    const FixedSimState& shown = (local.getPhase() == SimPhase::DEAD && remote.getPhase() != SimPhase::DEAD)
+                                ? remoteState : localState;
+    pipePool.syncFrom(shown.course.span(), themes[0].pipe);
+    scoreManager->setScore(local.getScore());
+    SpectatorBroadcast::getInstance().publish(localState);
+}
+
+void VersusScene::draw() const
+{
+    Renderer& renderer = Renderer::current();
+    const VersusSimulation& sim = session->getSimulation();
+    const FixedGameSimulation& remote = sim.getPlayer(1 - session->getLocalPlayer());
+    const ALLEGRO_COLOR white = al_map_rgb(255, 255, 255);
+
+    background->draw();
+    pipePool.draw();
+    floor->draw();
+    remoteBird->draw();
+    localBird->draw();
+
+    scoreManager->drawNumberSprites(scoreManager->getScore(), BUFFER_W / 2, 30, 1.0f, TextAlign::CENTER);
+    renderer.drawTextf(font, white, BUFFER_W - 8, 10, ALLEGRO_ALIGN_RIGHT, "Rival: %d", remote.getScore());
+
+    if (!connected) {
+        renderer.drawText(font, white, BUFFER_W / 2, BUFFER_H / 2 - 40, ALLEGRO_ALIGN_CENTER, "Esperando o rival...");
+    } else if (sim.isOver() && session->isConfirmed()) {
+        const int winner = sim.getWinner();
+        const char* result = winner < 0 ? "Empate!" : (winner == session->getLocalPlayer() ? "Você venceu!" : "Você perdeu!");
+        renderer.drawText(font, white, BUFFER_W / 2, BUFFER_H / 2 - 40, ALLEGRO_ALIGN_CENTER, result);
+        renderer.drawText(font, white, BUFFER_W / 2, BUFFER_H / 2 - 24, ALLEGRO_ALIGN_CENTER, "ESC volta ao menu");
+    }
+
+    // Estatísticas do rollback, para acompanhar o efeito da latência.
+    renderer.drawTextf(font, white, 8, BUFFER_H - 20, ALLEGRO_ALIGN_LEFT, "rollbacks %u (max %u) esperas %u",
+                       session->getRollbackCount(), session->getMaxRollback(), stalls);
+}
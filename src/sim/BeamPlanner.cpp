@@ -0,0 +1,89 @@
+/**
+ * @file BeamPlanner.cpp
+ * @brief Implementação da busca em feixe sobre os pulos.
+ */
+#include "sim/BeamPlanner.hpp"
+#include <algorithm>
+#include <cmath>
+
+BeamPlanner::BeamPlanner(int width, int horizon)
+    : width(width), horizon(horizon), plansEvaluated(0), stepsSimulated(0), lastSurvival(0)
+{
+    beam.resize(width);
+    children.resize(2 * width);
+}
+
+float BeamPlanner::evaluate(const FixedSimState& state, int depth)
+{
+    // Cada passo sobrevivido vale mais do que qualquer posição ou ponto.
+    float value = depth * 10000.0f + state.score * 1000.0f;
+    const FixedPipeCourse& course = state.course;
+    const int p = course.firstAhead(Fixed(BIRD_START_X));
+    const float target = p < course.getCount() ? (toFloat(course.getGapTop(p)) + toFloat(course.getGapBottom(p))) / 2.0f
+                                               : PLAYABLE_AREA_HEIGHT / 2.0f;
+    return value - std::fabs(toFloat(state.birdY) + BIRD_HEIGHT / 2.0f - target);
+}
+
+bool BeamPlanner::sameCell(const Node& a, const Node& b)
+{
+    return a.alive == b.alive
+        && static_cast<int>(toFloat(a.state.birdY)) == static_cast<int>(toFloat(b.state.birdY))
+        && static_cast<int>(toFloat(a.state.birdVelY) / VELOCITY_CELL) == static_cast<int>(toFloat(b.state.birdVelY) / VELOCITY_CELL);
+}
+
+bool BeamPlanner::plan(const FixedSimState& state)
+{
+    if (state.phase == SimPhase::READY) return true;
+    if (state.phase == SimPhase::DEAD) return false;
+
+    beam[0].state = state;
+    beam[0].value = 0.0f;
+    beam[0].firstJump = 0;
+    beam[0].alive = 1;
+    int beamSize = 1;
+    int depth = 0;
+
+    for (depth = 1; depth <= horizon; ++depth) {
+        int childCount = 0;
+        for (int b = 0; b < beamSize; ++b) {
+            const Node& parent = beam[b];
+            if (!parent.alive) {
+                // Planos mortos continuam no feixe só como última opção.
+                children[childCount++] = parent;
+                continue;
+            }
+            for (uint8_t jump = 0; jump < 2; ++jump) {
+                Node& child = children[childCount++];
+                sim.restore(parent.state);
+                sim.step(jump != 0);
+                ++stepsSimulated;
+                sim.save(child.state);
+                child.alive = sim.getPhase() != SimPhase::DEAD;
+                child.firstJump = depth == 1 ? jump : parent.firstJump;
+                // Um plano que morre vale menos que qualquer plano vivo do mesmo nível,
+                // mas mais que os que morreram antes.
+                child.value = child.alive ? evaluate(child.state, depth) : parent.value - 5000.0f;
+            }
+        }
+
+        // Os width melhores seguem para o próximo nível. Planos que chegam quase ao
+        // mesmo ponto (mesmo pixel e mesma faixa de velocidade) são redundantes:
+        // fica só o melhor deles, para o feixe não se encher de variações de um plano só.
+        std::sort(children.begin(), children.begin() + childCount,
+                  [](const Node& a, const Node& b) { return a.value > b.value; });
+        beamSize = 0;
+        for (int c = 0; c < childCount && beamSize < width; ++c) {
+            const Node& child = children[c];
+            bool duplicate = false;
+            for (int b = 0; b < beamSize && !duplicate; ++b) {
+                duplicate = sameCell(beam[b], child);
+            }
+            if (!duplicate) beam[beamSize++] = child;
+        }
+        if (!beam[0].alive) break;
+    }
+
+    plansEvaluated += beamSize;
+    lastSurvival = beam[0].alive ? horizon : static_cast<uint32_t>(depth - 1);
+    return beam[0].firstJump != 0;
+}
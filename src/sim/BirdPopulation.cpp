@@ -0,0 +1,123 @@
+/**
+ * @file BirdPopulation.cpp
+ * @brief Implementação da simulação SoA de muitos pássaros.
+ */
+#include "sim/BirdPopulation.hpp"
+#include "sim/BirdPhysics.hpp"
+#include "sim/BroadPhase.hpp"
+#include "sim/PipePhysics.hpp"
+#include "Constants.hpp"
+#include <cfloat>
+#include <climits>
+
+namespace {
+    /**
+     * @brief Laço principal sobre os pássaros, sem desvios dependentes de dados.
+     * @details Todas as decisões por pássaro (pulo, vivo, colisão) viram seleções,
+     * o que permite ao compilador processar vários pássaros por instrução.
+     * @tparam Scalar float ou Fixed.
+     * @tparam HasJumps Se false, o array de pulos não é lido.
+     */
+    template <typename Scalar, bool HasJumps>
+    int32_t stepKernel(size_t n, const uint8_t* __restrict jumps,
+                       Scalar* __restrict y, Scalar* __restrict velY, Scalar* __restrict angle,
+                       int32_t* __restrict alive, int32_t* __restrict score,
+                       Scalar safeTop, Scalar safeBottom, int32_t passedPipes, Scalar deltaTime)
+    {
+        int32_t living = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const Scalar oldY = y[i];
+            const Scalar oldVelY = velY[i];
+            const int32_t wasAlive = alive[i];
+
+            Scalar newVelY = oldVelY;
+            if (HasJumps) newVelY = jumps[i] ? Scalar(JUMP_IMPULSE_VELOCITY) : newVelY;
+            Scalar newY = oldY;
+            integrateBird(newY, newVelY, deltaTime);
+            const Scalar newAngle = birdAngleFor(newVelY);
+
+            const bool hit = birdOutOfBounds(newY, Scalar(BIRD_HEIGHT)) |
+                             birdOutsideGap(newY, newY + Scalar(BIRD_HEIGHT), safeTop, safeBottom);
+            const int32_t nowAlive = wasAlive & static_cast<int32_t>(!hit);
+
+            // Pássaros mortos ficam congelados no último estado.
+            y[i] = wasAlive ? newY : oldY;
+            velY[i] = wasAlive ? newVelY : oldVelY;
+            angle[i] = wasAlive ? newAngle : angle[i];
+            alive[i] = nowAlive;
+            score[i] += nowAlive * passedPipes;
+            living += nowAlive;
+        }
+        return living;
+    }
+
+    /// Limites da faixa livre quando nenhum cano cruza a coluna.
+    template <typename Scalar> Scalar lowestValue();
+    template <typename Scalar> Scalar highestValue();
+    template <> float lowestValue<float>() { return -FLT_MAX; }
+    template <> float highestValue<float>() { return FLT_MAX; }
+    template <> Fixed lowestValue<Fixed>() { return Fixed::fromRaw(INT32_MIN); }
+    template <> Fixed highestValue<Fixed>() { return Fixed::fromRaw(INT32_MAX); }
+}
+
+template <typename Scalar>
+BasicBirdPopulation<Scalar>::BasicBirdPopulation(size_t size)
+    : y(size), velY(size), angle(size), alive(size), score(size), aliveCount(size)
+{
+    reset();
+}
+
+template <typename Scalar>
+void BasicBirdPopulation<Scalar>::reset()
+{
+    for (size_t i = 0; i < y.size(); ++i) {
+        y[i] = Scalar(BIRD_START_Y);
+        velY[i] = Scalar(0);
+        angle[i] = Scalar(0);
+        alive[i] = 1;
+        score[i] = 0;
+    }
+    aliveCount = y.size();
+}
+
+template <typename Scalar>
+size_t BasicBirdPopulation<Scalar>::step(const uint8_t* jumps, BasicPipeCourse<Scalar>& course, Scalar deltaTime)
+{
+    // Mesma ordem da GameScene::update no estado PLAYING.
+    course.advance(deltaTime);
+    course.spawnIfDue(deltaTime);
+    int passedPipes = course.collectPassed(Scalar(BIRD_START_X));
+    return stepBirds(jumps, course.span(), passedPipes, deltaTime);
+}
+
+template <typename Scalar>
+size_t BasicBirdPopulation<Scalar>::stepBirds(const uint8_t* jumps, const BasicPipeSpan<Scalar>& pipes,
+                                              int passedPipes, Scalar deltaTime)
+{
+    // Todos os pássaros compartilham a mesma coluna X: a busca binária acha os
+    // canos que a cruzam uma única vez por passo, e eles são reduzidos a uma faixa
+    // livre vertical (a interseção dos vãos) testada por cada pássaro.
+    const Scalar birdLeft = Scalar(BIRD_START_X);
+    const Scalar birdRight = Scalar(BIRD_START_X + BIRD_WIDTH);
+    const PipeWindow window = findPipeWindow(pipes, birdLeft, birdRight);
+    Scalar safeTop = lowestValue<Scalar>();
+    Scalar safeBottom = highestValue<Scalar>();
+    for (int p = window.first; p < window.last; ++p) {
+        if (pipes.gapTop[p] > safeTop) safeTop = pipes.gapTop[p];
+        if (pipes.gapBottom[p] < safeBottom) safeBottom = pipes.gapBottom[p];
+    }
+
+    int32_t living;
+    if (jumps) {
+        living = stepKernel<Scalar, true>(y.size(), jumps, y.data(), velY.data(), angle.data(), alive.data(), score.data(),
+                                          safeTop, safeBottom, passedPipes, deltaTime);
+    } else {
+        living = stepKernel<Scalar, false>(y.size(), nullptr, y.data(), velY.data(), angle.data(), alive.data(), score.data(),
+                                           safeTop, safeBottom, passedPipes, deltaTime);
+    }
+    aliveCount = static_cast<size_t>(living);
+    return aliveCount;
+}
+
+template class BasicBirdPopulation<float>;
+template class BasicBirdPopulation<Fixed>;
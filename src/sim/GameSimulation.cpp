@@ -0,0 +1,96 @@
+/**
+ * @file GameSimulation.cpp
+ * @brief Implementação da partida headless com passo fixo.
+ */
+#include "sim/GameSimulation.hpp"
+#include "sim/BirdPhysics.hpp"
+#include "sim/BroadPhase.hpp"
+#include "sim/PipePhysics.hpp"
+#include "sim/StateHash.hpp"
+
+template <typename Scalar>
+void BasicGameSimulation<Scalar>::reset(uint64_t seed)
+{
+    state.tick = 0;
+    state.phase = SimPhase::READY;
+    state.score = 0;
+    state.birdY = Scalar(BIRD_START_Y);
+    state.birdVelY = Scalar(0);
+    state.birdAngle = Scalar(0);
+    state.course.reset(seed);
+}
+
+template <typename Scalar>
+void BasicGameSimulation<Scalar>::setParams(const SimParams& newParams)
+{
+    params = newParams;
+    scalarParams.gravity = Scalar(params.gravity);
+    scalarParams.jumpVelocity = Scalar(params.jumpVelocity);
+    scalarParams.terminalVelocity = Scalar(params.terminalVelocity);
+    scalarParams.pipeSpeed = Scalar(params.pipeSpeed);
+    scalarParams.pipeInterval = Scalar(params.pipeInterval);
+}
+
+template <typename Scalar>
+uint8_t BasicGameSimulation<Scalar>::step(bool jump)
+{
+    if (state.phase == SimPhase::DEAD) return SIM_EVENT_NONE;
+    if (state.phase == SimPhase::READY) {
+        if (!jump) return SIM_EVENT_NONE;
+        state.phase = SimPhase::PLAYING;
+    }
+
+    uint8_t events = SIM_EVENT_NONE;
+    state.course.advance(SCALAR_TICK, scalarParams.pipeSpeed);
+
+    if (jump) {
+        state.birdVelY = scalarParams.jumpVelocity;
+        events |= SIM_EVENT_JUMP;
+    }
+    integrateBird(state.birdY, state.birdVelY, SCALAR_TICK, scalarParams.gravity, scalarParams.terminalVelocity);
+    state.birdAngle = birdAngleFor(state.birdVelY);
+
+    state.course.spawnIfDue(SCALAR_TICK, scalarParams.pipeInterval, params.pipeGap);
+
+    const Scalar birdLeft(BIRD_START_X);
+    const Scalar birdRight(BIRD_START_X + BIRD_WIDTH);
+    const Scalar birdTop = state.birdY;
+    const Scalar birdBottom = state.birdY + Scalar(BIRD_HEIGHT);
+    bool hit = birdOutOfBounds(state.birdY, Scalar(BIRD_HEIGHT));
+    const BasicPipeSpan<Scalar> pipes = state.course.span();
+    const PipeWindow window = findPipeWindow(pipes, birdLeft, birdRight);
+    for (int p = window.first; p < window.last && !hit; ++p) {
+        hit = birdOutsideGap(birdTop, birdBottom, pipes.gapTop[p], pipes.gapBottom[p]);
+    }
+
+    if (hit) {
+        state.phase = SimPhase::DEAD;
+        events |= SIM_EVENT_DEATH;
+    } else if (int passed = state.course.collectPassed(birdLeft)) {
+        state.score += passed * SCORE_INCREASE_AMOUNT;
+        events |= SIM_EVENT_SCORE;
+    }
+
+    ++state.tick;
+    return events;
+}
+
+template <typename Scalar>
+uint64_t BasicGameSimulation<Scalar>::hash() const
+{
+    StateHasher hasher;
+    const BasicPipeCourse<Scalar>& course = state.course;
+    hasher.add(state.tick, static_cast<uint32_t>(state.phase));
+    hasher.add(static_cast<uint32_t>(state.score), StateHasher::bits(state.birdY));
+    hasher.add(StateHasher::bits(state.birdVelY), StateHasher::bits(state.birdAngle));
+    hasher.add(static_cast<uint32_t>(course.getCount()), StateHasher::bits(course.getTimeSinceLastPipe()));
+    hasher.add(course.getRandom().state);
+    for (int i = 0; i < course.getCount(); ++i) {
+        hasher.add(StateHasher::bits(course.getX(i)), StateHasher::bits(course.getGapTop(i)));
+        hasher.add(StateHasher::bits(course.getGapBottom(i)), static_cast<uint32_t>(course.hasPassed(i)));
+    }
+    return hasher.digest();
+}
+
+template class BasicGameSimulation<float>;
+template class BasicGameSimulation<Fixed>;
@@ -0,0 +1,126 @@
+/**
+ * @file GhostTrack.cpp
+ * @brief Implementação das trajetórias compactas dos fantasmas.
+ */
+#include "sim/GhostTrack.hpp"
+#include "sim/GameSimulation.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    void writeVarint(std::vector<uint8_t>& out, int32_t value)
+    {
+        // Zigzag: valores pequenos, positivos ou negativos, ocupam um byte.
+        uint32_t v = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        while (v >= 0x80) {
+            out.push_back(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(v));
+    }
+
+    int32_t readVarint(const uint8_t* data, uint32_t& pos)
+    {
+        uint32_t v = 0;
+        int shift = 0;
+        uint8_t b;
+        do {
+            b = data[pos++];
+            v |= static_cast<uint32_t>(b & 0x7F) << shift;
+            shift += 7;
+        } while (b & 0x80);
+        return static_cast<int32_t>((v >> 1) ^ (~(v & 1) + 1));
+    }
+}
+
+void GhostTrackSet::clear()
+{
+    bytes.clear();
+    keyframes.clear();
+    tracks.clear();
+    y.clear();
+    angle.clear();
+    cursor.clear();
+    visible.clear();
+    tick = 0;
+}
+
+void GhostTrackSet::add(const Replay& replay)
+{
+    FixedGameSimulation sim;
+    sim.reset(replay.getSeed());
+
+    Track track;
+    track.length = static_cast<uint32_t>(replay.getTickCount());
+    track.firstKeyframe = static_cast<uint32_t>(keyframes.size());
+    track.finalScore = replay.getFinalScore();
+
+    const size_t startBytes = bytes.size();
+    int32_t lastY = 0, lastAngle = 0;
+    for (uint32_t t = 0; t < track.length; ++t) {
+        sim.step(replay.getJump(t));
+        if (sim.hash() != replay.getHash(t)) {
+            // Descarta o que já foi codificado deste replay.
+            bytes.resize(startBytes);
+            keyframes.resize(track.firstKeyframe);
+            throw std::runtime_error("Replay não reproduz o passo " + std::to_string(t));
+        }
+
+        const int32_t qy = static_cast<int32_t>(std::lround(toFloat(sim.getState().birdY) * Y_SCALE));
+        const int32_t qangle = static_cast<int32_t>(std::lround(toFloat(sim.getState().birdAngle)));
+        if (t % KEYFRAME_INTERVAL == 0) {
+            keyframes.push_back(Keyframe{qy, qangle, static_cast<uint32_t>(bytes.size())});
+        } else {
+            writeVarint(bytes, qy - lastY);
+            writeVarint(bytes, qangle - lastAngle);
+        }
+        lastY = qy;
+        lastAngle = qangle;
+    }
+
+    tracks.push_back(track);
+    y.push_back(0);
+    angle.push_back(0);
+    cursor.push_back(0);
+    visible.push_back(0);
+    seekGhost(tracks.size() - 1, tick);
+}
+
+void GhostTrackSet::setTick(uint32_t newTick)
+{
+    const bool sequential = newTick == tick + 1;
+    tick = newTick;
+    const uint8_t* data = bytes.data();
+    for (size_t g = 0; g < tracks.size(); ++g) {
+        // O passo T da partida mostra a posição depois do passo gravado T - 1.
+        const uint32_t entry = newTick - 1;
+        if (newTick == 0 || entry >= tracks[g].length) {
+            visible[g] = 0;
+        } else if (sequential && entry % KEYFRAME_INTERVAL != 0) {
+            y[g] += readVarint(data, cursor[g]);
+            angle[g] += readVarint(data, cursor[g]);
+        } else {
+            seekGhost(g, newTick);
+        }
+    }
+}
+
+void GhostTrackSet::seekGhost(size_t ghost, uint32_t forTick)
+{
+    const Track& track = tracks[ghost];
+    if (forTick == 0 || forTick - 1 >= track.length) {
+        visible[ghost] = 0;
+        return;
+    }
+    const uint32_t entry = forTick - 1;
+    const Keyframe& key = keyframes[track.firstKeyframe + entry / KEYFRAME_INTERVAL];
+    y[ghost] = key.y;
+    angle[ghost] = key.angle;
+    cursor[ghost] = key.offset;
+    for (uint32_t e = entry - entry % KEYFRAME_INTERVAL + 1; e <= entry; ++e) {
+        y[ghost] += readVarint(bytes.data(), cursor[ghost]);
+        angle[ghost] += readVarint(bytes.data(), cursor[ghost]);
+    }
+    visible[ghost] = 1;
+}
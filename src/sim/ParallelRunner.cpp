@@ -0,0 +1,80 @@
+/**
+ * @file ParallelRunner.cpp
+ * @brief Implementação do laço paralelo com threads persistentes.
+ */
+#include "sim/ParallelRunner.hpp"
+
+ParallelRunner::ParallelRunner(unsigned threads)
+    : task(nullptr), count(0), round(0), pending(0), stopping(false)
+{
+    if (threads == 0) threads = std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    workers.reserve(threads - 1);
+    for (unsigned i = 1; i < threads; ++i) {
+        workers.emplace_back(&ParallelRunner::workerLoop, this, i);
+    }
+}
+
+ParallelRunner::~ParallelRunner()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) worker.join();
+}
+
+void ParallelRunner::slice(unsigned index, size_t& begin, size_t& end) const
+{
+    const size_t threads = getThreadCount();
+    begin = count * index / threads;
+    end = count * (index + 1) / threads;
+}
+
+void ParallelRunner::run(size_t total, const Task& work)
+{
+    if (workers.empty() || total < 2) {
+        if (total > 0) work(0, total);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &work;
+        count = total;
+        pending = static_cast<unsigned>(workers.size());
+        ++round;
+    }
+    wake.notify_all();
+
+    size_t begin, end;
+    slice(0, begin, end);
+    if (begin < end) work(begin, end);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this] { return pending == 0; });
+    task = nullptr;
+}
+
+void ParallelRunner::workerLoop(unsigned index)
+{
+    uint64_t seen = 0;
+    for (;;) {
+        const Task* work;
+        size_t begin, end;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || round != seen; });
+            if (stopping) return;
+            seen = round;
+            work = task;
+            slice(index, begin, end);
+        }
+
+        if (begin < end) (*work)(begin, end);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0) finished.notify_one();
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * @file PipeCourse.cpp
+ * @brief Implementação do percurso de canos headless.
+ */
+#include "sim/PipeCourse.hpp"
+#include "sim/PipePhysics.hpp"
+#include "Constants.hpp"
+
+namespace {
+    /// Valor uniforme em [0, 1) no tipo escalar da simulação.
+    template <typename Scalar> Scalar randomUnit(SimRandom& rng);
+
+    template <> float randomUnit<float>(SimRandom& rng) { return rng.nextFloat(); }
+
+    // Só inteiros: os 16 bits mais altos viram a fração de um Q16.16.
+    template <> Fixed randomUnit<Fixed>(SimRandom& rng) { return Fixed::fromRaw(static_cast<int32_t>(rng.next() >> 48)); }
+}
+
+template <typename Scalar>
+void BasicPipeCourse<Scalar>::reset(uint64_t seed)
+{
+    for (int i = 0; i < CAPACITY; ++i) {
+        x[i] = -Scalar(PIPE_WIDTH);
+        gapTop[i] = Scalar(0);
+        gapBottom[i] = Scalar(0);
+        passed[i] = 0;
+    }
+    count = 0;
+    timeSinceLastPipe = Scalar(0);
+    rng.seed(seed);
+}
+
+template <typename Scalar>
+void BasicPipeCourse<Scalar>::advance(Scalar deltaTime, Scalar speed)
+{
+    for (int i = 0; i < count; ++i) {
+        advancePipe(x[i], speed, deltaTime);
+    }
+
+    // Os canos se movem juntos, então os que saem da tela são sempre os primeiros.
+    while (count > 0 && pipeOffScreen(x[0], Scalar(PIPE_WIDTH))) {
+        popFront();
+    }
+}
+
+template <typename Scalar>
+bool BasicPipeCourse<Scalar>::spawnIfDue(Scalar deltaTime, Scalar interval, float gap)
+{
+    timeSinceLastPipe += deltaTime;
+    if (timeSinceLastPipe < interval) return false;
+    timeSinceLastPipe = Scalar(0);
+
+    // Mesma regra de GameScene::spawnPipe.
+    int maxGapStart = static_cast<int>(PLAYABLE_AREA_HEIGHT - PIPE_MIN_HEIGHT - gap);
+    Scalar startYGap = randomUnit<Scalar>(rng) * Scalar(maxGapStart);
+
+    if (count == CAPACITY) {
+        popFront(); // Não deveria acontecer com os parâmetros atuais, mas nunca estoura.
+    }
+    x[count] = Scalar(BUFFER_W);
+    gapTop[count] = startYGap;
+    gapBottom[count] = startYGap + Scalar(gap);
+    passed[count] = 0;
+    ++count;
+    return true;
+}
+
+template <typename Scalar>
+int BasicPipeCourse<Scalar>::collectPassed(Scalar birdX)
+{
+    int newlyPassed = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!passed[i] && birdX > x[i] + Scalar(PIPE_WIDTH / 2)) {
+            passed[i] = 1;
+            ++newlyPassed;
+        }
+    }
+    return newlyPassed;
+}
+
+template <typename Scalar>
+int BasicPipeCourse<Scalar>::firstAhead(Scalar birdX) const
+{
+    int i = 0;
+    while (i < count && x[i] + Scalar(PIPE_WIDTH) < birdX) ++i;
+    return i;
+}
+
+template <typename Scalar>
+void BasicPipeCourse<Scalar>::popFront()
+{
+    for (int i = 1; i < count; ++i) {
+        x[i - 1] = x[i];
+        gapTop[i - 1] = gapTop[i];
+        gapBottom[i - 1] = gapBottom[i];
+        passed[i - 1] = passed[i];
+    }
+    --count;
+    x[count] = -Scalar(PIPE_WIDTH);
+    gapTop[count] = Scalar(0);
+    gapBottom[count] = Scalar(0);
+    passed[count] = 0;
+}
+
+template class BasicPipeCourse<float>;
+template class BasicPipeCourse<Fixed>;
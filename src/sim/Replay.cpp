@@ -0,0 +1,125 @@
+/**
+ * @file Replay.cpp
+ * @brief Implementação da gravação e do formato de arquivo dos replays.
+ */
+#include "sim/Replay.hpp"
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+    const char MAGIC[4] = {'F', 'B', 'R', 'P'};
+    const uint64_t BYTES_PER_TICK = 1 + 8; ///< Um byte de pulo e um hash de 8 bytes por passo.
+
+    /// Escreve um inteiro em little-endian, independente da arquitetura.
+    void writeLE(std::ofstream& out, uint64_t value, int bytes)
+    {
+        char buffer[8];
+        for (int i = 0; i < bytes; ++i) buffer[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        out.write(buffer, bytes);
+    }
+
+    uint64_t readLE(std::ifstream& in, int bytes)
+    {
+        unsigned char buffer[8];
+        if (!in.read(reinterpret_cast<char*>(buffer), bytes)) {
+            throw std::runtime_error("Replay truncado.");
+        }
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; ++i) value |= static_cast<uint64_t>(buffer[i]) << (8 * i);
+        return value;
+    }
+}
+
+void Replay::clear(uint64_t newSeed)
+{
+    seed = newSeed;
+    finalScore = 0;
+    jumps.clear();
+    hashes.clear();
+}
+
+void Replay::reserve(size_t ticks)
+{
+    jumps.reserve(ticks);
+    hashes.reserve(ticks);
+}
+
+void Replay::record(bool jump, uint64_t stateHash)
+{
+    jumps.push_back(jump ? 1 : 0);
+    hashes.push_back(stateHash);
+}
+
+void Replay::truncate(size_t ticks)
+{
+    if (ticks < jumps.size()) {
+        jumps.resize(ticks);
+        hashes.resize(ticks);
+    }
+}
+
+long Replay::firstMismatch(const Replay& other) const
+{
+    size_t common = hashes.size() < other.hashes.size() ? hashes.size() : other.hashes.size();
+    for (size_t i = 0; i < common; ++i) {
+        if (hashes[i] != other.hashes[i]) return static_cast<long>(i);
+    }
+    return hashes.size() == other.hashes.size() ? -1 : static_cast<long>(common);
+}
+
+void Replay::save(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open()) {
+        throw std::runtime_error("Não foi possível salvar o replay em: " + path);
+    }
+    out.write(MAGIC, sizeof(MAGIC));
+    writeLE(out, VERSION, 4);
+    writeLE(out, seed, 8);
+    writeLE(out, jumps.size(), 4);
+    writeLE(out, static_cast<uint32_t>(finalScore), 4);
+    out.write(reinterpret_cast<const char*>(jumps.data()), static_cast<std::streamsize>(jumps.size()));
+    for (uint64_t h : hashes) writeLE(out, h, 8);
+    if (!out) {
+        throw std::runtime_error("Erro ao escrever o replay: " + path);
+    }
+}
+
+Replay Replay::load(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error("Replay não encontrado: " + path);
+    }
+    char magic[4];
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, MAGIC)) {
+        throw std::runtime_error("Arquivo não é um replay: " + path);
+    }
+    if (readLE(in, 4) != VERSION) {
+        throw std::runtime_error("Versão de replay não suportada: " + path);
+    }
+
+    Replay replay;
+    replay.seed = readLE(in, 8);
+    const uint64_t ticks = readLE(in, 4);
+    replay.finalScore = static_cast<int32_t>(readLE(in, 4));
+
+    // O número de passos vem do arquivo: só aloca o que o resto do arquivo pode de fato conter.
+    const std::streampos dataStart = in.tellg();
+    in.seekg(0, std::ios::end);
+    const std::streamoff remaining = in.tellg() - dataStart;
+    in.seekg(dataStart);
+    if (!in || remaining < 0 || ticks * BYTES_PER_TICK > static_cast<uint64_t>(remaining)) {
+        throw std::runtime_error("Replay truncado: " + path);
+    }
+
+    replay.jumps.resize(static_cast<size_t>(ticks));
+    in.read(reinterpret_cast<char*>(replay.jumps.data()), static_cast<std::streamsize>(ticks));
+    replay.hashes.resize(static_cast<size_t>(ticks));
+    for (size_t i = 0; i < ticks && in; ++i) replay.hashes[i] = readLE(in, 8);
+    if (!in) {
+        throw std::runtime_error("Replay truncado: " + path);
+    }
+    return replay;
+}
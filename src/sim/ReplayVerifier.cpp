@@ -0,0 +1,72 @@
+/**
+ * @file ReplayVerifier.cpp
+ * @brief Implementação da conferência de replays por re-simulação.
+ */
+#include "sim/ReplayVerifier.hpp"
+#include "sim/GameSimulation.hpp"
+#include <exception>
+
+ReplayVerifier::ReplayVerifier(unsigned threads)
+    : runner(threads)
+{
+}
+
+std::vector<ReplayCheck> ReplayVerifier::verify(const std::vector<Replay>& replays)
+{
+    std::vector<ReplayCheck> checks(replays.size());
+    runner.run(replays.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) checks[i] = check(replays[i]);
+    });
+    return checks;
+}
+
+std::vector<ReplayCheck> ReplayVerifier::verifyFiles(const std::vector<std::string>& paths)
+{
+    std::vector<ReplayCheck> checks(paths.size());
+    runner.run(paths.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            try {
+                checks[i] = check(Replay::load(paths[i]));
+            } catch (const std::exception&) {
+                checks[i] = ReplayCheck{ReplayStatus::UNREADABLE, 0, 0, -1};
+            }
+        }
+    });
+    return checks;
+}
+
+ReplayCheck ReplayVerifier::check(const Replay& replay, int32_t claimedScore)
+{
+    FixedGameSimulation sim;
+    sim.reset(replay.getSeed());
+    const size_t ticks = replay.getTickCount();
+    for (size_t t = 0; t < ticks; ++t) {
+        // Depois da colisão os passos não mudam nada; um replay que continua
+        // depois dela não veio de uma partida real.
+        if (sim.getPhase() == SimPhase::DEAD) {
+            return ReplayCheck{ReplayStatus::AFTER_DEATH, sim.getScore(), static_cast<uint32_t>(t), static_cast<long>(t)};
+        }
+        sim.step(replay.getJump(t));
+        if (sim.hash() != replay.getHash(t)) {
+            return ReplayCheck{ReplayStatus::HASH_MISMATCH, sim.getScore(), static_cast<uint32_t>(t + 1), static_cast<long>(t)};
+        }
+    }
+
+    const uint32_t simulated = static_cast<uint32_t>(ticks);
+    if (sim.getScore() != replay.getFinalScore() || sim.getScore() != claimedScore) {
+        return ReplayCheck{ReplayStatus::SCORE_MISMATCH, sim.getScore(), simulated, ticks > 0 ? static_cast<long>(ticks - 1) : 0};
+    }
+    return ReplayCheck{ReplayStatus::VALID, sim.getScore(), simulated, -1};
+}
+
+const char* ReplayVerifier::describe(ReplayStatus status)
+{
+    switch (status) {
+        case ReplayStatus::VALID: return "válido";
+        case ReplayStatus::HASH_MISMATCH: return "estado diverge do gravado";
+        case ReplayStatus::AFTER_DEATH: return "passos depois da colisão";
+        case ReplayStatus::SCORE_MISMATCH: return "pontuação não confere";
+        case ReplayStatus::UNREADABLE: return "arquivo inválido";
+    }
+    return "desconhecido";
+}
@@ -0,0 +1,102 @@
+/**
+ * @file RewindBuffer.cpp
+ * @brief Implementação do histórico de rewind com diferenças XOR.
+ */
+#include "sim/RewindBuffer.hpp"
+#include <cstring>
+
+namespace {
+    /// Lê o bloco i de um estado (o último bloco pode ser incompleto).
+    uint32_t loadWord(const uint8_t* base, size_t i)
+    {
+        uint32_t word = 0;
+        size_t offset = i * 4;
+        size_t n = sizeof(FixedSimState) - offset < 4 ? sizeof(FixedSimState) - offset : 4;
+        std::memcpy(&word, base + offset, n);
+        return word;
+    }
+
+    void xorWord(uint8_t* base, size_t i, uint32_t delta)
+    {
+        size_t offset = i * 4;
+        size_t n = sizeof(FixedSimState) - offset < 4 ? sizeof(FixedSimState) - offset : 4;
+        uint8_t d[4];
+        std::memcpy(d, &delta, 4);
+        for (size_t b = 0; b < n; ++b) base[offset + b] ^= d[b];
+    }
+}
+
+void RewindBuffer::clear()
+{
+    firstEntry = 0;
+    count = 0;
+    writePos = 0;
+    bytesUsed = 0;
+}
+
+void RewindBuffer::push(const FixedSimState& previous, const FixedSimState& current)
+{
+    // Codifica em um buffer local: máscara dos blocos alterados + os blocos (XOR).
+    uint8_t entry[MAX_ENTRY_BYTES];
+    std::memset(entry, 0, MASK_BYTES);
+    size_t size = MASK_BYTES;
+    const uint8_t* a = reinterpret_cast<const uint8_t*>(&previous);
+    const uint8_t* b = reinterpret_cast<const uint8_t*>(&current);
+    for (size_t i = 0; i < WORDS; ++i) {
+        uint32_t delta = loadWord(a, i) ^ loadWord(b, i);
+        if (delta != 0) {
+            entry[i / 8] |= static_cast<uint8_t>(1u << (i % 8));
+            std::memcpy(entry + size, &delta, 4);
+            size += 4;
+        }
+    }
+
+    while (count == MAX_TICKS || bytesUsed + size > BYTE_CAPACITY) {
+        dropOldest();
+    }
+
+    for (size_t k = 0; k < size; ++k) {
+        bytes[(writePos + k) % BYTE_CAPACITY] = entry[k];
+    }
+    writePos = (writePos + size) % BYTE_CAPACITY;
+    bytesUsed += size;
+    entrySizes[(firstEntry + count) % MAX_TICKS] = static_cast<uint16_t>(size);
+    ++count;
+}
+
+bool RewindBuffer::stepBack(FixedSimState& state)
+{
+    if (count == 0) return false;
+
+    // A diferença mais recente termina em writePos.
+    size_t last = (firstEntry + count - 1) % MAX_TICKS;
+    size_t size = entrySizes[last];
+    size_t start = (writePos + BYTE_CAPACITY - size) % BYTE_CAPACITY;
+    uint8_t entry[MAX_ENTRY_BYTES];
+    for (size_t k = 0; k < size; ++k) {
+        entry[k] = bytes[(start + k) % BYTE_CAPACITY];
+    }
+
+    uint8_t* base = reinterpret_cast<uint8_t*>(&state);
+    size_t pos = MASK_BYTES;
+    for (size_t i = 0; i < WORDS; ++i) {
+        if (entry[i / 8] & (1u << (i % 8))) {
+            uint32_t delta;
+            std::memcpy(&delta, entry + pos, 4);
+            xorWord(base, i, delta);
+            pos += 4;
+        }
+    }
+
+    writePos = start;
+    bytesUsed -= size;
+    --count;
+    return true;
+}
+
+void RewindBuffer::dropOldest()
+{
+    bytesUsed -= entrySizes[firstEntry];
+    firstEntry = (firstEntry + 1) % MAX_TICKS;
+    --count;
+}
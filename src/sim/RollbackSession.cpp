@@ -0,0 +1,84 @@
+/**
+ * @file RollbackSession.cpp
+ * @brief Implementação do netcode com predição e rollback.
+ */
+#include "sim/RollbackSession.hpp"
+#include <cstring>
+
+void RollbackSession::start(uint64_t seed, int localPlayer)
+{
+    sim.reset(seed);
+    std::memset(localInputs, 0, sizeof(localInputs));
+    std::memset(remoteInputs, 0, sizeof(remoteInputs));
+    std::memset(remoteKnown, 0, sizeof(remoteKnown));
+    this->localPlayer = localPlayer;
+    currentTick = 0;
+    remoteConfirmed = 0;
+    pendingRollback = NO_ROLLBACK;
+    rollbackCount = 0;
+    resimulatedTicks = 0;
+    lastRollback = 0;
+    maxRollback = 0;
+}
+
+bool RollbackSession::advance(bool localJump)
+{
+    rollback();
+    if (!canAdvance()) return false;
+
+    const uint32_t slot = currentTick % INPUT_WINDOW;
+    localInputs[slot] = localJump;
+    // Predição: sem pulo. Se a entrada real chegou antes do passo, ela é usada.
+    if (currentTick >= remoteConfirmed && !remoteKnown[slot]) remoteInputs[slot] = 0;
+    simulateTick(currentTick);
+    ++currentTick;
+    return true;
+}
+
+uint32_t RollbackSession::rollback()
+{
+    if (pendingRollback == NO_ROLLBACK) return 0;
+
+    // canAdvance() garante que o snapshot do passo errado ainda está no anel.
+    sim = snapshots[pendingRollback % SNAPSHOTS];
+    for (uint32_t tick = pendingRollback; tick < currentTick; ++tick) simulateTick(tick);
+
+    const uint32_t resimulated = currentTick - pendingRollback;
+    pendingRollback = NO_ROLLBACK;
+    ++rollbackCount;
+    resimulatedTicks += resimulated;
+    lastRollback = resimulated;
+    if (resimulated > maxRollback) maxRollback = resimulated;
+    return resimulated;
+}
+
+void RollbackSession::addRemoteInput(uint32_t tick, bool jump)
+{
+    // Já confirmada, ou tão à frente que ocuparia o lugar de uma entrada ainda necessária.
+    if (tick < remoteConfirmed || tick >= remoteConfirmed + INPUT_WINDOW) return;
+    const uint32_t slot = tick % INPUT_WINDOW;
+    if (remoteKnown[slot]) return;
+
+    remoteKnown[slot] = 1;
+    if (tick < currentTick && remoteInputs[slot] != static_cast<uint8_t>(jump)) {
+        if (pendingRollback == NO_ROLLBACK || tick < pendingRollback) pendingRollback = tick;
+    }
+    remoteInputs[slot] = jump;
+
+    // As flags só valem para passos ainda não confirmados; o valor fica para as re-simulações.
+    while (remoteKnown[remoteConfirmed % INPUT_WINDOW]) {
+        remoteKnown[remoteConfirmed % INPUT_WINDOW] = 0;
+        ++remoteConfirmed;
+    }
+}
+
+void RollbackSession::simulateTick(uint32_t tick)
+{
+    const uint32_t slot = tick % INPUT_WINDOW;
+    snapshots[tick % SNAPSHOTS] = sim;
+
+    bool jumps[VersusSimulation::PLAYERS];
+    jumps[localPlayer] = localInputs[slot] != 0;
+    jumps[1 - localPlayer] = remoteInputs[slot] != 0;
+    sim.step(jumps);
+}
@@ -0,0 +1,47 @@
+/**
+ * @file VersusSimulation.cpp
+ * @brief Implementação da partida de dois jogadores.
+ */
+#include "sim/VersusSimulation.hpp"
+#include "sim/StateHash.hpp"
+
+void VersusSimulation::reset(uint64_t seed)
+{
+    for (FixedGameSimulation& player : players) player.reset(seed);
+    tick = 0;
+}
+
+void VersusSimulation::step(const bool jumps[PLAYERS])
+{
+    for (int p = 0; p < PLAYERS; ++p) {
+        // No primeiro passo os dois pulam juntos, para que os percursos andem em sincronia.
+        players[p].step(tick == 0 || jumps[p]);
+    }
+    ++tick;
+}
+
+uint64_t VersusSimulation::hash() const
+{
+    StateHasher hasher;
+    hasher.add(tick);
+    for (const FixedGameSimulation& player : players) hasher.add(player.hash());
+    return hasher.digest();
+}
+
+bool VersusSimulation::isOver() const
+{
+    for (const FixedGameSimulation& player : players) {
+        if (player.getPhase() != SimPhase::DEAD) return false;
+    }
+    return true;
+}
+
+int VersusSimulation::getWinner() const
+{
+    if (!isOver()) return -1;
+    const FixedGameSimulation& a = players[0];
+    const FixedGameSimulation& b = players[1];
+    if (a.getScore() != b.getScore()) return a.getScore() > b.getScore() ? 0 : 1;
+    if (a.getTick() != b.getTick()) return a.getTick() > b.getTick() ? 0 : 1;
+    return -1;
+}
@@ -3,6 +3,7 @@
  * @brief Implementação da classe ScoreSystem.
  */
 #include "util/ScoreSystem.hpp"
+#include "sim/ReplayVerifier.hpp"
 #include <fstream>
 #include <sstream>
 #include <algorithm>
@@ -82,6 +83,15 @@ void ScoreSystem::registerOrUpdateScore(const std::string& name, int score) {
     saveData();
 }
 
+void ScoreSystem::registerVerifiedScore(const std::string& name, int score, const Replay& replay) {
+    ReplayCheck check = ReplayVerifier::check(replay, score);
+    if (!check.valid()) {
+        throw ScoreException("Replay não confirma a pontuação " + std::to_string(score) + ": " +
+                             ReplayVerifier::describe(check.status) + " (passo " + std::to_string(check.tick) + ")");
+    }
+    registerOrUpdateScore(name, score);
+}
+
 std::vector<std::pair<std::string, int>> ScoreSystem::getTopScores(int count) const {
     std::vector<std::pair<std::string, int>> scores;
     scores.reserve(scoreMap.size());
@@ -0,0 +1,51 @@
+/**
+ * @file Theme.cpp
+ * @brief Construção dos temas padrão do jogo.
+ */
+#include "util/Theme.hpp"
+#include "managers/ResourceManager.hpp"
+
+std::vector<Theme> buildDefaultThemes()
+{
+    ResourceManager &rm = ResourceManager::getInstance();
+    std::vector<Theme> themes;
+
+    // Adiciona os dados de cada tema, incluindo o caminho da música
+    themes.push_back({
+        "Amarelo",
+        {rm.getBitmap("yellowbird-downflap"), rm.getBitmap("yellowbird-midflap"), rm.getBitmap("yellowbird-upflap")},
+        rm.getBitmap("background-day"),
+        rm.getBitmap("base"),
+        rm.getBitmap("pipe-green"),
+        "8bitMusicTheme"
+    });
+
+    themes.push_back({
+        "Nerd",
+        {rm.getBitmap("nerd_0"), rm.getBitmap("nerd_1"), rm.getBitmap("nerd_2")},
+        rm.getBitmap("background-night"),
+        rm.getBitmap("nerd_base"),
+        rm.getBitmap("nerd_pipe"),
+        "starMusicTheme"
+    });
+
+    themes.push_back({
+        "Barbie",
+        {rm.getBitmap("barbielaco_0"), rm.getBitmap("barbielaco_1"), rm.getBitmap("barbielaco_2")},
+        rm.getBitmap("barbie_background"),
+        rm.getBitmap("barbie_base"),
+        rm.getBitmap("barbie_pipe"),
+        "barbie"
+    });
+
+    themes.push_back({
+        "Porco",
+        {rm.getBitmap("pig_0"), rm.getBitmap("pig_1"), rm.getBitmap("pig_2")},
+        rm.getBitmap("pig_background"),
+        rm.getBitmap("pig_base"),
+        rm.getBitmap("pig_pipe"),
+        "yoshi"
+    });
+
+    return themes;
+}
@@ -0,0 +1,112 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "core/LaunchOptions.hpp"
+#include <stdexcept>
+
+TEST_SUITE("LaunchOptions") {
+    TEST_CASE("sem argumentos o jogo abre no menu") {
+        const char* argv[] = {"flappy_bird"};
+        LaunchOptions options = LaunchOptions::parse(1, argv);
+        CHECK_FALSE(options.versus.enabled);
+    }
+
+    TEST_CASE("--versus com rede artificial") {
+        const char* argv[] = {"flappy_bird", "--versus", "1", "7001", "127.0.0.1:7000",
+                              "--seed", "42", "--latency", "80", "--jitter", "20.5", "--loss", "5"};
+        LaunchOptions options = LaunchOptions::parse(13, argv);
+        CHECK(options.versus.enabled);
+        CHECK(options.versus.player == 1);
+        CHECK(options.versus.localPort == 7001);
+        CHECK(options.versus.remoteHost == "127.0.0.1");
+        CHECK(options.versus.remotePort == 7000);
+        CHECK(options.versus.seed == 42);
+        CHECK(options.versus.latencyMs == doctest::Approx(80.0f));
+        CHECK(options.versus.jitterMs == doctest::Approx(20.5f));
+        CHECK(options.versus.lossPercent == doctest::Approx(5.0f));
+    }
+
+    TEST_CASE("--broadcast e --spectate guardam os endereços") {
+        const char* argv[] = {"flappy_bird", "--spectate", "192.168.0.10:7100", "--broadcast", "unix:/tmp/fb.sock"};
+        LaunchOptions options = LaunchOptions::parse(5, argv);
+        CHECK(options.spectate == "192.168.0.10:7100");
+        CHECK(options.broadcast == "unix:/tmp/fb.sock");
+
+        const char* both[] = {"flappy_bird", "--versus", "0", "7000", "localhost:7001", "--spectate", "localhost:7100"};
+        CHECK_THROWS_AS(LaunchOptions::parse(7, both), std::invalid_argument);
+    }
+
+    TEST_CASE("--bot com partidas sem janela") {
+        const char* argv[] = {"flappy_bird", "--bot", "./bin/bots/libExampleBot.so", "--headless", "1000",
+                              "--threads", "8", "--seed", "5"};
+        LaunchOptions options = LaunchOptions::parse(9, argv);
+        CHECK(options.bot.path == "./bin/bots/libExampleBot.so");
+        CHECK(options.bot.headlessGames == 1000);
+        CHECK(options.bot.threads == 8);
+        CHECK(options.versus.seed == 5);
+
+        const char* noBot[] = {"flappy_bird", "--headless", "10"};
+        CHECK_THROWS_AS(LaunchOptions::parse(3, noBot), std::invalid_argument);
+        const char* versusBot[] = {"flappy_bird", "--versus", "0", "7000", "localhost:7001", "--bot", "bot.so"};
+        CHECK_THROWS_AS(LaunchOptions::parse(7, versusBot), std::invalid_argument);
+    }
+
+    TEST_CASE("--sweep com partidas, limite e saida") {
+        const char* argv[] = {"flappy_bird", "--sweep", "grade.txt", "--sweep-games", "32",
+                              "--sweep-seconds", "30", "--sweep-out", "saida.csv", "--threads", "4"};
+        LaunchOptions options = LaunchOptions::parse(11, argv);
+        CHECK(options.sweep.gridPath == "grade.txt");
+        CHECK(options.sweep.games == 32);
+        CHECK(options.sweep.seconds == doctest::Approx(30.0f));
+        CHECK(options.sweep.outputPath == "saida.csv");
+        CHECK(options.bot.threads == 4);
+
+        const char* defaults[] = {"flappy_bird", "--sweep", "grade.txt", "--bot", "bot.so"};
+        options = LaunchOptions::parse(5, defaults);
+        CHECK(options.sweep.games == 64);
+        CHECK(options.sweep.outputPath == "sweep.csv");
+
+        const char* withHeadless[] = {"flappy_bird", "--sweep", "grade.txt", "--bot", "bot.so", "--headless", "10"};
+        CHECK_THROWS_AS(LaunchOptions::parse(7, withHeadless), std::invalid_argument);
+        const char* zeroSeconds[] = {"flappy_bird", "--sweep", "grade.txt", "--sweep-seconds", "0"};
+        CHECK_THROWS_AS(LaunchOptions::parse(5, zeroSeconds), std::invalid_argument);
+    }
+
+    TEST_CASE("--software desenha em memória") {
+        const char* argv[] = {"flappy_bird", "--software"};
+        CHECK(LaunchOptions::parse(2, argv).software);
+        const char* none[] = {"flappy_bird"};
+        CHECK_FALSE(LaunchOptions::parse(1, none).software);
+    }
+
+    TEST_CASE("--capture guarda o arquivo da gravação") {
+        const char* argv[] = {"flappy_bird", "--capture", "sessao.y4m"};
+        CHECK(LaunchOptions::parse(3, argv).capture == "sessao.y4m");
+        const char* missing[] = {"flappy_bird", "--capture"};
+        CHECK_THROWS_AS(LaunchOptions::parse(2, missing), std::invalid_argument);
+    }
+
+    TEST_CASE("--verify aceita varios caminhos") {
+        const char* argv[] = {"flappy_bird", "--verify", "replays/best", "--verify", "last.replay", "--threads", "2"};
+        LaunchOptions options = LaunchOptions::parse(7, argv);
+        REQUIRE(options.verify.size() == 2);
+        CHECK(options.verify[0] == "replays/best");
+        CHECK(options.verify[1] == "last.replay");
+        CHECK(options.bot.threads == 2);
+
+        const char* withBot[] = {"flappy_bird", "--verify", "a.replay", "--bot", "bot.so"};
+        CHECK_THROWS_AS(LaunchOptions::parse(5, withBot), std::invalid_argument);
+    }
+
+    TEST_CASE("argumentos inválidos lançam exceção") {
+        const char* unknown[] = {"flappy_bird", "--fast"};
+        CHECK_THROWS_AS(LaunchOptions::parse(2, unknown), std::invalid_argument);
+        const char* missing[] = {"flappy_bird", "--versus", "0", "7000"};
+        CHECK_THROWS_AS(LaunchOptions::parse(4, missing), std::invalid_argument);
+        const char* badPlayer[] = {"flappy_bird", "--versus", "2", "7000", "localhost:7001"};
+        CHECK_THROWS_AS(LaunchOptions::parse(5, badPlayer), std::invalid_argument);
+        const char* badAddress[] = {"flappy_bird", "--versus", "0", "7000", "localhost"};
+        CHECK_THROWS_AS(LaunchOptions::parse(5, badAddress), std::invalid_argument);
+        const char* badLoss[] = {"flappy_bird", "--loss", "120"};
+        CHECK_THROWS_AS(LaunchOptions::parse(3, badLoss), std::invalid_argument);
+    }
+}
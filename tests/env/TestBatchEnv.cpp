@@ -0,0 +1,130 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "env/BatchEnv.hpp"
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+#include <cstring>
+#include <vector>
+
+namespace {
+    /// Pula quando o pássaro cai abaixo do centro do próximo vão, lendo só a observação.
+    uint8_t policy(const float* obs, float offset)
+    {
+        const float target = (obs[OBS_PIPE_GAP_TOP] + obs[OBS_PIPE_GAP_BOTTOM]) / 2.0f + offset / BUFFER_H;
+        return obs[OBS_BIRD_Y] > target && obs[OBS_BIRD_VEL_Y] > 0.0f;
+    }
+
+    /// Joga o lote por alguns passos e devolve todas as saídas concatenadas.
+    std::vector<float> play(unsigned threads, size_t envs, int ticks)
+    {
+        BatchEnv env(envs, threads);
+        std::vector<float> obs(envs * BatchEnv::OBS_SIZE), rewards(envs), trace;
+        std::vector<uint8_t> actions(envs), dones(envs);
+        env.reset(9, obs.data());
+        for (int t = 0; t < ticks; ++t) {
+            for (size_t i = 0; i < envs; ++i) actions[i] = policy(&obs[i * BatchEnv::OBS_SIZE], i % 7 * 10.0f);
+            env.step(actions.data(), obs.data(), rewards.data(), dones.data());
+            trace.insert(trace.end(), obs.begin(), obs.end());
+            trace.insert(trace.end(), rewards.begin(), rewards.end());
+            for (uint8_t d : dones) trace.push_back(d);
+        }
+        return trace;
+    }
+}
+
+TEST_SUITE("BatchEnv") {
+    TEST_CASE("reset escreve a observacao inicial de cada partida") {
+        BatchEnv env(4, 1);
+        std::vector<float> obs(4 * BatchEnv::OBS_SIZE, -9.0f);
+        env.reset(100, obs.data());
+        for (size_t i = 0; i < env.size(); ++i) {
+            CHECK(env.getEpisodeSeed(i) == 100 + i);
+            CHECK(env.getState(i).phase == SimPhase::PLAYING);
+            const float* o = &obs[i * BatchEnv::OBS_SIZE];
+            CHECK(o[OBS_BIRD_Y] == doctest::Approx(env.getState(i).birdY / BUFFER_H));
+            CHECK(o[OBS_BIRD_VEL_Y] < 0.0f);
+            CHECK(o[OBS_PIPE_DISTANCE] == 1.0f);
+        }
+    }
+
+    TEST_CASE("cada partida segue a GameSimulation com a mesma semente e os mesmos pulos") {
+        BatchEnv env(3, 1);
+        env.reset(5, nullptr);
+        GameSimulation reference;
+        reference.reset(6);
+        reference.step(true);
+
+        std::vector<uint8_t> actions(3);
+        for (int t = 0; t < 60; ++t) {
+            const uint8_t jump = t % 9 == 0;
+            actions[1] = jump;
+            env.step(actions.data(), nullptr, nullptr, nullptr);
+            reference.step(jump);
+            if (reference.getPhase() == SimPhase::DEAD) break;
+            CHECK(std::memcmp(&env.getState(1), &reference.getState(), sizeof(SimState)) == 0);
+        }
+    }
+
+    TEST_CASE("observacao aponta para o proximo cano e o seguinte") {
+        GameSimulation sim;
+        sim.reset(3);
+        sim.step(true);
+        float obs[BatchEnv::OBS_SIZE];
+        for (int t = 0; t < 80; ++t) {
+            BatchEnv::observe(sim.getState(), obs);
+            sim.step(policy(obs, 20.0f));
+        }
+        REQUIRE(sim.getPhase() == SimPhase::PLAYING);
+        REQUIRE(sim.getState().course.getCount() >= 2);
+
+        BatchEnv::observe(sim.getState(), obs);
+        const PipeCourse& course = sim.getState().course;
+        const int p = course.firstAhead(BIRD_START_X);
+        REQUIRE(p < course.getCount());
+        CHECK(obs[OBS_PIPE_DISTANCE] >= 0.0f);
+        CHECK(obs[OBS_PIPE_GAP_TOP] == doctest::Approx(course.getGapTop(p) / BUFFER_H));
+        CHECK(obs[OBS_NEXT_DISTANCE] > obs[OBS_PIPE_DISTANCE]);
+        CHECK(obs[OBS_NEXT_GAP_BOTTOM] - obs[OBS_NEXT_GAP_TOP] == doctest::Approx(PIPE_GAP / BUFFER_H));
+    }
+
+    TEST_CASE("partida que termina e reiniciada com a proxima semente") {
+        BatchEnv env(2, 1);
+        std::vector<float> obs(2 * BatchEnv::OBS_SIZE), rewards(2);
+        std::vector<uint8_t> dones(2);
+        env.reset(40, obs.data());
+
+        // Sem pulos o pássaro cai até o chão.
+        int ticks = 0;
+        do {
+            env.step(nullptr, obs.data(), rewards.data(), dones.data());
+            ++ticks;
+            if (!dones[0]) CHECK(rewards[0] == doctest::Approx(BatchEnv::REWARD_ALIVE));
+        } while (!dones[0] && ticks < 1000);
+
+        REQUIRE(dones[0] == 1);
+        CHECK(rewards[0] == doctest::Approx(BatchEnv::REWARD_DEATH));
+        CHECK(env.getEpisodeSeed(0) == 42);
+        CHECK(env.getEpisodeSeed(1) == 43);
+        CHECK(env.getState(0).phase == SimPhase::PLAYING);
+        CHECK(env.getState(0).tick == 1);
+        CHECK(obs[OBS_BIRD_VEL_Y] < 0.0f);
+    }
+
+    TEST_CASE("canos ultrapassados dao recompensa") {
+        BatchEnv env(1, 1);
+        std::vector<float> obs(BatchEnv::OBS_SIZE);
+        float reward = 0.0f, total = 0.0f;
+        uint8_t done = 0, action = 0;
+        env.reset(1, obs.data());
+        for (int t = 0; t < 400 && !done; ++t) {
+            action = policy(obs.data(), 20.0f);
+            env.step(&action, obs.data(), &reward, &done);
+            if (reward > BatchEnv::REWARD_ALIVE) total += reward - BatchEnv::REWARD_ALIVE;
+        }
+        CHECK(total >= BatchEnv::REWARD_PIPE);
+    }
+
+    TEST_CASE("resultado nao depende do numero de threads") {
+        CHECK(play(1, 37, 150) == play(4, 37, 150));
+    }
+}
@@ -0,0 +1,163 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "env/BotController.hpp"
+#include "env/BotRunner.hpp"
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+#include <stdexcept>
+
+namespace {
+    /// Instância do bot de teste: conta as chamadas e guarda o último ponteiro recebido.
+    struct TestBotState {
+        uint64_t seed;
+        int calls;
+        const flappy_observation_v1* lastObservation;
+    };
+
+    int created = 0;
+    int destroyed = 0;
+    TestBotState* lastCreated = nullptr;
+
+    void* createBot(uint64_t seed)
+    {
+        ++created;
+        lastCreated = new TestBotState{seed, 0, nullptr};
+        return lastCreated;
+    }
+
+    void destroyBot(void* instance)
+    {
+        ++destroyed;
+        delete static_cast<TestBotState*>(instance);
+    }
+
+    /// Pula quando o pássaro cai abaixo do centro do próximo vão (como o piloto automático dos testes).
+    int decideBot(void* instance, const flappy_observation_v1* obs)
+    {
+        auto* state = static_cast<TestBotState*>(instance);
+        ++state->calls;
+        state->lastObservation = obs;
+        float target = BUFFER_H / 2.0f;
+        if (obs->pipe_count > 0) target = obs->pipes[0].gap_top + PIPE_GAP / 2 + 20.0f;
+        return obs->phase == 0 || (obs->bird_y > target && obs->bird_vel_y > 0.0f);
+    }
+
+    const flappy_controller_v1 testBot = {
+        FLAPPY_CONTROLLER_ABI_VERSION, sizeof(flappy_controller_v1), "TestBot", createBot, destroyBot, decideBot
+    };
+
+    /// Bot sem estado que nunca pula.
+    int neverJump(void*, const flappy_observation_v1*) { return 0; }
+    const flappy_controller_v1 idleBot = {
+        FLAPPY_CONTROLLER_ABI_VERSION, sizeof(flappy_controller_v1), "IdleBot", nullptr, nullptr, neverJump
+    };
+}
+
+TEST_SUITE("BotController") {
+    TEST_CASE("observacao traz o passaro e os proximos canos em pixels") {
+        GameSimulation sim;
+        sim.reset(2);
+        TestBotState state{2, 0, nullptr};
+        for (int t = 0; t < 80; ++t) {
+            flappy_observation_v1 obs;
+            BotController::observe(sim.getState(), obs);
+            sim.step(decideBot(&state, &obs));
+        }
+        REQUIRE(sim.getPhase() == SimPhase::PLAYING);
+
+        flappy_observation_v1 obs;
+        BotController::observe(sim.getState(), obs);
+        const SimState& s = sim.getState();
+        CHECK(obs.tick == s.tick);
+        CHECK(obs.phase == 1);
+        CHECK(obs.bird_y == s.birdY);
+        CHECK(obs.bird_vel_y == s.birdVelY);
+        CHECK(obs.bird_x == BIRD_START_X);
+        CHECK(obs.floor_y == PLAYABLE_AREA_HEIGHT);
+        REQUIRE(obs.pipe_count >= 2);
+        CHECK(obs.pipes[0].x + PIPE_WIDTH >= BIRD_START_X);
+        CHECK(obs.pipes[1].x > obs.pipes[0].x);
+        CHECK(obs.pipes[0].gap_bottom - obs.pipes[0].gap_top == doctest::Approx(PIPE_GAP));
+    }
+
+    TEST_CASE("instancia e criada com a semente e destruida uma vez") {
+        created = destroyed = 0;
+        {
+            BotController bot(&testBot, 77);
+            GameSimulation sim;
+            sim.reset(77);
+            CHECK(bot.decide(sim.getState()));
+            REQUIRE(lastCreated);
+            CHECK(lastCreated->seed == 77);
+            CHECK(lastCreated->calls == 1);
+        }
+        CHECK(created == 1);
+        CHECK(destroyed == 1);
+    }
+
+    TEST_CASE("decide reaproveita a mesma observacao a cada passo") {
+        BotController bot(&testBot, 1);
+        GameSimulation sim;
+        sim.reset(1);
+        TestBotState* state = lastCreated;
+        sim.step(bot.decide(sim.getState()));
+        const flappy_observation_v1* first = state->lastObservation;
+        sim.step(bot.decide(sim.getState()));
+        CHECK(state->lastObservation == first);
+        CHECK(state->lastObservation->tick == 1);
+    }
+
+    TEST_CASE("tabelas invalidas sao rejeitadas") {
+        CHECK_THROWS_AS(BotLibrary::validate(nullptr), std::runtime_error);
+        flappy_controller_v1 wrongVersion = testBot;
+        wrongVersion.abi_version = 2;
+        CHECK_THROWS_AS(BotLibrary::validate(&wrongVersion), std::runtime_error);
+        flappy_controller_v1 noDecide = testBot;
+        noDecide.decide = nullptr;
+        CHECK_THROWS_AS(BotLibrary::validate(&noDecide), std::runtime_error);
+        CHECK_NOTHROW(BotLibrary::validate(&testBot));
+    }
+
+    TEST_CASE("biblioteca inexistente gera runtime_error") {
+        CHECK_THROWS_AS(BotLibrary("./nao_existe_bot.so"), std::runtime_error);
+    }
+}
+
+TEST_SUITE("BotRunner") {
+    TEST_CASE("partidas sem janela em paralelo dao o mesmo resultado que em serie") {
+        BotRunner serial(&testBot, 1);
+        BotRunner parallel(&testBot, 4);
+        auto a = serial.run(10, 12, 2000);
+        auto b = parallel.run(10, 12, 2000);
+        REQUIRE(a.size() == 12);
+        for (size_t i = 0; i < a.size(); ++i) {
+            CHECK(a[i].seed == 10 + i);
+            CHECK(a[i].score == b[i].score);
+            CHECK(a[i].ticks == b[i].ticks);
+            CHECK(a[i].died == b[i].died);
+        }
+    }
+
+    TEST_CASE("bot joga como a GameSimulation com os mesmos pulos") {
+        BotGameResult result = BotRunner::play(&testBot, 4, 100000);
+        GameSimulation sim;
+        sim.reset(4);
+        TestBotState state{4, 0, nullptr};
+        while (sim.getPhase() != SimPhase::DEAD && sim.getTick() < 100000) {
+            flappy_observation_v1 obs;
+            BotController::observe(sim.getState(), obs);
+            sim.step(decideBot(&state, &obs));
+        }
+        CHECK(result.score == sim.getScore());
+        CHECK(result.ticks == sim.getTick());
+        CHECK(result.score > 0);
+    }
+
+    TEST_CASE("limite de passos interrompe partidas e bots que nunca pulam") {
+        BotGameResult capped = BotRunner::play(&testBot, 4, 50);
+        CHECK(capped.ticks <= 50);
+        BotGameResult idle = BotRunner::play(&idleBot, 4, 50);
+        CHECK(idle.ticks == 0);
+        CHECK_FALSE(idle.died);
+    }
+}
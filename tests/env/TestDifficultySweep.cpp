@@ -0,0 +1,140 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "env/DifficultySweep.hpp"
+#include "sim/GameSimulation.hpp"
+#include "Constants.hpp"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    size_t countFields(const std::string& line)
+    {
+        return static_cast<size_t>(std::count(line.begin(), line.end(), ',')) + 1;
+    }
+}
+
+TEST_SUITE("DifficultySweep") {
+    TEST_CASE("grade em texto vira o produto cartesiano dos eixos") {
+        SweepGrid grid = SweepGrid::parse("# comentário\n"
+                                          "pipe_gap 120 180 4   # vão\n"
+                                          "\n"
+                                          "gravity 900 1100 3\n"
+                                          "pipe_speed 200\n");
+        REQUIRE(grid.size() == 12);
+
+        SimParams first = grid.at(0);
+        CHECK(first.pipeGap == doctest::Approx(120.0f));
+        CHECK(first.gravity == doctest::Approx(900.0f));
+        CHECK(first.pipeSpeed == doctest::Approx(200.0f));
+        CHECK(first.jumpVelocity == JUMP_IMPULSE_VELOCITY);
+
+        // O último eixo varia mais rápido.
+        CHECK(grid.at(1).gravity == doctest::Approx(1000.0f));
+        CHECK(grid.at(1).pipeGap == doctest::Approx(120.0f));
+        CHECK(grid.at(3).pipeGap == doctest::Approx(140.0f));
+        CHECK(grid.at(11).pipeGap == doctest::Approx(180.0f));
+        CHECK(grid.at(11).gravity == doctest::Approx(1100.0f));
+    }
+
+    TEST_CASE("grade vazia tem uma combinacao com os padroes") {
+        SweepGrid grid = SweepGrid::parse("");
+        REQUIRE(grid.size() == 1);
+        CHECK(grid.at(0).pipeGap == PIPE_GAP);
+        CHECK(grid.at(0).gravity == GRAVITY);
+    }
+
+    TEST_CASE("grades invalidas lancam excecao") {
+        CHECK_THROWS_AS(SweepGrid::parse("wind 10"), std::runtime_error);
+        CHECK_THROWS_AS(SweepGrid::parse("gravity 900 1100"), std::runtime_error);
+        CHECK_THROWS_AS(SweepGrid::parse("gravity 900 1100 2.5"), std::runtime_error);
+        CHECK_THROWS_AS(SweepGrid::parse("gravity abc"), std::runtime_error);
+        CHECK_THROWS_AS(SweepGrid::parse("gravity 900\ngravity 1000"), std::runtime_error);
+        CHECK_THROWS_AS(SweepGrid::parse("jump_velocity 300"), std::runtime_error);
+        CHECK_THROWS_AS(SweepGrid::parse("pipe_gap 500"), std::runtime_error);
+        CHECK_THROWS_AS(SweepGrid::load("nao_existe.grid"), std::runtime_error);
+
+        // Canos lentos e frequentes demais não cabem no PipeCourse.
+        DifficultySweep sweep(nullptr, 1);
+        CHECK_THROWS_AS(sweep.run(SweepGrid::parse("pipe_speed 20\npipe_interval 0.5"), 1, 1), std::runtime_error);
+    }
+
+    TEST_CASE("parametros padrao reproduzem a partida normal") {
+        GameSimulation normal;
+        GameSimulation tuned;
+        normal.reset(9);
+        tuned.setParams(SimParams());
+        tuned.reset(9);
+        for (int t = 0; t < 600 && normal.getPhase() != SimPhase::DEAD; ++t) {
+            bool jump = DifficultySweep::autopilot(normal.getState(), SimParams());
+            normal.step(jump);
+            tuned.step(jump);
+            REQUIRE(normal.hash() == tuned.hash());
+        }
+    }
+
+    TEST_CASE("vao maior e mais facil") {
+        DifficultySweep sweep(nullptr, 2);
+        SweepGrid grid = SweepGrid::parse("pipe_gap 110 190 4");
+        std::vector<SweepResult> results = sweep.run(grid, 1, 32, 60 * static_cast<uint32_t>(FPS));
+        REQUIRE(results.size() == 4);
+        CHECK(results.front().meanScore < results.back().meanScore);
+        CHECK(results.front().survival.back() < results.back().survival.back());
+        CHECK(results.back().survival.back() > 0.5f);
+    }
+
+    TEST_CASE("resumos sao consistentes e nao dependem do numero de threads") {
+        SweepGrid grid = SweepGrid::parse("pipe_gap 100 140 3\npipe_speed 150 210 3");
+        const uint32_t maxTicks = 20 * static_cast<uint32_t>(FPS);
+        DifficultySweep single(nullptr, 1);
+        DifficultySweep multi(nullptr, 3);
+        std::vector<SweepResult> a = single.run(grid, 5, 20, maxTicks);
+        std::vector<SweepResult> b = multi.run(grid, 5, 20, maxTicks);
+        REQUIRE(a.size() == 9);
+        REQUIRE(b.size() == 9);
+        for (size_t c = 0; c < a.size(); ++c) {
+            const SweepResult& r = a[c];
+            CHECK(r.games == 20);
+            CHECK(r.meanScore == b[c].meanScore);
+            CHECK(r.survival == b[c].survival);
+            CHECK(r.scoreHistogram == b[c].scoreHistogram);
+            CHECK(r.medianScore <= r.p90Score);
+            CHECK(r.p90Score <= r.maxScore);
+            uint32_t histogramGames = 0;
+            for (uint32_t n : r.scoreHistogram) histogramGames += n;
+            CHECK(histogramGames == 20);
+            for (int k = 1; k < SweepResult::SURVIVAL_POINTS; ++k) CHECK(r.survival[k] <= r.survival[k - 1]);
+        }
+    }
+
+    TEST_CASE("faixas do histograma") {
+        CHECK(SweepResult::bucketOf(0) == 0);
+        CHECK(SweepResult::bucketOf(1) == 1);
+        CHECK(SweepResult::bucketOf(3) == 2);
+        CHECK(SweepResult::bucketOf(4) == 3);
+        CHECK(SweepResult::bucketOf(1023) == 10);
+        CHECK(SweepResult::bucketOf(1 << 20) == SweepResult::SCORE_BUCKETS - 1);
+    }
+
+    TEST_CASE("CSV tem uma linha por combinacao com as mesmas colunas do cabecalho") {
+        DifficultySweep sweep(nullptr, 1);
+        std::vector<SweepResult> results = sweep.run(SweepGrid::parse("pipe_gap 120 150 2"), 1, 4, 300);
+        std::ostringstream out;
+        DifficultySweep::writeCsv(out, results);
+
+        std::istringstream lines(out.str());
+        std::string header;
+        std::string line;
+        REQUIRE(std::getline(lines, header));
+        CHECK(header.rfind("gravity,jump_velocity,", 0) == 0);
+        CHECK(header.find("alive_100pct") != std::string::npos);
+        CHECK(header.find("score_1024_plus") != std::string::npos);
+        int rows = 0;
+        while (std::getline(lines, line)) {
+            CHECK(countFields(line) == countFields(header));
+            ++rows;
+        }
+        CHECK(rows == 2);
+    }
+}
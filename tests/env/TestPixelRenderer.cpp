@@ -0,0 +1,167 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "env/PixelRenderer.hpp"
+#include "env/BatchEnv.hpp"
+#include "env/PngImage.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    SimState playTo(uint64_t seed, int ticks)
+    {
+        GameSimulation sim;
+        sim.reset(seed);
+        for (int t = 0; t < ticks; ++t) sim.step(autopilot(sim.getState()));
+        return sim.getState();
+    }
+
+    /// PNG 2x1 RGB sem compressão (bloco DEFLATE "stored"): um pixel vermelho e um azul.
+    std::vector<uint8_t> tinyPng()
+    {
+        return {137, 'P', 'N', 'G', 13, 10, 26, 10,
+                0, 0, 0, 13, 'I', 'H', 'D', 'R', 0, 0, 0, 2, 0, 0, 0, 1, 8, 2, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 18, 'I', 'D', 'A', 'T', 0x78, 0x01, 1, 7, 0, 0xF8, 0xFF, 0, 255, 0, 0, 0, 0, 255, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 'I', 'E', 'N', 'D', 0, 0, 0, 0};
+    }
+
+    const SpriteAtlas& atlas()
+    {
+        static SpriteAtlas instance;
+        return instance;
+    }
+
+    const PixelRenderer& renderer()
+    {
+        static PixelRenderer instance(atlas());
+        return instance;
+    }
+
+    const RgbPixel& pixelAt(const std::vector<uint8_t>& frame, int x, int y)
+    {
+        return reinterpret_cast<const RgbPixel*>(frame.data())[y * BUFFER_W + x];
+    }
+}
+
+TEST_SUITE("PngImage") {
+    TEST_CASE("decodifica um PNG RGB sem compressao") {
+        RgbaImage image = decodePng(tinyPng());
+        REQUIRE(image.width == 2);
+        REQUIRE(image.height == 1);
+        CHECK(image.at(0, 0)[0] == 255);
+        CHECK(image.at(0, 0)[2] == 0);
+        CHECK(image.at(1, 0)[2] == 255);
+        CHECK(image.at(1, 0)[3] == 255);
+    }
+
+    TEST_CASE("arquivos invalidos lancam runtime_error") {
+        std::vector<uint8_t> broken = tinyPng();
+        broken[1] = 'X';
+        CHECK_THROWS_AS(decodePng(broken), std::runtime_error);
+        std::vector<uint8_t> truncated = tinyPng();
+        truncated.resize(50);
+        CHECK_THROWS_AS(decodePng(truncated), std::runtime_error);
+        CHECK_THROWS_AS(loadPng("nao_existe.png"), std::runtime_error);
+    }
+}
+
+TEST_SUITE("PixelRenderer") {
+    TEST_CASE("atlas carrega os sprites do JSON do jogo") {
+        RgbaImage pipe = atlas().getSprite("pipe-green");
+        CHECK(pipe.width == 52);
+        CHECK(pipe.height == 320);
+        CHECK(atlas().contains("background-day"));
+        CHECK_THROWS_AS(atlas().getSprite("nao-existe"), std::runtime_error);
+    }
+
+    TEST_CASE("quadro RGB tem fundo, canos e chao nas posicoes da simulacao") {
+        SimState state = playTo(1, 80);
+        REQUIRE(state.phase == SimPhase::PLAYING);
+        REQUIRE(state.course.getCount() > 0);
+        std::vector<uint8_t> frame(PixelRenderer::frameBytes(PixelFormat::RGB));
+        renderer().render(state, PixelFormat::RGB, frame.data());
+
+        // O meio de um cano, acima do vão e abaixo dele, tem os pixels do sprite do cano.
+        RgbaImage pipe = atlas().getSprite("pipe-green");
+        const int p = 0;
+        const int x = static_cast<int>(state.course.getX(p) + PIPE_WIDTH / 2);
+        const int below = static_cast<int>(state.course.getGapBottom(p)) + 40;
+        REQUIRE(x < BUFFER_W);
+        const int column = x - static_cast<int>(std::lround(state.course.getX(p)));
+        const int row = below - static_cast<int>(std::lround(state.course.getGapBottom(p)));
+        CHECK(pixelAt(frame, x, below).g == pipe.at(column, row)[1]);
+
+        // O chão cobre as últimas linhas, rolando na velocidade do Floor.
+        RgbaImage floor = atlas().getSprite("base");
+        const int floorX = static_cast<int>(std::fmod(state.tick * GameSimulation::TICK * (BACKGROUND_SCROLL_SPEED + 60.0f), BUFFER_W));
+        CHECK(pixelAt(frame, 0, BUFFER_H - 1).r == floor.at(floorX, FLOOR_HEIGHT - 1)[0]);
+        CHECK(pixelAt(frame, 0, BUFFER_H - 1).g == floor.at(floorX, FLOOR_HEIGHT - 1)[1]);
+    }
+
+    TEST_CASE("passaro aparece na posicao simulada") {
+        SimState state = playTo(3, 20);
+        std::vector<uint8_t> withBird(PixelRenderer::frameBytes(PixelFormat::RGB));
+        renderer().render(state, PixelFormat::RGB, withBird.data());
+        SimState moved = state;
+        moved.birdY -= 100.0f;
+        std::vector<uint8_t> elsewhere(withBird.size());
+        renderer().render(moved, PixelFormat::RGB, elsewhere.data());
+
+        const int cx = BIRD_START_X + BIRD_WIDTH / 2;
+        const int cy = static_cast<int>(state.birdY) + BIRD_HEIGHT / 2;
+        CHECK(std::memcmp(&pixelAt(withBird, cx, cy), &pixelAt(elsewhere, cx, cy), 3) != 0);
+        CHECK(std::memcmp(&pixelAt(withBird, cx, cy - 100), &pixelAt(elsewhere, cx, cy - 100), 3) != 0);
+    }
+
+    TEST_CASE("84x84 em cinza acompanha a media dos blocos da imagem cheia") {
+        SimState state = playTo(1, 80);
+        std::vector<uint8_t> rgb(PixelRenderer::frameBytes(PixelFormat::RGB));
+        std::vector<uint8_t> gray(PixelRenderer::frameBytes(PixelFormat::GRAY_84));
+        CHECK(gray.size() == 84u * 84u);
+        renderer().render(state, PixelFormat::RGB, rgb.data());
+        renderer().render(state, PixelFormat::GRAY_84, gray.data());
+
+        // Compara com a luminância média de cada bloco calculada a partir do quadro RGB. O cinza é
+        // montado na metade da resolução: um pixel reduzido na divisa de dois blocos leva uma coluna
+        // (ou linha) de cada lado, então perto de uma borda o bloco erra até metade do contraste de
+        // uma em três colunas (e de uma em seis linhas). Longe das bordas os blocos são exatos.
+        int worst = 0, total = 0;
+        for (int gy = 0; gy < 84; ++gy) {
+            for (int gx = 0; gx < 84; ++gx) {
+                int sum = 0, n = 0;
+                for (int y = gy * BUFFER_H / 84; y < (gy + 1) * BUFFER_H / 84; ++y) {
+                    for (int x = gx * BUFFER_W / 84; x < (gx + 1) * BUFFER_W / 84; ++x, ++n) {
+                        const RgbPixel& p = pixelAt(rgb, x, y);
+                        sum += (77 * p.r + 150 * p.g + 29 * p.b) >> 8;
+                    }
+                }
+                const int error = std::abs(gray[gy * 84 + gx] - (sum + n / 2) / n);
+                worst = std::max(worst, error);
+                total += error;
+            }
+        }
+        CHECK(worst <= 64);
+        CHECK(total < 84 * 84);
+    }
+
+    TEST_CASE("lote desenha cada partida no seu quadro") {
+        BatchEnv env(5, 2);
+        env.reset(11, nullptr);
+        std::vector<uint8_t> actions(5);
+        for (int t = 0; t < 30; ++t) {
+            for (size_t i = 0; i < env.size(); ++i) actions[i] = autopilot(env.getState(i));
+            env.step(actions.data(), nullptr, nullptr, nullptr);
+        }
+        const size_t bytes = PixelRenderer::frameBytes(PixelFormat::GRAY_84);
+        std::vector<uint8_t> frames(env.size() * bytes), single(bytes);
+        env.render(renderer(), PixelFormat::GRAY_84, frames.data());
+        for (size_t i = 0; i < env.size(); ++i) {
+            renderer().render(env.getState(i), PixelFormat::GRAY_84, single.data());
+            CHECK(std::memcmp(&frames[i * bytes], single.data(), bytes) == 0);
+        }
+    }
+}
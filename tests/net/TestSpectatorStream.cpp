@@ -0,0 +1,122 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "net/SpectatorStream.hpp"
+#include "net/SpectatorBroadcast.hpp"
+#include "net/StreamSocket.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+    /// Estados publicados por uma sessão com morte, save state e nova partida.
+    std::vector<SpectatorState> session()
+    {
+        std::vector<SpectatorState> states;
+        FixedGameSimulation sim;
+        sim.reset(1);
+        states.push_back(SpectatorState::from(sim.getState()));
+        FixedSimState checkpoint;
+        for (int t = 0; t < 600; ++t) {
+            if (t == 200) sim.save(checkpoint);
+            sim.step(autopilot(sim.getState()));
+            states.push_back(SpectatorState::from(sim.getState()));
+        }
+        sim.restore(checkpoint); // Volta no tempo: o fluxo precisa de um quadro-chave.
+        states.push_back(SpectatorState::from(sim.getState()));
+        for (int t = 0; t < 300; ++t) {
+            sim.step(t % 7 == 0);
+            states.push_back(SpectatorState::from(sim.getState()));
+        }
+        sim.reset(9); // Nova partida.
+        states.push_back(SpectatorState::from(sim.getState()));
+        for (int t = 0; t < 100 && sim.getPhase() != SimPhase::DEAD; ++t) {
+            sim.step(autopilot(sim.getState()));
+            states.push_back(SpectatorState::from(sim.getState()));
+        }
+        return states;
+    }
+}
+
+TEST_SUITE("SpectatorStream") {
+    TEST_CASE("o espectador reconstrói cada estado, mesmo recebendo um byte por vez") {
+        std::vector<SpectatorState> states = session();
+        SpectatorEncoder encoder;
+        SpectatorDecoder decoder;
+        std::vector<uint8_t> bytes;
+        size_t decoded = 0;
+        for (const SpectatorState& state : states) {
+            bytes.clear();
+            if (encoder.encode(state, bytes) == 0) continue;
+            for (uint8_t b : bytes) REQUIRE(decoder.feed(&b, 1));
+            SpectatorState received;
+            REQUIRE(decoder.pop(received));
+            CHECK(received == state);
+            ++decoded;
+        }
+        CHECK(decoded > 500);
+        CHECK(decoder.pending() == 0);
+    }
+
+    TEST_CASE("poucas centenas de bytes por segundo") {
+        std::vector<SpectatorState> states = session();
+        SpectatorEncoder encoder;
+        std::vector<uint8_t> bytes;
+        for (const SpectatorState& state : states) encoder.encode(state, bytes);
+        const double seconds = states.size() / FPS;
+        const double bytesPerSecond = bytes.size() / seconds;
+        MESSAGE("bytes por segundo: " << bytesPerSecond);
+        CHECK(bytesPerSecond < 150.0);
+    }
+
+    TEST_CASE("um fluxo inválido é recusado") {
+        SpectatorDecoder decoder;
+        const uint8_t delta[] = {0x80, 0x00, 0x00}; // Diferença sem quadro-chave antes.
+        CHECK_FALSE(decoder.feed(delta, sizeof(delta)));
+        CHECK(decoder.isCorrupt());
+    }
+}
+
+TEST_SUITE("SpectatorBroadcast") {
+    TEST_CASE("espectadores que entram antes e durante a partida terminam no mesmo estado") {
+        const std::string address = "unix:/tmp/flappy_test_" + std::to_string(getpid()) + ".sock";
+        SpectatorBroadcast& broadcast = SpectatorBroadcast::getInstance();
+        broadcast.start(address);
+
+        auto early = std::make_unique<StreamClient>(address);
+        std::unique_ptr<StreamClient> late;
+        SpectatorDecoder earlyDecoder, lateDecoder;
+        uint8_t buffer[4096];
+        auto drain = [&](StreamClient& client, SpectatorDecoder& decoder) {
+            while (size_t n = client.receive(buffer, sizeof(buffer))) REQUIRE(decoder.feed(buffer, n));
+        };
+
+        FixedGameSimulation sim;
+        sim.reset(1);
+        for (int t = 0; t < 400; ++t) {
+            if (t == 150) late = std::make_unique<StreamClient>(address);
+            sim.step(autopilot(sim.getState()));
+            broadcast.publish(sim.getState());
+            broadcast.poll();
+            drain(*early, earlyDecoder);
+            if (late) drain(*late, lateDecoder);
+        }
+        for (int f = 0; f < SpectatorBroadcast::FLUSH_FRAMES; ++f) broadcast.poll();
+        drain(*early, earlyDecoder);
+        drain(*late, lateDecoder);
+        CHECK(broadcast.getSpectatorCount() == 2);
+
+        const SpectatorState expected = SpectatorState::from(sim.getState());
+        SpectatorState last;
+        earlyDecoder.trim(1);
+        REQUIRE(earlyDecoder.pop(last));
+        CHECK(last == expected);
+        lateDecoder.trim(1);
+        REQUIRE(lateDecoder.pop(last));
+        CHECK(last == expected);
+        broadcast.stop();
+    }
+}
@@ -0,0 +1,131 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "net/LatencyInjector.hpp"
+#include "net/VersusPacket.hpp"
+#include "sim/RollbackSession.hpp"
+#include "Constants.hpp"
+#include <memory>
+#include <vector>
+
+namespace {
+    /// Pulos de um jogador que pula a cada 'period' passos.
+    bool periodicJump(uint32_t tick, uint32_t period, uint32_t phase)
+    {
+        return tick % period == phase;
+    }
+
+    /// Um dos dois jogadores: sessão, link de saída e o ack recebido do outro.
+    struct Peer {
+        RollbackSession session;
+        LatencyInjector outgoing;
+        uint32_t peerAck = 0;
+
+        Peer(float latencyMs, float jitterMs, float lossPercent, uint64_t seed)
+            : outgoing(latencyMs, jitterMs, lossPercent, seed) {}
+    };
+
+    /// Entrega ao destino os pacotes que já chegaram e envia as entradas locais.
+    void exchange(Peer& from, Peer& to, double now)
+    {
+        uint8_t bytes[LatencyInjector::MAX_PACKET];
+        while (size_t size = from.outgoing.pop(now, bytes)) {
+            VersusPacket packet;
+            REQUIRE(VersusPacket::decode(bytes, size, packet));
+            uint32_t ack = applyInputPacket(to.session, packet);
+            if (ack > to.peerAck) to.peerAck = ack;
+        }
+    }
+
+    void send(Peer& peer, double now)
+    {
+        uint8_t bytes[VersusPacket::SIZE];
+        buildInputPacket(peer.session, peer.peerAck).encode(bytes);
+        peer.outgoing.push(bytes, sizeof(bytes), now);
+    }
+}
+
+TEST_SUITE("LatencyInjector") {
+    TEST_CASE("entrega cada pacote depois da latência") {
+        LatencyInjector link(100.0f);
+        const uint8_t data[3] = {1, 2, 3};
+        REQUIRE(link.push(data, sizeof(data), 0.0));
+        uint8_t out[LatencyInjector::MAX_PACKET];
+        CHECK(link.pop(0.099, out) == 0);
+        REQUIRE(link.pop(0.101, out) == 3);
+        CHECK(out[2] == 3);
+        CHECK(link.getInFlight() == 0);
+    }
+
+    TEST_CASE("com jitter os atrasos variam dentro do intervalo e a perda descarta a fração pedida") {
+        LatencyInjector link(50.0f, 20.0f, 25.0f, 9);
+        const uint8_t data[1] = {0};
+        int sent = 0;
+        for (int i = 0; i < 200; ++i) sent += link.push(data, 1, 0.0);
+        CHECK(sent > 130);
+        CHECK(sent < 170);
+        uint8_t out[LatencyInjector::MAX_PACKET];
+        CHECK(link.pop(0.0299, out) == 0);
+        int delivered = 0;
+        while (link.pop(0.0701, out)) ++delivered;
+        CHECK(delivered == sent);
+    }
+}
+
+TEST_SUITE("VersusPacket") {
+    TEST_CASE("codifica e decodifica") {
+        VersusPacket packet{123456, 654321, 0xA5A5F00Fu, 32};
+        uint8_t bytes[VersusPacket::SIZE];
+        packet.encode(bytes);
+        VersusPacket decoded;
+        REQUIRE(VersusPacket::decode(bytes, sizeof(bytes), decoded));
+        CHECK(decoded.firstTick == packet.firstTick);
+        CHECK(decoded.ack == packet.ack);
+        CHECK(decoded.jumps == packet.jumps);
+        CHECK(decoded.count == packet.count);
+
+        bytes[0] ^= 1;
+        CHECK_FALSE(VersusPacket::decode(bytes, sizeof(bytes), decoded));
+        CHECK_FALSE(VersusPacket::decode(bytes, sizeof(bytes) - 1, decoded));
+    }
+
+    TEST_CASE("dois jogadores com latência, jitter e perda chegam ao mesmo estado") {
+        const uint64_t seed = 11;
+        auto a = std::make_unique<Peer>(80.0f, 30.0f, 10.0f, 1);
+        auto b = std::make_unique<Peer>(80.0f, 30.0f, 10.0f, 2);
+        a->session.start(seed, 0);
+        b->session.start(seed, 1);
+
+        // Os dois quadros rodam a 60 Hz; cada lado simula um passo por quadro quando pode.
+        const int frames = 900;
+        int stalls = 0;
+        for (int f = 0; f < frames; ++f) {
+            const double now = f / 60.0;
+            exchange(*a, *b, now);
+            exchange(*b, *a, now);
+            if (!a->session.advance(periodicJump(a->session.getTick(), 9, 0))) ++stalls;
+            if (!b->session.advance(periodicJump(b->session.getTick(), 11, 3))) ++stalls;
+            send(*a, now);
+            send(*b, now);
+        }
+        // Deixa a rede esvaziar sem simular mais passos.
+        for (int f = frames; f < frames + 60; ++f) {
+            const double now = f / 60.0;
+            exchange(*a, *b, now);
+            exchange(*b, *a, now);
+            send(*a, now);
+            send(*b, now);
+        }
+        a->session.rollback();
+        b->session.rollback();
+
+        const uint32_t ticks = a->session.getTick() < b->session.getTick() ? a->session.getTick() : b->session.getTick();
+        REQUIRE(ticks > 300);
+        REQUIRE(a->session.getTick() == b->session.getTick());
+        REQUIRE(a->session.isConfirmed());
+        REQUIRE(b->session.isConfirmed());
+        CHECK(a->session.getSimulation().hash() == b->session.getSimulation().hash());
+        CHECK(a->session.getRollbackCount() > 0);
+        CHECK(a->session.getMaxRollback() <= RollbackSession::MAX_PREDICTION);
+        MESSAGE("passos: " << ticks << ", esperas: " << stalls << ", rollbacks: " << a->session.getRollbackCount());
+    }
+}
@@ -0,0 +1,107 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "render/FrameCapture.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Arquivo temporário apagado no fim do teste.
+struct TempFile {
+    std::string path;
+    explicit TempFile(const std::string& name) : path("/tmp/" + name) {}
+    ~TempFile() { std::remove(path.c_str()); }
+
+    std::string read() const
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+};
+
+/// Quadro 4x2 em ARGB_8888: metade de cima branca, metade de baixo vermelha.
+std::vector<uint32_t> makeFrame()
+{
+    return {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu,
+            0xFFFF0000u, 0xFFFF0000u, 0xFFFF0000u, 0xFFFF0000u};
+}
+
+PixelLayout argb()
+{
+    PixelLayout layout;
+    REQUIRE(PixelLayout::of(ALLEGRO_PIXEL_FORMAT_ARGB_8888, layout));
+    return layout;
+}
+
+} // namespace
+
+TEST_CASE("o formato vem da extensão do arquivo") {
+    CHECK(FrameCapture::formatFor("sessao.y4m") == CaptureFormat::Y4M);
+    CHECK(FrameCapture::formatFor("sessao.rgba") == CaptureFormat::RGBA);
+    CHECK(FrameCapture::formatFor("y4m") == CaptureFormat::RGBA);
+    CHECK_THROWS_AS(FrameCapture("/pasta/que/nao/existe/sessao.y4m", 4, 2, 30), std::runtime_error);
+}
+
+TEST_CASE("a conversão para YUV 4:2:0 usa BT.601 de faixa completa") {
+    const std::vector<uint32_t> frame = makeFrame();
+    uint8_t yuv[4 * 2 + 2 * 2 * 1];
+    FrameCapture::toYuv420(reinterpret_cast<const uint8_t*>(frame.data()), 16, argb(), 4, 2, yuv);
+    CHECK(yuv[0] == 255); // Branco.
+    CHECK(yuv[4] == 77);  // Vermelho.
+    // Cada bloco 2x2 mistura branco e vermelho: (255, 127, 127) em média.
+    CHECK(yuv[8] == 107);
+    CHECK(yuv[9] == 107);
+    CHECK(yuv[10] == 192);
+    CHECK(yuv[11] == 192);
+}
+
+TEST_CASE("os quadros são gravados em Y4M pela thread escritora") {
+    TempFile file("TestFrameCapture.y4m");
+    const std::vector<uint32_t> frame = makeFrame();
+    FrameCapture capture(file.path, 4, 2, 30);
+    int submitted = 0;
+    for (int i = 0; i < 20; ++i) {
+        capture.submit(reinterpret_cast<const uint8_t*>(frame.data()), 16, argb());
+        ++submitted;
+    }
+    capture.stop();
+
+    const CaptureStats stats = capture.getStats();
+    // Nenhum quadro some: ou é gravado, ou é contado como descartado.
+    CHECK(stats.captured + stats.dropped == static_cast<uint64_t>(submitted));
+    CHECK(stats.written == stats.captured);
+    CHECK(stats.queueDepth == 0);
+    CHECK(stats.maxQueueDepth <= FrameCapture::POOL_SIZE);
+    CHECK(stats.maxCaptureMs < 1.0);
+    // Depois de stop(), os quadros são descartados.
+    CHECK_FALSE(capture.submit(reinterpret_cast<const uint8_t*>(frame.data()), 16, argb()));
+
+    const std::string header = "YUV4MPEG2 W4 H2 F30:1 Ip A1:1 C420jpeg\n";
+    const std::string data = file.read();
+    const size_t frameSize = std::string("FRAME\n").size() + 4 * 2 + 2 * 2 * 1;
+    REQUIRE(data.compare(0, header.size(), header) == 0);
+    CHECK(data.size() == header.size() + stats.written * frameSize);
+    CHECK(data.compare(header.size(), 6, "FRAME\n") == 0);
+}
+
+TEST_CASE("em RGBA cru os canais saem na ordem R, G, B, A") {
+    TempFile file("TestFrameCapture.rgba");
+    const std::vector<uint32_t> frame = makeFrame();
+    {
+        FrameCapture capture(file.path, 4, 2, 30);
+        REQUIRE(capture.submit(reinterpret_cast<const uint8_t*>(frame.data()), 16, argb()));
+    } // O destrutor grava o que está na fila.
+
+    const std::string data = file.read();
+    REQUIRE(data.size() == 4 * 2 * 4);
+    CHECK(static_cast<uint8_t>(data[0]) == 255);
+    const std::string red = data.substr(16, 4);
+    CHECK(static_cast<uint8_t>(red[0]) == 255);
+    CHECK(static_cast<uint8_t>(red[1]) == 0);
+    CHECK(static_cast<uint8_t>(red[2]) == 0);
+    CHECK(static_cast<uint8_t>(red[3]) == 255);
+}
@@ -0,0 +1,257 @@
+// Quadros de referência: cada cena é desenhada num bitmap de memória, sem display, com o
+// AllegroRenderer e com o SoftwareRenderer, e comparada com tests/golden/<quadro>.png.
+// Rode da raiz do projeto (make golden). As referências são gravadas com GOLDEN_UPDATE=1
+// (make golden_update) numa máquina com Allegro e versionadas; sem a referência, o quadro
+// vai para bin/golden e o caso só falha com GOLDEN_REQUIRE=1. Os tempos de desenho
+// vão para bin/golden/tempos.csv; com GOLDEN_BUDGET=1 o do SoftwareRenderer precisa
+// caber num quadro (fora disso é só um aviso, para não depender da máquina).
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "actors/ui/GameOverScreen.hpp"
+#include "managers/ResourceManager.hpp"
+#include "managers/SceneManager.hpp"
+#include "managers/ScoreManager.hpp"
+#include "render/LayerCache.hpp"
+#include "render/RenderQueue.hpp"
+#include "render/SoftwareRenderer.hpp"
+#include "scenes/CharacterSelectionScene.hpp"
+#include "scenes/GameScene.hpp"
+#include "scenes/RankingScene.hpp"
+#include "scenes/StartMenu.hpp"
+#include "sim/GameSimulation.hpp"
+#include "util/Theme.hpp"
+#include "Constants.hpp"
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+#include <allegro5/allegro_image.h>
+#include <allegro5/allegro_primitives.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+const std::string GOLDEN_DIR = "tests/golden";
+const std::string OUTPUT_DIR = "bin/golden";
+constexpr int CHANNEL_TOLERANCE = 8;       ///< Diferença por canal aceita (arredondamentos de outra versão do Allegro).
+constexpr double REFERENCE_TOLERANCE = 0.001; ///< Fração dos pixels que pode passar de CHANNEL_TOLERANCE.
+constexpr double SOFTWARE_TOLERANCE = 0.005;  ///< Com o SoftwareRenderer, o pássaro girado em passos de 2° muda alguns pixels.
+constexpr int TIMED_FRAMES = 30;
+constexpr double FRAME_BUDGET_MS = 1000.0 / FPS; ///< Um quadro inteiro na taxa do jogo, num núcleo.
+
+/// Allegro sem display, com os atlas carregados em bitmaps de memória e uma fila para as GUIs.
+struct GoldenEnv {
+    SceneManager sceneManager;
+    ALLEGRO_EVENT_QUEUE* queue = nullptr;
+    std::vector<Theme> themes;
+
+    GoldenEnv()
+    {
+        REQUIRE(al_init());
+        REQUIRE(al_init_image_addon());
+        REQUIRE(al_init_font_addon());
+        REQUIRE(al_init_primitives_addon());
+        al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+        ResourceManager& rm = ResourceManager::getInstance();
+        rm.loadAtlasJson("assets/sprites/sprite_sheet.json", "atlas", "assets/sprites/sprite_sheet.png");
+        rm.loadAtlasJson("assets/sprites/sprite_sheet_ui.json", "atlasUI", "assets/sprites/sprite_sheet_ui.png");
+        queue = al_create_event_queue();
+        sceneManager.setEventQueue(queue);
+        themes = buildDefaultThemes();
+        std::filesystem::create_directories(OUTPUT_DIR);
+    }
+};
+
+GoldenEnv& env()
+{
+    static GoldenEnv instance;
+    return instance;
+}
+
+/**
+ * @brief A GameScene do jogo numa semente fixa, depois de ticks passos com o piloto automático (tecla A).
+ * @details O GoldenEnv não instala o áudio, então o GameSound fica mudo; a GUI usa a fila do GoldenEnv.
+ */
+std::unique_ptr<GameScene> playGame(const Theme& theme, uint64_t seed, int ticks)
+{
+    auto game = std::make_unique<GameScene>(&env().sceneManager, theme);
+    game->restart(seed);
+    ALLEGRO_EVENT key = {};
+    key.type = ALLEGRO_EVENT_KEY_DOWN;
+    key.keyboard.keycode = ALLEGRO_KEY_A;
+    game->processEvent(key);
+    for (int tick = 0; tick < ticks; ++tick) game->update(FixedGameSimulation::TICK);
+    return game;
+}
+
+/// Quantos pixels passam da tolerância por canal.
+int countDifferences(ALLEGRO_BITMAP* a, ALLEGRO_BITMAP* b)
+{
+    const int width = al_get_bitmap_width(a), height = al_get_bitmap_height(a);
+    ALLEGRO_LOCKED_REGION* ra = al_lock_bitmap(a, ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE, ALLEGRO_LOCK_READONLY);
+    ALLEGRO_LOCKED_REGION* rb = al_lock_bitmap(b, ALLEGRO_PIXEL_FORMAT_ABGR_8888_LE, ALLEGRO_LOCK_READONLY);
+    REQUIRE(ra != nullptr);
+    REQUIRE(rb != nullptr);
+    int differing = 0;
+    for (int y = 0; y < height; ++y) {
+        const uint8_t* pa = static_cast<const uint8_t*>(ra->data) + static_cast<ptrdiff_t>(y) * ra->pitch;
+        const uint8_t* pb = static_cast<const uint8_t*>(rb->data) + static_cast<ptrdiff_t>(y) * rb->pitch;
+        for (int x = 0; x < width * 4; x += 4) {
+            for (int c = 0; c < 4; ++c) {
+                if (std::abs(pa[x + c] - pb[x + c]) > CHANNEL_TOLERANCE) {
+                    ++differing;
+                    break;
+                }
+            }
+        }
+    }
+    al_unlock_bitmap(b);
+    al_unlock_bitmap(a);
+    return differing;
+}
+
+/// Compara o quadro com tests/golden/<name>.png (ou grava a referência, com GOLDEN_UPDATE=1).
+void checkGolden(const std::string& name, ALLEGRO_BITMAP* frame, double tolerance, bool reference)
+{
+    const std::string path = GOLDEN_DIR + "/" + name + ".png";
+    const bool update = std::getenv("GOLDEN_UPDATE") != nullptr;
+    if (reference && update) {
+        std::filesystem::create_directories(GOLDEN_DIR);
+        REQUIRE(al_save_bitmap(path.c_str(), frame));
+        MESSAGE("referência gravada: " << path);
+        return;
+    }
+    if (!std::filesystem::exists(path)) {
+        const std::string actual = OUTPUT_DIR + "/" + name + (reference ? "" : ".software") + ".png";
+        al_save_bitmap(actual.c_str(), frame);
+        if (std::getenv("GOLDEN_REQUIRE") != nullptr) {
+            FAIL("referência ausente: " << path << " (grave com make golden_update)");
+        }
+        MESSAGE("sem referência em " << path << ": quadro salvo em " << actual);
+        return;
+    }
+    BitmapPtr golden(al_load_bitmap(path.c_str()));
+    REQUIRE_MESSAGE(golden != nullptr, "referência ilegível: " << path);
+    REQUIRE(al_get_bitmap_width(golden.get()) == al_get_bitmap_width(frame));
+    REQUIRE(al_get_bitmap_height(golden.get()) == al_get_bitmap_height(frame));
+
+    const int differing = countDifferences(golden.get(), frame);
+    const int allowed = static_cast<int>(tolerance * BUFFER_W * BUFFER_H);
+    if (differing > allowed) {
+        const std::string actual = OUTPUT_DIR + "/" + name + (reference ? "" : ".software") + ".png";
+        al_save_bitmap(actual.c_str(), frame);
+        MESSAGE("quadro diferente salvo em " << actual);
+    }
+    CHECK_MESSAGE(differing <= allowed, name << ": " << differing << " pixels diferentes (máximo " << allowed << ")");
+}
+
+/// Anota o tempo médio de desenho em bin/golden/tempos.csv (o arquivo é refeito a cada execução).
+void recordTime(const std::string& name, const char* renderer, double ms)
+{
+    static bool first = true;
+    std::ofstream out(OUTPUT_DIR + "/tempos.csv", first ? std::ios::trunc : std::ios::app);
+    if (first) out << "quadro,renderer,ms_por_quadro\n";
+    first = false;
+    out << name << ',' << renderer << ',' << ms << '\n';
+    MESSAGE(name << " (" << renderer << "): " << ms << " ms por quadro");
+}
+
+/**
+ * @brief Desenha o quadro com os dois backends, compara cada um com a referência e mede o tempo.
+ * @details O desenho é feito uma vez (compondo os caches) antes da comparação e da medida.
+ */
+template <typename Draw>
+void renderGolden(const std::string& name, Draw draw)
+{
+    env();
+    BitmapPtr frame(al_create_bitmap(BUFFER_W, BUFFER_H));
+    REQUIRE(frame != nullptr);
+    SoftwareRenderer software;
+    Renderer* backends[2] = {nullptr, &software};
+    for (Renderer* backend : backends) {
+        const bool reference = backend == nullptr;
+        Renderer::setCurrent(backend);
+        LayerCache::invalidateAll();
+        al_set_target_bitmap(frame.get());
+        auto drawFrame = [&] {
+            Renderer::current().clear(al_map_rgb(0, 0, 0));
+            draw();
+        };
+        drawFrame();
+        checkGolden(name, frame.get(), reference ? REFERENCE_TOLERANCE : SOFTWARE_TOLERANCE, reference);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < TIMED_FRAMES; ++i) drawFrame();
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / TIMED_FRAMES;
+        recordTime(name, reference ? "AllegroRenderer" : "SoftwareRenderer", ms);
+        // O SoftwareRenderer é o caminho das máquinas sem GPU: com GOLDEN_BUDGET=1, precisa caber num quadro.
+        if (!reference && std::getenv("GOLDEN_BUDGET") != nullptr) {
+            CHECK(ms <= FRAME_BUDGET_MS);
+        } else {
+            WARN(ms <= FRAME_BUDGET_MS);
+        }
+    }
+    Renderer::setCurrent(nullptr);
+    LayerCache::invalidateAll();
+}
+
+} // namespace
+
+TEST_SUITE("Quadros de referência") {
+    TEST_CASE("StartMenu") {
+        StartMenu menu(&env().sceneManager);
+        renderGolden("start_menu", [&] { menu.draw(); });
+    }
+
+    TEST_CASE("CharacterSelectionScene") {
+        CharacterSelectionScene selection(&env().sceneManager);
+        renderGolden("character_selection", [&] { selection.draw(); });
+    }
+
+    TEST_CASE("RankingScene") {
+        RankingScene ranking(&env().sceneManager);
+        std::vector<std::pair<std::string, int>> scores;
+        for (int i = 0; i < 8; ++i) scores.emplace_back("JOGADOR" + std::to_string(i), 300 - 23 * i);
+        ranking.setScores(scores);
+        renderGolden("ranking", [&] { ranking.draw(); });
+    }
+
+    TEST_CASE("GameScene em sementes e passos fixos") {
+        struct Shot {
+            const char* name;
+            size_t theme;
+            uint64_t seed;
+            int ticks;
+        };
+        const Shot shots[] = {
+            {"game_seed1_tick0", 0, 1, 0},
+            {"game_seed1_tick120", 0, 1, 120},
+            {"game_seed7_tick400", 0, 7, 400},
+            {"game_seed3_tick200_tema", 1, 3, 200},
+        };
+        for (const Shot& shot : shots) {
+            CAPTURE(shot.name);
+            const std::vector<Theme>& themes = env().themes;
+            std::unique_ptr<GameScene> game = playGame(themes[std::min(shot.theme, themes.size() - 1)], shot.seed, shot.ticks);
+            renderGolden(shot.name, [&] { game->draw(); });
+        }
+    }
+
+    TEST_CASE("GameOverScreen") {
+        std::unique_ptr<GameScene> game = playGame(env().themes[0], 1, 120);
+        ScoreManager scoreManager;
+        GameOverScreen gameOver(scoreManager);
+        gameOver.startSequence(42, 17);
+        gameOver.update(1.0f); // Fim da entrada do "Game Over"...
+        gameOver.update(1.0f); // ...e do placar: estado final, com medalha e selo "NEW".
+        renderGolden("game_over", [&] {
+            game->draw();
+            gameOver.draw();
+        });
+    }
+}
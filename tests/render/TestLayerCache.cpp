@@ -0,0 +1,79 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "render/LayerCache.hpp"
+#include "render/NullRenderer.hpp"
+#include <allegro5/allegro.h>
+
+namespace {
+
+// Bitmaps de memória: o cache não precisa de display.
+void initAllegro()
+{
+    static bool initialized = false;
+    if (!initialized) {
+        REQUIRE(al_init());
+        al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+        initialized = true;
+    }
+}
+
+} // namespace
+
+TEST_CASE("as camadas são compostas uma vez e reaproveitadas nos quadros seguintes") {
+    initAllegro();
+    NullRenderer renderer;
+    Renderer::setCurrent(&renderer);
+    LayerCache cache(32, 16);
+    int key = 0;
+    int composed = 0;
+    auto compose = [&] { ++composed; Renderer::current().drawFilledRectangle(0, 0, 32, 16, al_map_rgb(255, 0, 0)); };
+
+    CHECK_FALSE(cache.isValid());
+    ALLEGRO_BITMAP* first = cache.get(&key, compose);
+    REQUIRE(first != nullptr);
+    for (int frame = 0; frame < 10; ++frame) CHECK(cache.get(&key, compose) == first);
+    CHECK(composed == 1);
+    CHECK(cache.getCompositions() == 1);
+    // A composição limpa o cache antes de desenhar as camadas.
+    CHECK(renderer.getCount(RenderCall::CLEAR) == 1);
+    CHECK(renderer.getCount(RenderCall::FILLED_RECTANGLE) == 1);
+    Renderer::setCurrent(nullptr);
+}
+
+TEST_CASE("trocar a chave, invalidar ou invalidar todos refaz o cache") {
+    initAllegro();
+    NullRenderer renderer;
+    Renderer::setCurrent(&renderer);
+    LayerCache cache(8, 8);
+    int dayTheme = 0, nightTheme = 0;
+    int composed = 0;
+    auto compose = [&] { ++composed; };
+
+    cache.get(&dayTheme, compose);
+    cache.get(&nightTheme, compose);
+    CHECK(composed == 2);
+    cache.get(&nightTheme, compose);
+    CHECK(composed == 2);
+
+    cache.invalidate();
+    CHECK_FALSE(cache.isValid());
+    cache.get(&nightTheme, compose);
+    CHECK(composed == 3);
+
+    LayerCache::invalidateAll();
+    cache.get(&nightTheme, compose);
+    CHECK(composed == 4);
+    Renderer::setCurrent(nullptr);
+}
+
+TEST_CASE("com o cache desligado quem chama desenha direto") {
+    initAllegro();
+    LayerCache cache(8, 8);
+    int composed = 0;
+    LayerCache::setEnabled(false);
+    CHECK(cache.get(nullptr, [&] { ++composed; }) == nullptr);
+    CHECK(composed == 0);
+    LayerCache::setEnabled(true);
+    CHECK(cache.get(nullptr, [&] { ++composed; }) != nullptr);
+    CHECK(composed == 1);
+}
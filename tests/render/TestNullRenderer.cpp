@@ -0,0 +1,92 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "render/NullRenderer.hpp"
+#include "render/RenderQueue.hpp"
+#include "Constants.hpp"
+#include <cstdint>
+
+namespace {
+
+// O NullRenderer nunca lê as texturas, então bastam endereços distintos.
+ALLEGRO_BITMAP* fakeBitmap(uintptr_t id)
+{
+    return reinterpret_cast<ALLEGRO_BITMAP*>(id * 64);
+}
+
+/// Troca o backend em uso enquanto o teste roda.
+struct UseRenderer {
+    explicit UseRenderer(Renderer& renderer) { Renderer::setCurrent(&renderer); }
+    ~UseRenderer() { Renderer::setCurrent(nullptr); }
+};
+
+} // namespace
+
+TEST_CASE("NullRenderer conta as chamadas por tipo e as grava quando pedido") {
+    NullRenderer renderer;
+    ALLEGRO_COLOR white{1.0f, 1.0f, 1.0f, 1.0f};
+
+    renderer.drawBitmap(fakeBitmap(1), 10, 20, 0);
+    renderer.setRecording(true);
+    renderer.drawScaledBitmap(fakeBitmap(2), 0, 0, 10, 10, 5, 6, 20, 30, 0);
+    renderer.drawTextf(nullptr, white, 1, 2, 0, "%d.", 12);
+    renderer.holdDrawing(true);
+    renderer.holdDrawing(false);
+
+    CHECK(renderer.getCount(RenderCall::BITMAP) == 1);
+    CHECK(renderer.getCount(RenderCall::SCALED_BITMAP) == 1);
+    CHECK(renderer.getCount(RenderCall::TEXT) == 1);
+    CHECK(renderer.getCount(RenderCall::HOLD) == 2);
+    CHECK(renderer.getDrawCalls() == 3);
+
+    REQUIRE(renderer.getCalls().size() == 2);
+    CHECK(renderer.getCalls()[0].call == RenderCall::SCALED_BITMAP);
+    CHECK(renderer.getCalls()[0].bitmap == fakeBitmap(2));
+    CHECK(renderer.getCalls()[0].w == doctest::Approx(20));
+    CHECK(renderer.getCalls()[1].call == RenderCall::TEXT);
+    CHECK(renderer.getCalls()[1].w == doctest::Approx(3)); // "12."
+
+    renderer.reset();
+    CHECK(renderer.getDrawCalls() == 0);
+    CHECK(renderer.getCalls().empty());
+}
+
+TEST_CASE("Renderer::current volta ao backend padrão com setCurrent(nullptr)") {
+    NullRenderer renderer;
+    Renderer& standard = Renderer::current();
+    {
+        UseRenderer use(renderer);
+        CHECK(&Renderer::current() == &renderer);
+    }
+    CHECK(&Renderer::current() == &standard);
+}
+
+TEST_CASE("RenderQueue::flush desenha pelo backend em uso, uma chamada por comando") {
+    NullRenderer renderer;
+    renderer.setRecording(true);
+    UseRenderer use(renderer);
+
+    RenderQueue queue(BUFFER_W, BUFFER_H);
+    RenderCommand background = RenderQueue::makeCommand(RenderLayer::BACKGROUND, fakeBitmap(11), fakeBitmap(1), BUFFER_W, BUFFER_H, 0, 0);
+    RenderCommand pipeA = RenderQueue::makeCommand(RenderLayer::PIPES, fakeBitmap(21), fakeBitmap(2), PIPE_WIDTH, 320, 100, 300);
+    RenderCommand pipeB = RenderQueue::makeCommand(RenderLayer::PIPES, fakeBitmap(12), fakeBitmap(1), PIPE_WIDTH, 320, 200, 300);
+    RenderCommand pipeC = RenderQueue::makeCommand(RenderLayer::PIPES, fakeBitmap(21), fakeBitmap(2), PIPE_WIDTH, 320, 250, 300);
+    RenderCommand bird = RenderQueue::makeCommand(RenderLayer::BIRD, fakeBitmap(13), fakeBitmap(1), BIRD_WIDTH, BIRD_HEIGHT, 50, 200);
+    bird.angle = 0.5f;
+    for (const RenderCommand& command : {bird, pipeA, pipeB, pipeC, background}) queue.submit(command);
+    queue.flush();
+
+    // Sem rotação vira um drawBitmap; o pássaro girado usa a versão transformada.
+    CHECK(renderer.getCount(RenderCall::BITMAP) == 4);
+    CHECK(renderer.getCount(RenderCall::ROTATED_BITMAP) == 1);
+    CHECK(renderer.getCount(RenderCall::HOLD) == 2);
+    CHECK(queue.getStats().drawCalls == 5);
+
+    // Fundo e cano B (atlas 1), canos A e C (atlas 2) na ordem de envio, pássaro (atlas 1 de novo).
+    REQUIRE(renderer.getCalls().size() == 5);
+    CHECK(renderer.getCalls()[0].bitmap == fakeBitmap(11));
+    CHECK(renderer.getCalls()[1].bitmap == fakeBitmap(12));
+    CHECK(renderer.getCalls()[2].x == doctest::Approx(100));
+    CHECK(renderer.getCalls()[3].x == doctest::Approx(250));
+    CHECK(queue.getStats().textureSwitches == 3);
+    CHECK(renderer.getCalls()[4].bitmap == fakeBitmap(13));
+}
@@ -0,0 +1,87 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "render/RenderQueue.hpp"
+#include "Constants.hpp"
+#include <cstdint>
+
+namespace {
+
+// Os testes só ordenam e recortam; as texturas nunca são desenhadas, então bastam endereços distintos.
+ALLEGRO_BITMAP* fakeBitmap(uintptr_t id)
+{
+    return reinterpret_cast<ALLEGRO_BITMAP*>(id * 64);
+}
+
+RenderCommand sprite(RenderLayer layer, uintptr_t sheet, float x, float y, float w = 20.0f, float h = 20.0f)
+{
+    return RenderQueue::makeCommand(layer, fakeBitmap(sheet * 100 + 1), fakeBitmap(sheet), w, h, x, y);
+}
+
+} // namespace
+
+TEST_CASE("comandos são ordenados por camada, depois por textura, mantendo a ordem de envio") {
+    RenderQueue queue(BUFFER_W, BUFFER_H);
+    queue.submit(sprite(RenderLayer::BIRD, 1, 50, 50));
+    queue.submit(sprite(RenderLayer::PIPES, 2, 100, 0));
+    queue.submit(sprite(RenderLayer::PIPES, 1, 10, 0));
+    queue.submit(sprite(RenderLayer::BACKGROUND, 3, 0, 0));
+    queue.submit(sprite(RenderLayer::PIPES, 2, 200, 0));
+    queue.submit(sprite(RenderLayer::PIPES, 1, 150, 0));
+    queue.sort();
+
+    const auto& commands = queue.getCommands();
+    REQUIRE(commands.size() == 6);
+    CHECK(commands[0].layer == RenderLayer::BACKGROUND);
+    for (int i = 1; i <= 4; ++i) CHECK(commands[i].layer == RenderLayer::PIPES);
+    CHECK(commands[5].layer == RenderLayer::BIRD);
+
+    // Dentro da camada, os dois canos de cada textura ficam seguidos e na ordem em que foram enviados.
+    CHECK(commands[1].sheet == commands[2].sheet);
+    CHECK(commands[3].sheet == commands[4].sheet);
+    CHECK(commands[1].sheet != commands[3].sheet);
+    CHECK(commands[1].sequence < commands[2].sequence);
+    CHECK(commands[3].sequence < commands[4].sequence);
+}
+
+TEST_CASE("comandos fora da tela são recortados no envio") {
+    RenderQueue queue(BUFFER_W, BUFFER_H);
+    CHECK(queue.submit(sprite(RenderLayer::PIPES, 1, -PIPE_WIDTH + 1, 0, PIPE_WIDTH, 320)));
+    CHECK_FALSE(queue.submit(sprite(RenderLayer::PIPES, 1, -PIPE_WIDTH, 0, PIPE_WIDTH, 320)));
+    CHECK_FALSE(queue.submit(sprite(RenderLayer::PIPES, 1, BUFFER_W, 0, PIPE_WIDTH, 320)));
+    CHECK_FALSE(queue.submit(sprite(RenderLayer::PIPES, 1, 100, -320, PIPE_WIDTH, 320)));
+    CHECK(queue.submit(sprite(RenderLayer::BACKGROUND, 2, BUFFER_W - 1, 0, BUFFER_W, BUFFER_H)));
+
+    CHECK(queue.getStats().submitted == 5);
+    CHECK(queue.getStats().culled == 3);
+    CHECK(queue.getCommands().size() == 2);
+}
+
+TEST_CASE("sprites girados usam uma caixa que os contém em qualquer ângulo") {
+    RenderCommand bird = sprite(RenderLayer::BIRD, 1, 0, 0, BIRD_WIDTH, BIRD_HEIGHT);
+    bird.pivotX = BIRD_WIDTH / 2;
+    bird.pivotY = BIRD_HEIGHT / 2;
+    bird.angle = 1.0f;
+
+    // O centro logo fora da borda ainda deixa uma ponta do pássaro visível.
+    bird.x = -BIRD_WIDTH / 2 + 1;
+    bird.y = 100;
+    CHECK(RenderQueue::isVisible(bird, BUFFER_W, BUFFER_H));
+
+    bird.x = -BIRD_WIDTH;
+    CHECK_FALSE(RenderQueue::isVisible(bird, BUFFER_W, BUFFER_H));
+}
+
+TEST_CASE("clear descarta os comandos e zera os contadores, reusando a memória") {
+    RenderQueue queue(BUFFER_W, BUFFER_H, 8);
+    for (int i = 0; i < 8; ++i) queue.submit(sprite(RenderLayer::PIPES, 1, 10.0f * i, 0));
+    const RenderCommand* storage = queue.getCommands().data();
+
+    queue.clear();
+    CHECK(queue.getCommands().empty());
+    CHECK(queue.getStats().submitted == 0);
+    CHECK(queue.getStats().culled == 0);
+
+    queue.submit(sprite(RenderLayer::PIPES, 1, 0, 0));
+    CHECK(queue.getCommands().data() == storage);
+    CHECK(queue.getCommands()[0].sequence == 0);
+}
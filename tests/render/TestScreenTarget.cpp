@@ -0,0 +1,49 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "render/ScreenTarget.hpp"
+#include "Constants.hpp"
+
+TEST_CASE("no tamanho original o quadro ocupa a janela inteira em escala 1") {
+    Letterbox box = Letterbox::fit(BUFFER_W, BUFFER_H, BUFFER_W, BUFFER_H);
+    CHECK(box.scale == 1.0f);
+    CHECK(box.x == 0);
+    CHECK(box.y == 0);
+    CHECK(box.width == BUFFER_W);
+    CHECK(box.height == BUFFER_H);
+}
+
+TEST_CASE("a escala é inteira e o que sobra vira faixas pretas centralizadas") {
+    // 1920x1080: cabe 2x na altura (1024 <= 1080) e 6x na largura; vale o menor.
+    Letterbox box = Letterbox::fit(1920, 1080, BUFFER_W, BUFFER_H);
+    CHECK(box.scale == 2.0f);
+    CHECK(box.width == 2 * BUFFER_W);
+    CHECK(box.height == 2 * BUFFER_H);
+    CHECK(box.x == (1920 - 2 * BUFFER_W) / 2);
+    CHECK(box.y == (1080 - 2 * BUFFER_H) / 2);
+
+    // Quase 3x não arredonda para cima: o quadro nunca sai da janela.
+    box = Letterbox::fit(3 * BUFFER_W - 1, 3 * BUFFER_H, BUFFER_W, BUFFER_H);
+    CHECK(box.scale == 2.0f);
+}
+
+TEST_CASE("em janelas menores que o quadro a escala é reduzida até caber") {
+    Letterbox box = Letterbox::fit(BUFFER_W, BUFFER_H / 2, BUFFER_W, BUFFER_H);
+    CHECK(box.scale == doctest::Approx(0.5f));
+    CHECK(box.width <= BUFFER_W);
+    CHECK(box.height <= BUFFER_H / 2);
+}
+
+TEST_CASE("o mouse é convertido da janela para o quadro") {
+    Letterbox box = Letterbox::fit(1920, 1080, BUFFER_W, BUFFER_H);
+    int x = box.x + 2 * 100 + 1;
+    int y = box.y + 2 * 50;
+    box.toFrame(x, y);
+    CHECK(x == 100);
+    CHECK(y == 50);
+
+    // Nas faixas pretas, fora do quadro, as coordenadas ficam negativas.
+    x = 0;
+    y = 0;
+    box.toFrame(x, y);
+    CHECK(x < 0);
+}
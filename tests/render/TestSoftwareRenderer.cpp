@@ -0,0 +1,215 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "render/LayerCache.hpp"
+#include "render/SoftwareRenderer.hpp"
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include <cmath>
+#include <cstdlib>
+
+namespace {
+
+// Bitmaps de memória: é justamente o caso do SoftwareRenderer, sem display.
+void initAllegro()
+{
+    static bool initialized = false;
+    if (!initialized) {
+        REQUIRE(al_init());
+        REQUIRE(al_init_primitives_addon());
+        al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+        initialized = true;
+    }
+}
+
+/// Um sprite 4x3 de alfa binário com um buraco no meio, como os canos e o pássaro.
+ALLEGRO_BITMAP* createSprite()
+{
+    ALLEGRO_BITMAP* sprite = al_create_bitmap(4, 3);
+    al_set_target_bitmap(sprite);
+    for (int y = 0; y < 3; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            const bool hole = (x == 1 || x == 2) && y == 1;
+            al_put_pixel(x, y, hole ? al_map_rgba(0, 0, 0, 0) : al_map_rgb(40 * x, 60 * y, 200));
+        }
+    }
+    return sprite;
+}
+
+/// Se os dois bitmaps têm os mesmos pixels, com até tolerance de diferença por canal.
+bool samePixels(ALLEGRO_BITMAP* a, ALLEGRO_BITMAP* b, int tolerance)
+{
+    for (int y = 0; y < al_get_bitmap_height(a); ++y) {
+        for (int x = 0; x < al_get_bitmap_width(a); ++x) {
+            unsigned char pa[4], pb[4];
+            al_unmap_rgba(al_get_pixel(a, x, y), &pa[0], &pa[1], &pa[2], &pa[3]);
+            al_unmap_rgba(al_get_pixel(b, x, y), &pb[0], &pb[1], &pb[2], &pb[3]);
+            for (int c = 0; c < 4; ++c) {
+                if (std::abs(pa[c] - pb[c]) > tolerance) return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("os ângulos são arredondados para o passo das rotações pré-calculadas") {
+    const float degree = static_cast<float>(ALLEGRO_PI) / 180.0f;
+    CHECK(SoftwareRenderer::quantizeAngle(0.0f) == 0);
+    CHECK(SoftwareRenderer::quantizeAngle(0.9f * degree) == 0);
+    CHECK(SoftwareRenderer::quantizeAngle(static_cast<float>(ALLEGRO_PI)) == SoftwareRenderer::ANGLE_COUNT / 2);
+    CHECK(SoftwareRenderer::quantizeAngle(60.0f * degree) == 30);
+    // Ângulos negativos dão a volta: -60° é o mesmo que 300°.
+    CHECK(SoftwareRenderer::quantizeAngle(-60.0f * degree) == SoftwareRenderer::ANGLE_COUNT - 30);
+}
+
+TEST_CASE("a tabela de mistura reproduz src + dst * (1 - alfa)") {
+    PixelLayout argb;
+    REQUIRE(PixelLayout::of(ALLEGRO_PIXEL_FORMAT_ARGB_8888, argb));
+    // Preto a 50%: escurece cada canal pela metade; o alfa de um destino opaco continua 255.
+    const BlendTable half = BlendTable::forColor(ALLEGRO_COLOR{0.0f, 0.0f, 0.0f, 0.5f}, argb);
+    CHECK(half.apply(0xFFC86400u) == 0xFF643200u);
+    // Branco opaco cobre o pixel.
+    const BlendTable white = BlendTable::forColor(ALLEGRO_COLOR{1.0f, 1.0f, 1.0f, 1.0f}, argb);
+    CHECK(white.apply(0x00123456u) == 0xFFFFFFFFu);
+
+    uint32_t row[3] = {0xFF000000u, 0xFFFFFFFFu, 0xFF808080u};
+    half.applyRow(row, 3);
+    CHECK(row[0] == 0xFF000000u);
+    CHECK(row[1] == 0xFF808080u);
+    CHECK(row[2] == 0xFF404040u);
+
+    PixelLayout unsupported;
+    CHECK_FALSE(PixelLayout::of(ALLEGRO_PIXEL_FORMAT_ANY, unsupported));
+}
+
+TEST_CASE("sprites de alfa binário viram trechos copiados com recorte") {
+    // Linha 0: opaco, transparente, opaco. Linha 1: tudo opaco.
+    const uint32_t image[2][3] = {{0xFF0000AAu, 0x00000000u, 0xFF0000BBu},
+                                  {0xFF0000CCu, 0xFF0000DDu, 0xFF0000EEu}};
+    PixelSprite<uint32_t> sprite;
+    REQUIRE(SoftwareRenderer::buildSprite(reinterpret_cast<const uint8_t*>(image), sizeof(image[0]), 3, 2, 24, sprite));
+    CHECK(sprite.spans.size() == 3);
+    CHECK(sprite.rowSpans[1] == 2);
+
+    uint32_t target[3][4] = {};
+    // Canto em (2, 1): a última coluna sai pela direita e a linha de baixo pelo clip.
+    SoftwareRenderer::blitSprite(sprite, reinterpret_cast<uint8_t*>(target), sizeof(target[0]), 0, 0, 4, 2, 2, 1);
+    CHECK(target[1][2] == 0xFF0000AAu);
+    CHECK(target[1][3] == 0u); // Pixel transparente não é copiado.
+    CHECK(target[2][2] == 0u); // Fora do clip.
+    CHECK(target[0][2] == 0u);
+
+    // Com alfa parcial, copiar não daria o mesmo resultado que misturar.
+    const uint32_t soft[1][2] = {{0xFF000000u, 0x80000000u}};
+    CHECK_FALSE(SoftwareRenderer::buildSprite(reinterpret_cast<const uint8_t*>(soft), sizeof(soft[0]), 2, 1, 24, sprite));
+}
+
+TEST_CASE("os atalhos desenham o mesmo que o AllegroRenderer num bitmap de memória") {
+    initAllegro();
+    ALLEGRO_BITMAP* sprite = createSprite();
+    ALLEGRO_BITMAP* expected = al_create_bitmap(16, 12);
+    ALLEGRO_BITMAP* actual = al_create_bitmap(16, 12);
+    AllegroRenderer allegro;
+    SoftwareRenderer software;
+
+    al_set_target_bitmap(expected);
+    al_clear_to_color(al_map_rgb(10, 120, 230));
+    allegro.drawBitmap(sprite, 3, 4, 0);
+    allegro.drawBitmap(sprite, 14, -1, ALLEGRO_FLIP_HORIZONTAL | ALLEGRO_FLIP_VERTICAL);
+    allegro.drawFilledRectangle(0, 0, 16, 12, al_map_rgba_f(0.0f, 0.0f, 0.0f, 0.4f));
+
+    al_set_target_bitmap(actual);
+    al_clear_to_color(al_map_rgb(10, 120, 230));
+    software.drawBitmap(sprite, 3, 4, 0);
+    software.drawBitmap(sprite, 14, -1, ALLEGRO_FLIP_HORIZONTAL | ALLEGRO_FLIP_VERTICAL);
+    software.drawFilledRectangle(0, 0, 16, 12, al_map_rgba_f(0.0f, 0.0f, 0.0f, 0.4f));
+
+    CHECK(software.getStats().spanBlits == 2);
+    CHECK(software.getStats().tableFills == 1);
+    CHECK(software.getStats().fallbacks == 0);
+    CHECK(software.getCachedSprites() == 2); // O sprite e a cópia espelhada.
+    // As cópias são exatas; a mistura pode arredondar diferente em um nível.
+    CHECK(samePixels(expected, actual, 1));
+
+    al_destroy_bitmap(actual);
+    al_destroy_bitmap(expected);
+    al_destroy_bitmap(sprite);
+}
+
+TEST_CASE("a tabela de mistura só é recalculada quando a cor muda") {
+    initAllegro();
+    ALLEGRO_BITMAP* frame = al_create_bitmap(16, 12);
+    SoftwareRenderer software;
+    al_set_target_bitmap(frame);
+
+    const ALLEGRO_COLOR fade = al_map_rgba_f(0.0f, 0.0f, 0.0f, 0.4f);
+    for (int i = 0; i < 3; ++i) software.drawFilledRectangle(0, 0, 16, 12, fade);
+    CHECK(software.getStats().tableFills == 3);
+    CHECK(software.getStats().tableBuilds == 1);
+
+    software.drawFilledRectangle(0, 0, 16, 12, al_map_rgba_f(0.0f, 0.0f, 0.0f, 0.5f));
+    software.drawFilledRectangle(0, 0, 8, 6, al_map_rgba_f(0.0f, 0.0f, 0.0f, 0.5f));
+    CHECK(software.getStats().tableBuilds == 2);
+
+    al_destroy_bitmap(frame);
+}
+
+TEST_CASE("chamadas sem atalho vão para o AllegroRenderer") {
+    initAllegro();
+    ALLEGRO_BITMAP* sprite = createSprite();
+    ALLEGRO_BITMAP* frame = al_create_bitmap(16, 12);
+    SoftwareRenderer software;
+    al_set_target_bitmap(frame);
+
+    // Tinta, escala e retângulos fora da grade de pixels.
+    software.drawTintedScaledRotatedBitmap(sprite, al_map_rgba_f(1, 1, 1, 0.5f), 2, 1, 8, 6, 1, 1, 0, 0);
+    software.drawTintedScaledRotatedBitmap(sprite, al_map_rgb(255, 255, 255), 2, 1, 8, 6, 2, 2, 0, 0);
+    software.drawFilledRectangle(0.5f, 0, 4, 4, al_map_rgb(0, 0, 0));
+    CHECK(software.getStats().fallbacks == 3);
+
+    // Sprites pequenos girados usam a cópia pré-girada do passo mais próximo, uma por passo.
+    software.resetStats();
+    const float degree = static_cast<float>(ALLEGRO_PI) / 180.0f;
+    software.drawTintedScaledRotatedBitmap(sprite, al_map_rgb(255, 255, 255), 2, 1.5f, 8, 6, 1, 1, 30.2f * degree, 0);
+    software.drawTintedScaledRotatedBitmap(sprite, al_map_rgb(255, 255, 255), 2, 1.5f, 8, 6, 1, 1, 29.8f * degree, 0);
+    CHECK(software.getStats().spanBlits == 2);
+    CHECK(software.getCachedSprites() == 1);
+
+    al_destroy_bitmap(frame);
+    al_destroy_bitmap(sprite);
+}
+
+TEST_CASE("recompor um LayerCache descarta o sprite preparado do bitmap antigo") {
+    initAllegro();
+    SoftwareRenderer software;
+    Renderer::setCurrent(&software);
+    LayerCache layer(4, 4);
+    ALLEGRO_BITMAP* frame = al_create_bitmap(8, 8);
+    int key = 0;
+    auto drawLayer = [&](ALLEGRO_COLOR color) {
+        ALLEGRO_BITMAP* composed = layer.get(&key, [&] { Renderer::current().drawFilledRectangle(0, 0, 4, 4, color); });
+        REQUIRE(composed != nullptr);
+        al_set_target_bitmap(frame);
+        al_clear_to_color(al_map_rgb(0, 0, 0));
+        software.drawBitmap(composed, 2, 2, 0);
+    };
+    unsigned char r, g, b;
+
+    // Como o placar da GameOverScreen: o mesmo bitmap, recomposto a cada fim de partida.
+    drawLayer(al_map_rgb(255, 0, 0));
+    al_unmap_rgb(al_get_pixel(frame, 3, 3), &r, &g, &b);
+    CHECK(r == 255);
+    CHECK(b == 0);
+
+    layer.invalidate();
+    drawLayer(al_map_rgb(0, 0, 255));
+    al_unmap_rgb(al_get_pixel(frame, 3, 3), &r, &g, &b);
+    CHECK(r == 0);
+    CHECK(b == 255);
+    CHECK(software.getStats().spanBlits == 2);
+    CHECK(software.getCachedSprites() == 1);
+
+    Renderer::setCurrent(nullptr);
+    al_destroy_bitmap(frame);
+}
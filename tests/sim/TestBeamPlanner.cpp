@@ -0,0 +1,70 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/BeamPlanner.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include <cstring>
+
+namespace {
+    /// Joga até morrer ou até maxTicks passos; retorna o passo final.
+    template <typename Pilot>
+    uint32_t play(uint64_t seed, uint32_t maxTicks, Pilot pilot)
+    {
+        FixedGameSimulation sim;
+        sim.reset(seed);
+        while (sim.getPhase() != SimPhase::DEAD && sim.getTick() < maxTicks) {
+            sim.step(pilot(sim.getState()));
+        }
+        return sim.getTick();
+    }
+}
+
+TEST_SUITE("BeamPlanner") {
+    TEST_CASE("sobrevive a percursos em que o piloto simples morre") {
+        const uint32_t MAX_TICKS = 1500;
+        BeamPlanner planner;
+        int simpleDeaths = 0;
+        for (uint64_t seed = 1; seed <= 6; ++seed) {
+            if (play(seed, MAX_TICKS, [](const FixedSimState& s) { return autopilot(s); }) < MAX_TICKS) ++simpleDeaths;
+            CHECK(play(seed, MAX_TICKS, [&](const FixedSimState& s) { return planner.plan(s); }) == MAX_TICKS);
+        }
+        CHECK(simpleDeaths > 0);
+    }
+
+    TEST_CASE("decisao e deterministica e nao altera o estado de entrada") {
+        FixedGameSimulation sim;
+        sim.reset(3);
+        for (int t = 0; t < 60; ++t) sim.step(autopilot(sim.getState()));
+        FixedSimState state;
+        sim.save(state);
+        FixedSimState copy = state;
+
+        BeamPlanner a;
+        BeamPlanner b;
+        for (int i = 0; i < 3; ++i) CHECK(a.plan(state) == b.plan(state));
+        CHECK(std::memcmp(&state, &copy, sizeof(FixedSimState)) == 0);
+    }
+
+    TEST_CASE("pula para iniciar e nao pula depois de morrer") {
+        BeamPlanner planner;
+        FixedGameSimulation sim;
+        sim.reset(1);
+        CHECK(planner.plan(sim.getState()));
+        sim.step(true);
+        while (sim.getPhase() != SimPhase::DEAD) sim.step(false);
+        CHECK_FALSE(planner.plan(sim.getState()));
+    }
+
+    TEST_CASE("estatisticas acompanham as buscas") {
+        BeamPlanner planner(16, 30);
+        FixedGameSimulation sim;
+        sim.reset(2);
+        sim.step(true);
+        planner.plan(sim.getState());
+        CHECK(planner.getPlansEvaluated() > 0);
+        CHECK(planner.getPlansEvaluated() <= 16u);
+        CHECK(planner.getStepsSimulated() > 30u);
+        CHECK(planner.getLastSurvival() == 30u);
+    }
+}
@@ -0,0 +1,117 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/BirdPopulation.hpp"
+#include "sim/PipeCourse.hpp"
+#include "sim/BirdPhysics.hpp"
+#include "Constants.hpp"
+#include <vector>
+
+TEST_SUITE("PipeCourse") {
+    TEST_CASE("mesma semente gera o mesmo percurso") {
+        PipeCourse a, b;
+        a.reset(123);
+        b.reset(123);
+        for (int t = 0; t < 300; ++t) {
+            a.advance(1.0f / FPS); a.spawnIfDue(1.0f / FPS);
+            b.advance(1.0f / FPS); b.spawnIfDue(1.0f / FPS);
+        }
+        REQUIRE(a.getCount() == b.getCount());
+        for (int i = 0; i < a.getCount(); ++i) {
+            CHECK(a.getX(i) == b.getX(i));
+            CHECK(a.getGapTop(i) == b.getGapTop(i));
+        }
+    }
+
+    TEST_CASE("canos ficam ordenados por X e com o vao do tamanho PIPE_GAP") {
+        PipeCourse course;
+        course.reset(5);
+        for (int t = 0; t < 1000; ++t) {
+            course.advance(1.0f / FPS);
+            course.spawnIfDue(1.0f / FPS);
+            for (int i = 1; i < course.getCount(); ++i) {
+                CHECK(course.getX(i - 1) < course.getX(i));
+            }
+            for (int i = 0; i < course.getCount(); ++i) {
+                CHECK(course.getGapBottom(i) - course.getGapTop(i) == doctest::Approx(PIPE_GAP));
+                CHECK(course.getGapTop(i) >= 0.0f);
+            }
+        }
+    }
+
+    TEST_CASE("primeiro cano surge apos PIPE_INTERVAL") {
+        PipeCourse course;
+        course.reset(1);
+        CHECK_FALSE(course.spawnIfDue(PIPE_INTERVAL * 0.5f));
+        CHECK(course.getCount() == 0);
+        CHECK(course.spawnIfDue(PIPE_INTERVAL * 0.5f));
+        CHECK(course.getCount() == 1);
+        CHECK(course.getX(0) == doctest::Approx(BUFFER_W));
+    }
+}
+
+TEST_SUITE("BirdPopulation") {
+    TEST_CASE("fisica de cada passaro e a mesma do nucleo escalar") {
+        BirdPopulation population(37);
+        std::vector<uint8_t> jumps(37, 0);
+        jumps[3] = 1;
+
+        float y = BIRD_START_Y, velY = 0.0f;
+        float yJump = BIRD_START_Y, velYJump = JUMP_IMPULSE_VELOCITY;
+        PipeSpan noPipes{nullptr, nullptr, nullptr, 0};
+        population.stepBirds(jumps.data(), noPipes, 0, 1.0f / FPS);
+        integrateBird(y, velY, 1.0f / FPS);
+        integrateBird(yJump, velYJump, 1.0f / FPS);
+
+        CHECK(population.getY()[0] == y);
+        CHECK(population.getVelY()[0] == velY);
+        CHECK(population.getY()[3] == yJump);
+        CHECK(population.getVelY()[3] == velYJump);
+        CHECK(population.getAngle()[3] == birdAngleFor(velYJump));
+    }
+
+    TEST_CASE("sem pulos todos morrem no chao e ficam congelados") {
+        BirdPopulation population(100);
+        PipeCourse course;
+        course.reset(9);
+        size_t alive = population.size();
+        int ticks = 0;
+        while (alive > 0 && ticks < 1000) {
+            alive = population.step(nullptr, course, 1.0f / FPS);
+            ++ticks;
+        }
+        CHECK(alive == 0);
+        float frozenY = population.getY()[0];
+        CHECK(frozenY + BIRD_HEIGHT >= PLAYABLE_AREA_HEIGHT - TERMINAL_VELOCITY / FPS);
+        population.step(nullptr, course, 1.0f / FPS);
+        CHECK(population.getY()[0] == frozenY);
+        CHECK(population.getScore()[0] == 0);
+    }
+
+    TEST_CASE("passaro dentro do vao pontua e fora do vao morre") {
+        BirdPopulation population(2);
+        std::vector<uint8_t> jumps = {0, 0};
+        // Cano já sobre a coluna do pássaro, com o vão em volta de BIRD_START_Y.
+        float x[] = {BIRD_START_X - 10.0f};
+        float gapTop[] = {BIRD_START_Y - 60.0f};
+        float gapBottom[] = {BIRD_START_Y + 90.0f};
+        PipeSpan inside{x, gapTop, gapBottom, 1};
+        CHECK(population.stepBirds(jumps.data(), inside, 1, 1.0f / FPS) == 2);
+        CHECK(population.getScore()[0] == 1);
+
+        float lowGapTop[] = {BIRD_START_Y + 100.0f};
+        float lowGapBottom[] = {BIRD_START_Y + 250.0f};
+        PipeSpan outside{x, lowGapTop, lowGapBottom, 1};
+        CHECK(population.stepBirds(jumps.data(), outside, 1, 1.0f / FPS) == 0);
+        CHECK(population.getScore()[1] == 1);
+    }
+
+    TEST_CASE("reset revive todos") {
+        BirdPopulation population(10);
+        PipeCourse course;
+        course.reset(2);
+        for (int t = 0; t < 500; ++t) population.step(nullptr, course, 1.0f / FPS);
+        population.reset();
+        CHECK(population.getAliveCount() == 10);
+        CHECK(population.getY()[9] == doctest::Approx(BIRD_START_Y));
+    }
+}
@@ -0,0 +1,71 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/BroadPhase.hpp"
+#include "sim/BirdPopulation.hpp"
+#include "sim/PipePhysics.hpp"
+#include "sim/SimRandom.hpp"
+#include "Constants.hpp"
+#include <vector>
+
+namespace {
+    /// Gera n canos ordenados por X, com espaçamentos aleatórios (inclusive menores que a largura).
+    std::vector<float> sortedPipes(SimRandom& rng, int n)
+    {
+        std::vector<float> x(n);
+        float pos = -200.0f;
+        for (int i = 0; i < n; ++i) {
+            pos += 1.0f + rng.nextFloat() * 150.0f;
+            x[i] = pos;
+        }
+        return x;
+    }
+}
+
+TEST_SUITE("BroadPhase") {
+    TEST_CASE("janela coincide com a busca linear") {
+        SimRandom rng;
+        rng.seed(99);
+        for (int trial = 0; trial < 500; ++trial) {
+            const int n = static_cast<int>(rng.nextFloat() * 40.0f);
+            std::vector<float> x = sortedPipes(rng, n);
+            const float left = -300.0f + rng.nextFloat() * 2000.0f;
+            const float right = left + rng.nextFloat() * 100.0f;
+
+            PipeWindow window = findPipeWindow(n, [&](int i) { return x[i]; }, left, right, PIPE_WIDTH);
+            for (int i = 0; i < n; ++i) {
+                bool inWindow = i >= window.first && i < window.last;
+                CHECK(inWindow == pipeOverlapsColumn(x[i], x[i] + PIPE_WIDTH, left, right));
+            }
+        }
+    }
+
+    TEST_CASE("sequencia vazia ou sem sobreposicao gera janela vazia") {
+        PipeWindow none = findPipeWindow(0, [](int) { return 0.0f; }, 0.0f, 10.0f, PIPE_WIDTH);
+        CHECK(none.empty());
+
+        std::vector<float> x = {500.0f, 700.0f, 900.0f};
+        PipeWindow before = findPipeWindow(3, [&](int i) { return x[i]; }, 0.0f, 10.0f, PIPE_WIDTH);
+        CHECK(before.empty());
+        PipeWindow after = findPipeWindow(3, [&](int i) { return x[i]; }, 2000.0f, 2010.0f, PIPE_WIDTH);
+        CHECK(after.empty());
+    }
+
+    TEST_CASE("stepBirds com muitos canos so considera os que cruzam a coluna") {
+        // Um cano com vão muito baixo longe da coluna não pode matar ninguém.
+        const int n = 1000;
+        std::vector<float> x(n), gapTop(n), gapBottom(n);
+        for (int i = 0; i < n; ++i) {
+            x[i] = BIRD_START_X + 200.0f + i * 10.0f;
+            gapTop[i] = PLAYABLE_AREA_HEIGHT - 1.0f;
+            gapBottom[i] = PLAYABLE_AREA_HEIGHT;
+        }
+        PipeSpan span{x.data(), gapTop.data(), gapBottom.data(), n};
+
+        BirdPopulation population(16);
+        CHECK(population.stepBirds(nullptr, span, 0, 1.0f / FPS) == 16);
+
+        // Movendo o primeiro cano para a coluna, todos morrem.
+        x[0] = BIRD_START_X;
+        CHECK(population.stepBirds(nullptr, span, 0, 1.0f / FPS) == 0);
+    }
+}
@@ -0,0 +1,100 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/Fixed.hpp"
+#include "sim/BirdPopulation.hpp"
+#include "sim/PipeCourse.hpp"
+#include "sim/BirdPhysics.hpp"
+#include "Constants.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace {
+    /// FNV-1a sobre os valores brutos, para comparar execuções bit a bit.
+    uint64_t mix(uint64_t hash, uint32_t value)
+    {
+        for (int b = 0; b < 4; ++b) {
+            hash ^= (value >> (8 * b)) & 0xFF;
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    /// Roda uma população em ponto fixo por vários passos e resume o estado final.
+    uint64_t runFixedPopulation()
+    {
+        const size_t birds = 257;
+        FixedBirdPopulation population(birds);
+        FixedPipeCourse course;
+        course.reset(2024);
+        std::vector<uint8_t> jumps(birds);
+        const Fixed deltaTime(1.0f / FPS);
+
+        for (int tick = 0; tick < 3000; ++tick) {
+            Fixed target(BUFFER_H / 2);
+            for (int p = 0; p < course.getCount(); ++p) {
+                if (course.getX(p) + Fixed(PIPE_WIDTH) >= Fixed(BIRD_START_X)) {
+                    target = course.getGapTop(p) + Fixed(PIPE_GAP / 2);
+                    break;
+                }
+            }
+            for (size_t i = 0; i < birds; ++i) {
+                Fixed offset = Fixed::fromRaw(static_cast<int32_t>((i * 7919) % 61) * Fixed::ONE - 30 * Fixed::ONE);
+                jumps[i] = population.getY()[i] > target + offset && population.getVelY()[i] > Fixed(0);
+            }
+            population.step(jumps.data(), course, deltaTime);
+        }
+
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (size_t i = 0; i < birds; ++i) {
+            hash = mix(hash, static_cast<uint32_t>(population.getY()[i].raw));
+            hash = mix(hash, static_cast<uint32_t>(population.getVelY()[i].raw));
+            hash = mix(hash, static_cast<uint32_t>(population.getAngle()[i].raw));
+            hash = mix(hash, static_cast<uint32_t>(population.getScore()[i]));
+        }
+        for (int p = 0; p < course.getCount(); ++p) {
+            hash = mix(hash, static_cast<uint32_t>(course.getX(p).raw));
+            hash = mix(hash, static_cast<uint32_t>(course.getGapTop(p).raw));
+        }
+        return hash;
+    }
+}
+
+TEST_SUITE("Fixed") {
+    TEST_CASE("conversao e aritmetica basica") {
+        CHECK(Fixed(1).raw == Fixed::ONE);
+        CHECK(Fixed(-3).raw == -3 * Fixed::ONE);
+        CHECK(Fixed(0.5f).raw == Fixed::ONE / 2);
+        CHECK(Fixed(-0.5f).raw == -Fixed::ONE / 2);
+        CHECK((Fixed(3) + Fixed(4)) == Fixed(7));
+        CHECK((Fixed(3) - Fixed(4)) == Fixed(-1));
+        CHECK((Fixed(1.5f) * Fixed(-2)) == Fixed(-3));
+        CHECK((-Fixed(2.25f)).toFloat() == -2.25f);
+        CHECK(Fixed(-1) < Fixed(0));
+        CHECK(Fixed(GRAVITY).toFloat() == GRAVITY);
+    }
+
+    TEST_CASE("multiplicacao trunca em direcao a menos infinito") {
+        Fixed tiny = Fixed::fromRaw(1);
+        CHECK((tiny * Fixed(0.5f)).raw == 0);
+        CHECK((-tiny * Fixed(0.5f)).raw == -1);
+    }
+
+    TEST_CASE("fisica em ponto fixo acompanha a fisica em float") {
+        float y = BIRD_START_Y, velY = JUMP_IMPULSE_VELOCITY;
+        Fixed fy(BIRD_START_Y), fvelY(JUMP_IMPULSE_VELOCITY);
+        for (int t = 0; t < 60; ++t) {
+            integrateBird(y, velY, 1.0f / FPS);
+            integrateBird(fy, fvelY, Fixed(1.0f / FPS));
+            CHECK(fy.toFloat() == doctest::Approx(y).epsilon(0.01));
+            CHECK(birdAngleFor(fvelY).toFloat() == doctest::Approx(birdAngleFor(velY)).epsilon(0.01));
+        }
+    }
+
+    TEST_CASE("simulacao em ponto fixo e identica bit a bit em qualquer build") {
+        // Valor de referência: deve ser o mesmo em -O0, -O3, com ou sem FMA, em x86 e ARM.
+        // Se uma mudança intencional nas regras alterar o resultado, atualize a constante.
+        uint64_t hash = runFixedPopulation();
+        CHECK(hash == runFixedPopulation());
+        CHECK(hash == 0x4232397E9A484683ull);
+    }
+}
@@ -0,0 +1,238 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "sim/Replay.hpp"
+#include "sim/StateHash.hpp"
+#include "Constants.hpp"
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    const char* TEST_REPLAY_FILE = "TestReplay.replay";
+
+    /// Joga uma partida com o piloto e grava o replay.
+    Replay playAndRecord(uint64_t seed, int maxTicks)
+    {
+        GameSimulation sim;
+        sim.reset(seed);
+        Replay replay;
+        replay.clear(seed);
+        for (int t = 0; t < maxTicks && sim.getPhase() != SimPhase::DEAD; ++t) {
+            bool jump = autopilot(sim.getState());
+            sim.step(jump);
+            replay.record(jump, sim.hash());
+        }
+        replay.setFinalScore(sim.getScore());
+        return replay;
+    }
+}
+
+TEST_SUITE("StateHash") {
+    TEST_CASE("mesma sequencia gera o mesmo hash e ordem importa") {
+        StateHasher a, b, c;
+        a.add(1, 2); a.add(3);
+        b.add(1, 2); b.add(3);
+        c.add(3); c.add(1, 2);
+        CHECK(a.digest() == b.digest());
+        CHECK(a.digest() != c.digest());
+    }
+
+    TEST_CASE("float e comparado bit a bit") {
+        CHECK(StateHasher::bits(0.0f) != StateHasher::bits(-0.0f));
+        CHECK(StateHasher::bits(1.5f) == StateHasher::bits(1.5f));
+    }
+}
+
+TEST_SUITE("GameSimulation") {
+    TEST_CASE("partida so comeca com o primeiro pulo") {
+        GameSimulation sim;
+        sim.reset(1);
+        uint64_t before = sim.hash();
+        CHECK(sim.step(false) == SIM_EVENT_NONE);
+        CHECK(sim.getPhase() == SimPhase::READY);
+        CHECK(sim.hash() == before);
+
+        CHECK((sim.step(true) & SIM_EVENT_JUMP) != 0);
+        CHECK(sim.getPhase() == SimPhase::PLAYING);
+        CHECK(sim.getTick() == 1);
+        CHECK(sim.getState().birdVelY < 0.0f);
+    }
+
+    TEST_CASE("sem pulos o passaro cai e morre no chao") {
+        GameSimulation sim;
+        sim.reset(1);
+        sim.step(true);
+        uint8_t events = SIM_EVENT_NONE;
+        for (int t = 0; t < 300 && !(events & SIM_EVENT_DEATH); ++t) events = sim.step(false);
+        CHECK(sim.getPhase() == SimPhase::DEAD);
+        CHECK(sim.getState().birdY + BIRD_HEIGHT >= PLAYABLE_AREA_HEIGHT);
+        uint64_t dead = sim.hash();
+        CHECK(sim.step(true) == SIM_EVENT_NONE);
+        CHECK(sim.hash() == dead);
+    }
+
+    TEST_CASE("piloto ultrapassa canos e pontua") {
+        Replay replay = playAndRecord(7, 3000);
+        CHECK(replay.getFinalScore() > 3);
+    }
+
+    TEST_CASE("mesma semente e mesmos pulos geram os mesmos hashes") {
+        Replay a = playAndRecord(42, 2000);
+        Replay b = playAndRecord(42, 2000);
+        CHECK(a.firstMismatch(b) == -1);
+
+        Replay other = playAndRecord(43, 2000);
+        CHECK(a.firstMismatch(other) == 0);
+    }
+
+    TEST_CASE("replay reproduz a partida passo a passo") {
+        Replay recorded = playAndRecord(99, 2000);
+        GameSimulation sim;
+        sim.reset(recorded.getSeed());
+        for (size_t t = 0; t < recorded.getTickCount(); ++t) {
+            sim.step(recorded.getJump(t));
+            REQUIRE(sim.hash() == recorded.getHash(t));
+        }
+        CHECK(sim.getScore() == recorded.getFinalScore());
+    }
+
+    TEST_CASE("versao em ponto fixo acompanha a de float com os mesmos pulos") {
+        GameSimulation sim;
+        FixedGameSimulation fixedSim;
+        sim.reset(7);
+        fixedSim.reset(7);
+        for (int t = 0; t < 600 && sim.getPhase() != SimPhase::DEAD; ++t) {
+            bool jump = autopilot(sim.getState());
+            sim.step(jump);
+            fixedSim.step(jump);
+            REQUIRE(fixedSim.getPhase() == sim.getPhase());
+            // O arredondamento de Q16.16 desvia o pássaro em pouco mais de um pixel, sem trocar o desfecho.
+            CHECK(std::fabs(toFloat(fixedSim.getState().birdY) - sim.getState().birdY) < 4.0f);
+        }
+        CHECK(fixedSim.getScore() == sim.getScore());
+        CHECK(fixedSim.getState().course.getCount() == sim.getState().course.getCount());
+    }
+}
+
+TEST_SUITE("Replay") {
+    TEST_CASE("capacidade reservada sobrevive a clear e nao cresce durante a partida") {
+        Replay replay;
+        replay.reserve(1000);
+        const size_t capacity = replay.getCapacity();
+        for (int game = 0; game < 3; ++game) {
+            replay.clear(static_cast<uint64_t>(game));
+            for (int t = 0; t < 1000; ++t) replay.record(t % 7 == 0, static_cast<uint64_t>(t));
+            CHECK(replay.getCapacity() == capacity);
+        }
+    }
+
+    TEST_CASE("salvar e carregar preserva tudo") {
+        Replay recorded = playAndRecord(5, 500);
+        recorded.save(TEST_REPLAY_FILE);
+        Replay loaded = Replay::load(TEST_REPLAY_FILE);
+        CHECK(loaded.getSeed() == recorded.getSeed());
+        CHECK(loaded.getFinalScore() == recorded.getFinalScore());
+        REQUIRE(loaded.getTickCount() == recorded.getTickCount());
+        for (size_t t = 0; t < loaded.getTickCount(); ++t) CHECK(loaded.getJump(t) == recorded.getJump(t));
+        CHECK(loaded.firstMismatch(recorded) == -1);
+        std::remove(TEST_REPLAY_FILE);
+    }
+
+    TEST_CASE("arquivo inexistente ou invalido gera excecao") {
+        CHECK_THROWS_AS(Replay::load("naoexiste.replay"), std::runtime_error);
+        std::FILE* f = std::fopen(TEST_REPLAY_FILE, "wb");
+        std::fputs("lixo", f);
+        std::fclose(f);
+        CHECK_THROWS_AS(Replay::load(TEST_REPLAY_FILE), std::runtime_error);
+        std::remove(TEST_REPLAY_FILE);
+    }
+
+    TEST_CASE("replay truncado ou com passos demais para o arquivo gera excecao") {
+        Replay recorded = playAndRecord(5, 500);
+        recorded.save(TEST_REPLAY_FILE);
+        std::FILE* f = std::fopen(TEST_REPLAY_FILE, "rb");
+        std::vector<char> bytes(24 + recorded.getTickCount() * 9);
+        REQUIRE(std::fread(bytes.data(), 1, bytes.size(), f) == bytes.size());
+        std::fclose(f);
+
+        // Corta o último hash pela metade.
+        f = std::fopen(TEST_REPLAY_FILE, "wb");
+        std::fwrite(bytes.data(), 1, bytes.size() - 4, f);
+        std::fclose(f);
+        CHECK_THROWS_AS(Replay::load(TEST_REPLAY_FILE), std::runtime_error);
+
+        // Só o cabeçalho, declarando 0xFFFFFFFF passos: recusado antes de alocar.
+        for (int i = 16; i < 20; ++i) bytes[i] = static_cast<char>(0xFF);
+        f = std::fopen(TEST_REPLAY_FILE, "wb");
+        std::fwrite(bytes.data(), 1, 24, f);
+        std::fclose(f);
+        CHECK_THROWS_AS(Replay::load(TEST_REPLAY_FILE), std::runtime_error);
+        std::remove(TEST_REPLAY_FILE);
+    }
+
+    TEST_CASE("firstMismatch aponta o passo divergente") {
+        Replay a, b;
+        a.clear(1); b.clear(1);
+        for (int t = 0; t < 10; ++t) { a.record(false, t); b.record(false, t == 6 ? 99 : t); }
+        CHECK(a.firstMismatch(b) == 6);
+        Replay shorter;
+        shorter.clear(1);
+        for (int t = 0; t < 4; ++t) shorter.record(false, t);
+        CHECK(a.firstMismatch(shorter) == 4);
+    }
+}
+
+TEST_SUITE("Snapshot") {
+    TEST_CASE("restaurar volta exatamente ao estado salvo") {
+        GameSimulation sim;
+        sim.reset(11);
+        for (int t = 0; t < 200 && sim.getPhase() != SimPhase::DEAD; ++t) sim.step(autopilot(sim.getState()));
+        REQUIRE(sim.getPhase() == SimPhase::PLAYING);
+
+        SimState snapshot;
+        sim.save(snapshot);
+        uint64_t savedHash = sim.hash();
+        uint32_t savedTick = sim.getTick();
+
+        for (int t = 0; t < 100; ++t) sim.step(t % 2 == 0);
+        CHECK(sim.hash() != savedHash);
+
+        sim.restore(snapshot);
+        CHECK(sim.hash() == savedHash);
+        CHECK(sim.getTick() == savedTick);
+    }
+
+    TEST_CASE("ramos a partir do mesmo snapshot sao independentes e reproduziveis") {
+        GameSimulation sim;
+        sim.reset(1);
+        for (int t = 0; t < 120; ++t) sim.step(autopilot(sim.getState()));
+        REQUIRE(sim.getPhase() == SimPhase::PLAYING);
+        SimState snapshot;
+        sim.save(snapshot);
+
+        // Ramo A: ninguém pula. Ramo B: piloto. Ramo A de novo deve dar o mesmo hash.
+        for (int t = 0; t < 60; ++t) sim.step(false);
+        uint64_t branchA = sim.hash();
+
+        sim.restore(snapshot);
+        for (int t = 0; t < 60; ++t) sim.step(autopilot(sim.getState()));
+        uint64_t branchB = sim.hash();
+
+        sim.restore(snapshot);
+        for (int t = 0; t < 60; ++t) sim.step(false);
+        CHECK(sim.hash() == branchA);
+        CHECK(branchA != branchB);
+    }
+
+    TEST_CASE("replay truncado continua de um checkpoint") {
+        Replay replay = playAndRecord(21, 300);
+        REQUIRE(replay.getTickCount() > 50);
+        replay.truncate(50);
+        CHECK(replay.getTickCount() == 50);
+        replay.truncate(80);
+        CHECK(replay.getTickCount() == 50);
+    }
+}
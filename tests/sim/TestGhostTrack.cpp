@@ -0,0 +1,89 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/GhostTrack.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "sim/Replay.hpp"
+#include "Constants.hpp"
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+    /// Grava uma partida do autopiloto e guarda as posições de cada passo.
+    Replay record(uint64_t seed, float offset, int maxTicks, std::vector<FixedSimState>* states = nullptr)
+    {
+        FixedGameSimulation sim;
+        sim.reset(seed);
+        Replay replay;
+        replay.clear(seed);
+        for (int t = 0; t < maxTicks && sim.getPhase() != SimPhase::DEAD; ++t) {
+            bool jump = autopilot(sim.getState(), offset);
+            sim.step(jump);
+            replay.record(jump, sim.hash());
+            if (states) states->push_back(sim.getState());
+        }
+        replay.setFinalScore(sim.getScore());
+        return replay;
+    }
+}
+
+TEST_SUITE("GhostTrackSet") {
+    TEST_CASE("a trajetória decodificada segue a partida gravada, quantizada") {
+        std::vector<FixedSimState> states;
+        Replay replay = record(1, 20.0f, 700, &states);
+        GhostTrackSet ghosts;
+        ghosts.add(replay);
+
+        ghosts.setTick(0);
+        CHECK_FALSE(ghosts.isVisible(0));
+        for (uint32_t t = 1; t <= states.size(); ++t) {
+            ghosts.setTick(t);
+            REQUIRE(ghosts.isVisible(0));
+            CHECK(std::fabs(ghosts.getY(0) - toFloat(states[t - 1].birdY)) <= 0.5f / GhostTrackSet::Y_SCALE);
+            CHECK(std::fabs(ghosts.getAngle(0) - toFloat(states[t - 1].birdAngle)) <= 0.5f);
+        }
+        // Depois do último passo gravado o fantasma some.
+        ghosts.setTick(static_cast<uint32_t>(states.size()) + 1);
+        CHECK_FALSE(ghosts.isVisible(0));
+
+        // Pouco mais de 2 bytes por passo.
+        CHECK(ghosts.getEncodedBytes() < states.size() * 3);
+    }
+
+    TEST_CASE("saltos para qualquer passo dão o mesmo resultado que avançar passo a passo") {
+        GhostTrackSet ghosts;
+        for (int g = 0; g < 20; ++g) ghosts.add(record(1, 10.0f + g, 900));
+        REQUIRE(ghosts.size() == 20);
+
+        std::vector<std::vector<float>> sequential;
+        for (uint32_t t = 0; t <= 900; ++t) {
+            ghosts.setTick(t);
+            std::vector<float> row;
+            for (size_t g = 0; g < ghosts.size(); ++g) row.push_back(ghosts.isVisible(g) ? ghosts.getY(g) : -1.0f);
+            sequential.push_back(row);
+        }
+
+        const uint32_t jumps[] = {700, 3, 64, 65, 128, 899, 1, 0, 513, 200};
+        for (uint32_t t : jumps) {
+            ghosts.setTick(t);
+            for (size_t g = 0; g < ghosts.size(); ++g) {
+                CHECK((ghosts.isVisible(g) ? ghosts.getY(g) : -1.0f) == sequential[t][g]);
+            }
+        }
+    }
+
+    TEST_CASE("um replay adulterado é recusado") {
+        Replay replay = record(7, 20.0f, 200);
+        Replay tampered;
+        tampered.clear(replay.getSeed());
+        for (size_t t = 0; t < replay.getTickCount(); ++t) {
+            tampered.record(t == 50 ? !replay.getJump(t) : replay.getJump(t), replay.getHash(t));
+        }
+        GhostTrackSet ghosts;
+        CHECK_THROWS_AS(ghosts.add(tampered), std::runtime_error);
+        CHECK(ghosts.empty());
+        CHECK(ghosts.getEncodedBytes() == 0);
+    }
+}
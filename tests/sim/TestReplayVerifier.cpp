@@ -0,0 +1,126 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/ReplayVerifier.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "sim/Replay.hpp"
+#include "Constants.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+    const char* TEST_REPLAY_FILE = "TestReplayVerifier.replay";
+
+    /// Joga uma partida com o piloto e grava o replay, como a GameScene.
+    Replay playAndRecord(uint64_t seed, int maxTicks)
+    {
+        FixedGameSimulation sim;
+        sim.reset(seed);
+        Replay replay;
+        replay.clear(seed);
+        for (int t = 0; t < maxTicks && sim.getPhase() != SimPhase::DEAD; ++t) {
+            bool jump = autopilot(sim.getState());
+            sim.step(jump);
+            replay.record(jump, sim.hash());
+        }
+        replay.setFinalScore(sim.getScore());
+        return replay;
+    }
+
+    /// Cópia do replay com o pulo de um passo trocado, mas com os hashes originais.
+    Replay withFlippedJump(const Replay& original, size_t tick)
+    {
+        Replay edited;
+        edited.clear(original.getSeed());
+        for (size_t t = 0; t < original.getTickCount(); ++t) {
+            edited.record(t == tick ? !original.getJump(t) : original.getJump(t), original.getHash(t));
+        }
+        edited.setFinalScore(original.getFinalScore());
+        return edited;
+    }
+}
+
+TEST_SUITE("ReplayVerifier") {
+    TEST_CASE("replay gravado pela partida e valido") {
+        Replay replay = playAndRecord(3, 3000);
+        REQUIRE(replay.getFinalScore() > 0);
+        ReplayCheck check = ReplayVerifier::check(replay);
+        CHECK(check.valid());
+        CHECK(check.score == replay.getFinalScore());
+        CHECK(check.ticks == replay.getTickCount());
+        CHECK(check.tick == -1);
+    }
+
+    TEST_CASE("pulo editado e detectado no passo exato") {
+        Replay replay = playAndRecord(4, 3000);
+        REQUIRE(replay.getTickCount() > 100);
+        ReplayCheck check = ReplayVerifier::check(withFlippedJump(replay, 80));
+        CHECK(check.status == ReplayStatus::HASH_MISMATCH);
+        CHECK(check.tick == 80);
+    }
+
+    TEST_CASE("pontuacao declarada ou gravada diferente da re-simulacao e recusada") {
+        Replay replay = playAndRecord(5, 3000);
+        CHECK(ReplayVerifier::check(replay, replay.getFinalScore() + 1).status == ReplayStatus::SCORE_MISMATCH);
+        CHECK(ReplayVerifier::check(replay, INT32_MAX).status == ReplayStatus::SCORE_MISMATCH);
+
+        // Hashes coerentes (recalculados pelo trapaceiro), mas pontuação inflada no arquivo.
+        Replay inflated = replay;
+        inflated.setFinalScore(replay.getFinalScore() + 10);
+        ReplayCheck check = ReplayVerifier::check(inflated, inflated.getFinalScore());
+        CHECK(check.status == ReplayStatus::SCORE_MISMATCH);
+        CHECK(check.score == replay.getFinalScore());
+    }
+
+    TEST_CASE("passos depois da colisao sao recusados") {
+        Replay replay = playAndRecord(6, 3000);
+        Replay padded = replay;
+        const uint64_t lastHash = replay.getHash(replay.getTickCount() - 1);
+        for (int t = 0; t < 30; ++t) padded.record(false, lastHash);
+        ReplayCheck check = ReplayVerifier::check(padded);
+        CHECK(check.status == ReplayStatus::AFTER_DEATH);
+        CHECK(check.tick == static_cast<long>(replay.getTickCount()));
+    }
+
+    TEST_CASE("partida sem pulos tem pontuacao zero") {
+        Replay replay;
+        replay.clear(8);
+        CHECK(ReplayVerifier::check(replay).valid());
+        CHECK(ReplayVerifier::check(replay, 1).status == ReplayStatus::SCORE_MISMATCH);
+    }
+
+    TEST_CASE("lote da o mesmo resultado de cada conferencia isolada, com qualquer numero de threads") {
+        std::vector<Replay> replays;
+        for (uint64_t seed = 1; seed <= 40; ++seed) {
+            Replay replay = playAndRecord(seed, 2000);
+            replays.push_back(seed % 5 == 0 && replay.getTickCount() > 10 ? withFlippedJump(replay, 10) : replay);
+        }
+        ReplayVerifier single(1);
+        ReplayVerifier multi(4);
+        std::vector<ReplayCheck> a = single.verify(replays);
+        std::vector<ReplayCheck> b = multi.verify(replays);
+        REQUIRE(a.size() == replays.size());
+        REQUIRE(b.size() == replays.size());
+        for (size_t i = 0; i < replays.size(); ++i) {
+            ReplayCheck alone = ReplayVerifier::check(replays[i]);
+            CHECK(a[i].status == alone.status);
+            CHECK(b[i].status == alone.status);
+            CHECK(b[i].tick == alone.tick);
+            CHECK(b[i].score == alone.score);
+        }
+    }
+
+    TEST_CASE("arquivos sao lidos e conferidos; arquivos invalidos nao derrubam o lote") {
+        Replay replay = playAndRecord(9, 1000);
+        replay.save(TEST_REPLAY_FILE);
+        ReplayVerifier verifier(2);
+        std::vector<ReplayCheck> checks = verifier.verifyFiles({TEST_REPLAY_FILE, "naoexiste.replay"});
+        REQUIRE(checks.size() == 2);
+        CHECK(checks[0].valid());
+        CHECK(checks[0].score == replay.getFinalScore());
+        CHECK(checks[1].status == ReplayStatus::UNREADABLE);
+        std::remove(TEST_REPLAY_FILE);
+    }
+}
@@ -0,0 +1,99 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/RewindBuffer.hpp"
+#include "sim/GameSimulation.hpp"
+#include "sim/Autopilot.hpp"
+#include "Constants.hpp"
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+    bool sameBytes(const FixedSimState& a, const FixedSimState& b)
+    {
+        return std::memcmp(&a, &b, sizeof(FixedSimState)) == 0;
+    }
+
+    /// Joga uma partida gravando cada transição; retorna todos os estados.
+    std::vector<FixedSimState> playRecording(RewindBuffer& rewind, uint64_t seed, int ticks)
+    {
+        FixedGameSimulation sim;
+        sim.reset(seed);
+        std::vector<FixedSimState> history;
+        FixedSimState state;
+        sim.save(state);
+        history.push_back(state);
+        for (int t = 0; t < ticks && sim.getPhase() != SimPhase::DEAD; ++t) {
+            FixedSimState previous;
+            sim.save(previous);
+            sim.step(autopilot(sim.getState()));
+            sim.save(state);
+            rewind.push(previous, state);
+            history.push_back(state);
+        }
+        return history;
+    }
+}
+
+TEST_SUITE("RewindBuffer") {
+    TEST_CASE("voltar passo a passo reproduz cada estado anterior") {
+        auto rewind = std::make_unique<RewindBuffer>();
+        std::vector<FixedSimState> history = playRecording(*rewind, 1, 200);
+        REQUIRE(rewind->size() == history.size() - 1);
+
+        FixedSimState state = history.back();
+        for (size_t i = history.size() - 1; i > 0; --i) {
+            REQUIRE(rewind->stepBack(state));
+            CHECK(sameBytes(state, history[i - 1]));
+        }
+        CHECK(rewind->empty());
+        CHECK_FALSE(rewind->stepBack(state));
+        CHECK(sameBytes(state, history.front()));
+        CHECK(rewind->getBytesUsed() == 0);
+    }
+
+    TEST_CASE("historico fica limitado a REWIND_SECONDS e descarta o mais antigo") {
+        auto rewind = std::make_unique<RewindBuffer>();
+        std::vector<FixedSimState> history = playRecording(*rewind, 1, 1000);
+        REQUIRE(history.size() - 1 > RewindBuffer::MAX_TICKS);
+        CHECK(rewind->size() == RewindBuffer::MAX_TICKS);
+        CHECK(rewind->getBytesUsed() <= RewindBuffer::BYTE_CAPACITY);
+
+        FixedSimState state = history.back();
+        size_t steps = 0;
+        while (rewind->stepBack(state)) ++steps;
+        CHECK(steps == RewindBuffer::MAX_TICKS);
+        CHECK(sameBytes(state, history[history.size() - 1 - RewindBuffer::MAX_TICKS]));
+    }
+
+    TEST_CASE("diferencas sao bem menores que snapshots completos") {
+        auto rewind = std::make_unique<RewindBuffer>();
+        playRecording(*rewind, 1, 300);
+        REQUIRE(rewind->size() > 0);
+        double average = static_cast<double>(rewind->getBytesUsed()) / rewind->size();
+        CHECK(average < sizeof(FixedSimState) / 2.0);
+    }
+
+    TEST_CASE("gravar depois de voltar continua a partir do estado restaurado") {
+        auto rewind = std::make_unique<RewindBuffer>();
+        std::vector<FixedSimState> history = playRecording(*rewind, 1, 100);
+        FixedSimState state = history.back();
+        for (int i = 0; i < 40; ++i) REQUIRE(rewind->stepBack(state));
+
+        FixedGameSimulation sim;
+        sim.restore(state);
+        FixedSimState previous = state;
+        sim.step(true);
+        FixedSimState next;
+        sim.save(next);
+        rewind->push(previous, next);
+        REQUIRE(rewind->stepBack(next));
+        CHECK(sameBytes(next, previous));
+        REQUIRE(rewind->stepBack(next));
+        CHECK(sameBytes(next, history[history.size() - 42]));
+    }
+
+    TEST_CASE("memoria fixa abaixo de 256 KB") {
+        CHECK(sizeof(RewindBuffer) <= 256 * 1024);
+    }
+}
@@ -0,0 +1,117 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest/doctest.h"
+#include "sim/RollbackSession.hpp"
+#include "sim/VersusSimulation.hpp"
+#include "Constants.hpp"
+#include "sim/Autopilot.hpp"
+#include <memory>
+#include <vector>
+
+namespace {
+    /// Pulos de cada jogador, gerados jogando sozinho com o autopiloto.
+    std::vector<bool> script(uint64_t seed, float offset, int ticks)
+    {
+        FixedGameSimulation sim;
+        sim.reset(seed);
+        std::vector<bool> jumps;
+        for (int t = 0; t < ticks; ++t) {
+            jumps.push_back(autopilot(sim.getState(), offset));
+            sim.step(t == 0 || jumps.back());
+        }
+        return jumps;
+    }
+
+    /// A partida de referência, com todas as entradas conhecidas.
+    VersusSimulation lockstep(uint64_t seed, const std::vector<bool> jumps[2], int ticks)
+    {
+        VersusSimulation sim;
+        sim.reset(seed);
+        for (int t = 0; t < ticks; ++t) {
+            bool step[2] = {jumps[0][t], jumps[1][t]};
+            sim.step(step);
+        }
+        return sim;
+    }
+}
+
+TEST_SUITE("VersusSimulation") {
+    TEST_CASE("os dois jogadores começam juntos e veem os mesmos canos") {
+        VersusSimulation sim;
+        sim.reset(5);
+        bool jumps[2] = {false, false};
+        sim.step(jumps);
+        CHECK(sim.getPlayer(0).getPhase() == SimPhase::PLAYING);
+        CHECK(sim.getPlayer(1).getPhase() == SimPhase::PLAYING);
+        for (int t = 0; t < 60; ++t) sim.step(jumps);
+        CHECK(sim.getPlayer(0).getState().course.getRandom().state == sim.getPlayer(1).getState().course.getRandom().state);
+    }
+
+    TEST_CASE("quem sobrevive mais vence") {
+        const int ticks = 1200;
+        std::vector<bool> jumps[2] = {script(1, 20.0f, ticks), std::vector<bool>(ticks, false)};
+        VersusSimulation sim = lockstep(1, jumps, ticks);
+        REQUIRE(sim.isOver());
+        CHECK(sim.getWinner() == 0);
+        CHECK(sim.getPlayer(0).getScore() > 0);
+    }
+}
+
+TEST_SUITE("RollbackSession") {
+    TEST_CASE("sem rede, a sessão prevê 'sem pulo' e fica no máximo MAX_PREDICTION passos à frente") {
+        auto session = std::make_unique<RollbackSession>();
+        session->start(3, 0);
+        uint32_t advanced = 0;
+        while (session->advance(false)) ++advanced;
+        CHECK(advanced == RollbackSession::MAX_PREDICTION);
+        CHECK_FALSE(session->isConfirmed());
+
+        // Chegam as entradas remotas (iguais à previsão): a sessão volta a andar sem rollback.
+        for (uint32_t t = 0; t < advanced; ++t) session->addRemoteInput(t, false);
+        CHECK(session->isConfirmed());
+        CHECK(session->advance(false));
+        CHECK(session->getRollbackCount() == 0);
+    }
+
+    TEST_CASE("uma previsão errada é corrigida e o estado volta a ser o da partida de referência") {
+        const uint64_t seed = 1;
+        const int ticks = 400;
+        std::vector<bool> jumps[2] = {script(seed, 20.0f, ticks), script(seed, 30.0f, ticks)};
+        auto session = std::make_unique<RollbackSession>();
+        session->start(seed, 0);
+
+        // As entradas remotas chegam sempre 6 passos atrasadas.
+        const int delay = 6;
+        for (int t = 0; t < ticks; ++t) {
+            if (t >= delay) session->addRemoteInput(t - delay, jumps[1][t - delay]);
+            REQUIRE(session->advance(jumps[0][t]));
+        }
+        for (int t = ticks - delay; t < ticks; ++t) session->addRemoteInput(t, jumps[1][t]);
+        session->rollback();
+
+        REQUIRE(session->isConfirmed());
+        CHECK(session->getSimulation().hash() == lockstep(seed, jumps, ticks).hash());
+        CHECK(session->getRollbackCount() > 0);
+        CHECK(session->getMaxRollback() <= static_cast<uint32_t>(delay));
+    }
+
+    TEST_CASE("entradas repetidas, fora de ordem ou adiantadas não mudam o resultado") {
+        const uint64_t seed = 7;
+        const int ticks = 300;
+        std::vector<bool> jumps[2] = {script(seed, 25.0f, ticks), script(seed, 15.0f, ticks)};
+        auto session = std::make_unique<RollbackSession>();
+        session->start(seed, 1);
+
+        for (int t = 0; t < ticks; t += 4) {
+            // O jogador remoto está 4 passos à frente: entradas futuras, em ordem inversa e repetidas.
+            for (int r = t + 7; r >= t; --r) {
+                if (r < ticks) session->addRemoteInput(r, jumps[0][r]);
+                if (r < ticks) session->addRemoteInput(r, jumps[0][r]);
+            }
+            for (int s = t; s < t + 4; ++s) REQUIRE(session->advance(jumps[1][s]));
+        }
+
+        REQUIRE(session->isConfirmed());
+        CHECK(session->getSimulation().hash() == lockstep(seed, jumps, ticks).hash());
+        CHECK(session->getRollbackCount() == 0);
+    }
+}